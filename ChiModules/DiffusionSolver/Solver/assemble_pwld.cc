@@ -19,42 +19,130 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b(const chi_mesh::Cell &cell,
   size_t num_nodes = fe_intgrl_values.NumNodes();
 
   //====================================== Process material id
-  int mat_id = cell.material_id;
-
   std::vector<double> D(num_nodes, 1.0);
   std::vector<double> q(num_nodes, 1.0);
   std::vector<double> siga(num_nodes, 0.0);
 
   GetMaterialProperties(cell, num_nodes, D, q, siga, component);
 
-  //========================================= Loop over DOFs
+  PWLD_Assemble_CellBlocks(cell, D, q, siga, component, component, true);
+}
+
+//###################################################################
+/**Assembles the MIP matrix rows and rhs entries of a cell for a single
+ * component. The element blocks of PWLD_Compute_CellBlocks are each
+ * inserted with a single MatSetValues call, instead of one MatSetValue
+ * per entry.
+ *
+ * \param cell The cell.
+ * \param D Nodal diffusion coefficients of the cell.
+ * \param q Nodal sources of the cell.
+ * \param siga Nodal absorption cross sections of the cell.
+ * \param material_group Group for which the neighbor material properties
+ *                       are obtained.
+ * \param component Unknown component of the dofs.
+ * \param dirichlet_rhs Flag, if true, the Dirichlet boundary values are
+ *                      added to the rhs.*/
+void chi_diffusion::Solver::
+  PWLD_Assemble_CellBlocks(const chi_mesh::Cell& cell,
+                           const std::vector<double>& D,
+                           const std::vector<double>& q,
+                           const std::vector<double>& siga,
+                           int material_group,
+                           int component,
+                           bool dirichlet_rhs)
+{
+  auto pwl_sdm = std::static_pointer_cast<SpatialDiscretization_PWLD>(this->discretization);
+
+  PWLDCellBlocks blocks;
+  PWLD_Compute_CellBlocks(cell, D, q, siga, material_group, dirichlet_rhs,
+                          blocks);
+
+  const int num_nodes = static_cast<int>(blocks.b_cell.size());
+
+  //========================================= Cell dof indices
+  std::vector<PetscInt> cell_dofs(num_nodes);
   for (int i=0; i<num_nodes; i++)
+    cell_dofs[i] = pwl_sdm->MapDOF(cell, i, unknown_manager, 0, component);
+
+  //========================================= Insert neighbor blocks
+  for (const auto& face_blocks : blocks.faces)
   {
-    int ir = pwl_sdm->MapDOF(cell, i, unknown_manager, 0, component);
-    double rhsvalue =0.0;
+    const int num_face_dofs =
+      static_cast<int>(face_blocks.adj_face_nodes.size());
+
+    std::vector<PetscInt> adj_face_dofs(num_face_dofs);
+    for (int fj=0; fj<num_face_dofs; fj++)
+      adj_face_dofs[fj] = pwl_sdm->MapDOF(*face_blocks.adj_cell,
+                                          face_blocks.adj_face_nodes[fj],
+                                          unknown_manager, 0, component);
+
+    MatSetValues(A,num_nodes,cell_dofs.data(),
+                 num_face_dofs,adj_face_dofs.data(),
+                 face_blocks.A_cell_adj.data(),ADD_VALUES);
+    MatSetValues(A,num_face_dofs,adj_face_dofs.data(),
+                 num_nodes,cell_dofs.data(),
+                 face_blocks.A_adj_cell.data(),ADD_VALUES);
+  }
+
+  //========================================= Insert cell blocks
+  MatSetValues(A,num_nodes,cell_dofs.data(),
+               num_nodes,cell_dofs.data(),
+               blocks.A_cell.data(),ADD_VALUES);
+  VecSetValues(b,num_nodes,cell_dofs.data(),blocks.b_cell.data(),ADD_VALUES);
+}
 
-    //====================== Develop matrix entry
-    for (int j=0; j<num_nodes; j++)
-    {
-      int jr = pwl_sdm->MapDOF(cell, j, unknown_manager, 0, component);
+//###################################################################
+/**Computes the dense MIP element blocks of a cell for a single component:
+ * the cell-cell coupling, the rhs and, per interior face, one block for
+ * each direction of the coupling to the neighbor's face nodes. The blocks
+ * are in cell and face node indices, the caller maps them to dofs.
+ *
+ * \param cell The cell.
+ * \param D Nodal diffusion coefficients of the cell.
+ * \param q Nodal sources of the cell.
+ * \param siga Nodal absorption cross sections of the cell.
+ * \param material_group Group for which the neighbor material properties
+ *                       are obtained.
+ * \param dirichlet_rhs Flag, if true, the Dirichlet boundary values are
+ *                      added to the rhs.
+ * \param blocks The element blocks.*/
+void chi_diffusion::Solver::
+  PWLD_Compute_CellBlocks(const chi_mesh::Cell& cell,
+                          const std::vector<double>& D,
+                          const std::vector<double>& q,
+                          const std::vector<double>& siga,
+                          int material_group,
+                          bool dirichlet_rhs,
+                          PWLDCellBlocks& blocks)
+{
+  auto pwl_sdm = std::static_pointer_cast<SpatialDiscretization_PWLD>(this->discretization);
+  //Pinned, since the neighbors' integrals are obtained as well
+  const auto fe_intgrl_ptr = pwl_sdm->PinUnitIntegrals(cell);
+  const auto& fe_intgrl_values = *fe_intgrl_ptr;
 
-      double jr_mat_entry =
-        D[j]* fe_intgrl_values.IntV_gradShapeI_gradShapeJ(i, j);
+  const int num_nodes = static_cast<int>(fe_intgrl_values.NumNodes());
 
-      jr_mat_entry +=
-        siga[j]* fe_intgrl_values.IntV_shapeI_shapeJ(i, j);
+  //Row-major element blocks
+  auto& A_cell = blocks.A_cell;
+  auto& b_cell = blocks.b_cell;
+  A_cell.assign(num_nodes*num_nodes, 0.0);
+  b_cell.assign(num_nodes, 0.0);
+  blocks.faces.clear();
 
-      MatSetValue(A,ir,jr,jr_mat_entry,ADD_VALUES);
+  //========================================= Volume terms
+  for (int i=0; i<num_nodes; i++)
+  {
+    for (int j=0; j<num_nodes; j++)
+    {
+      A_cell[i*num_nodes + j] +=
+        D[j]* fe_intgrl_values.IntV_gradShapeI_gradShapeJ(i, j) +
+        siga[j]* fe_intgrl_values.IntV_shapeI_shapeJ(i, j);
 
-      rhsvalue += q[j]* fe_intgrl_values.IntV_shapeI_shapeJ(i, j);
+      b_cell[i] += q[j]* fe_intgrl_values.IntV_shapeI_shapeJ(i, j);
     }//for j
-
-    //====================== Apply RHS entry
-    VecSetValue(b,ir,rhsvalue,ADD_VALUES);
-
   }//for i
 
-
   //========================================= Loop over faces
   int num_faces = cell.faces.size();
   for (unsigned int f=0; f<num_faces; f++)
@@ -69,8 +157,8 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b(const chi_mesh::Cell &cell,
     if (face.has_neighbor)
     {
       const auto& adj_cell = pwl_sdm->GetNeighborCell(face.neighbor_id);
-      const auto& adj_fe_intgrl_values = pwl_sdm->GetUnitIntegrals(adj_cell);
-
+      const auto adj_fe_intgrl_ptr = pwl_sdm->PinUnitIntegrals(adj_cell);
+      const auto& adj_fe_intgrl_values = *adj_fe_intgrl_ptr;
 
       //========================= Get the current map to the adj cell's face
       unsigned int fmap = MapCellFace(cell,adj_cell,f);
@@ -86,7 +174,7 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b(const chi_mesh::Cell &cell,
                             adj_D,
                             adj_Q,
                             adj_sigma,
-                            component);
+                            material_group);
 
       //========================= Compute surface average D
       double D_avg = 0.0;
@@ -120,25 +208,35 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b(const chi_mesh::Cell &cell,
       if (cell.Type() == chi_mesh::CellType::POLYHEDRON)
         kappa = fmax(4.0*(adj_D_avg/hp + D_avg/hm),0.25);
 
+      //========================= Neighbor face nodes
+      blocks.faces.emplace_back();
+      auto& face_blocks = blocks.faces.back();
+      face_blocks.adj_cell = &adj_cell;
+      face_blocks.adj_face_nodes.resize(num_face_dofs);
+      for (int fj=0; fj<num_face_dofs; fj++)
+        face_blocks.adj_face_nodes[fj] = static_cast<int>(
+          MapCellLocalNodeIDFromGlobalID(adj_cell, face.vertex_ids[fj]));
+
+      //Cell rows by neighbor face columns, and the transpose coupling
+      auto& A_cell_adj = face_blocks.A_cell_adj;
+      auto& A_adj_cell = face_blocks.A_adj_cell;
+      A_cell_adj.assign(num_nodes*num_face_dofs, 0.0);
+      A_adj_cell.assign(num_face_dofs*num_nodes, 0.0);
+
       //========================= Assembly penalty terms
       for (int fi=0; fi<num_face_dofs; fi++)
       {
-        int i  = fe_intgrl_values.FaceDofMapping(f,fi);
-        int ir = pwl_sdm->MapDOF(cell, i, unknown_manager, 0, component);
+        int i = fe_intgrl_values.FaceDofMapping(f,fi);
 
         for (int fj=0; fj<num_face_dofs; fj++)
         {
-          int j     = fe_intgrl_values.FaceDofMapping(f,fj);
-          int jr    = pwl_sdm->MapDOF(cell, j, unknown_manager, 0, component);
-          int jmap  = MapCellLocalNodeIDFromGlobalID(adj_cell, face.vertex_ids[fj]);
-          int jrmap = pwl_sdm->MapDOF(adj_cell, jmap, unknown_manager, 0, component);
+          int j = fe_intgrl_values.FaceDofMapping(f,fj);
 
           double aij = kappa* fe_intgrl_values.IntS_shapeI_shapeJ(f, i, j);
 
-          MatSetValue(A,ir    ,jr   , aij,ADD_VALUES);
-          MatSetValue(A,ir    ,jrmap,-aij,ADD_VALUES);
+          A_cell    [i*num_nodes     + j ] += aij;
+          A_cell_adj[i*num_face_dofs + fj] -= aij;
         }//for fj
-
       }//for fi
 
       //========================= Assemble gradient terms
@@ -146,45 +244,34 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b(const chi_mesh::Cell &cell,
       // Dk = 0.5* n dot nabla bk
 
       // 0.5*D* n dot (b_j^+ - b_j^-)*nabla b_i^-
-      for (int i=0; i<fe_intgrl_values.NumNodes(); i++)
+      for (int i=0; i<num_nodes; i++)
       {
-        int ir = pwl_sdm->MapDOF(cell, i, unknown_manager, 0, component);
-
         for (int fj=0; fj<num_face_dofs; fj++)
         {
-          int j     = fe_intgrl_values.FaceDofMapping(f,fj);
-          int jr    = pwl_sdm->MapDOF(cell, j, unknown_manager, 0, component);
-          int jmap  = MapCellLocalNodeIDFromGlobalID(adj_cell, face.vertex_ids[fj]);
-          int jrmap = pwl_sdm->MapDOF(adj_cell, jmap, unknown_manager, 0, component);
+          int j = fe_intgrl_values.FaceDofMapping(f,fj);
 
           double aij =
             -0.5*D_avg*n.Dot(fe_intgrl_values.IntS_shapeI_gradshapeJ(f, j, i));
 
-          MatSetValue(A,ir,jr   , aij,ADD_VALUES);
-          MatSetValue(A,ir,jrmap,-aij,ADD_VALUES);
+          A_cell    [i*num_nodes     + j ] += aij;
+          A_cell_adj[i*num_face_dofs + fj] -= aij;
         }//for fj
       }//for i
 
       // 0.5*D* n dot (b_i^+ - b_i^-)*nabla b_j^-
       for (int fi=0; fi<num_face_dofs; fi++)
       {
-        int i     = fe_intgrl_values.FaceDofMapping(f,fi);
-        int ir    = pwl_sdm->MapDOF(cell, i, unknown_manager, 0, component);
-        int imap  = MapCellLocalNodeIDFromGlobalID(adj_cell, face.vertex_ids[fi]);
-        int irmap = pwl_sdm->MapDOF(adj_cell, imap, unknown_manager, 0, component);
+        int i = fe_intgrl_values.FaceDofMapping(f,fi);
 
-        for (int j=0; j<fe_intgrl_values.NumNodes(); j++)
+        for (int j=0; j<num_nodes; j++)
         {
-          int jr = pwl_sdm->MapDOF(cell, j, unknown_manager, 0, component);
-
           double aij =
             -0.5*D_avg*n.Dot(fe_intgrl_values.IntS_shapeI_gradshapeJ(f, i, j));
 
-          MatSetValue(A,ir   ,jr, aij,ADD_VALUES);
-          MatSetValue(A,irmap,jr,-aij,ADD_VALUES);
+          A_cell    [i *num_nodes + j] += aij;
+          A_adj_cell[fi*num_nodes + j] -= aij;
         }//for j
       }//for fi
-
     }//if not bndry
     else
     {
@@ -195,6 +282,8 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b(const chi_mesh::Cell &cell,
       {
         auto dc_boundary =
           (chi_diffusion::BoundaryDirichlet*)boundaries[ir_boundary_index];
+        const double bc_value =
+          dirichlet_rhs ? dc_boundary->boundary_value : 0.0;
 
         //========================= Compute penalty coefficient
         double hm = HPerpendicular(cell, fe_intgrl_values, f);
@@ -221,38 +310,32 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b(const chi_mesh::Cell &cell,
         //========================= Assembly penalty terms
         for (int fi=0; fi<num_face_dofs; fi++)
         {
-          int i  = fe_intgrl_values.FaceDofMapping(f,fi);
-          int ir = pwl_sdm->MapDOF(cell, i, unknown_manager, 0, component);
+          int i = fe_intgrl_values.FaceDofMapping(f,fi);
 
           for (int fj=0; fj<num_face_dofs; fj++)
           {
-            int j  = fe_intgrl_values.FaceDofMapping(f,fj);
-            int jr = pwl_sdm->MapDOF(cell, j, unknown_manager, 0, component);
+            int j = fe_intgrl_values.FaceDofMapping(f,fj);
 
             double aij = kappa* fe_intgrl_values.IntS_shapeI_shapeJ(f, i, j);
 
-            MatSetValue(A,ir    ,jr, aij,ADD_VALUES);
-            VecSetValue(b,ir,aij*dc_boundary->boundary_value,ADD_VALUES);
+            A_cell[i*num_nodes + j] += aij;
+            b_cell[i] += aij*bc_value;
           }//for fj
         }//for fi
 
         // -Di^- bj^- and
         // -Dj^- bi^-
-        for (int i=0; i<fe_intgrl_values.NumNodes(); i++)
+        for (int i=0; i<num_nodes; i++)
         {
-          int ir = pwl_sdm->MapDOF(cell, i, unknown_manager, 0, component);
-
-          for (int j=0; j<fe_intgrl_values.NumNodes(); j++)
+          for (int j=0; j<num_nodes; j++)
           {
-            int jr = pwl_sdm->MapDOF(cell, j, unknown_manager, 0, component);
-
             double gij =
               n.Dot(fe_intgrl_values.IntS_shapeI_gradshapeJ(f, i, j) +
                     fe_intgrl_values.IntS_shapeI_gradshapeJ(f, j, i));
             double aij = -0.5*D_avg*gij;
 
-            MatSetValue(A,ir,jr,aij,ADD_VALUES);
-            VecSetValue(b,ir,aij*dc_boundary->boundary_value,ADD_VALUES);
+            A_cell[i*num_nodes + j] += aij;
+            b_cell[i] += aij*bc_value;
           }//for j
         }//for i
       }//Dirichlet
@@ -263,24 +346,22 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b(const chi_mesh::Cell &cell,
 
         for (int fi=0; fi<num_face_dofs; fi++)
         {
-          int i  = fe_intgrl_values.FaceDofMapping(f,fi);
-          int ir = pwl_sdm->MapDOF(cell, i, unknown_manager, 0, component);
+          int i = fe_intgrl_values.FaceDofMapping(f,fi);
 
           for (int fj=0; fj<num_face_dofs; fj++)
           {
-            int j  = fe_intgrl_values.FaceDofMapping(f,fj);
-            int jr = pwl_sdm->MapDOF(cell, j, unknown_manager, 0, component);
+            int j = fe_intgrl_values.FaceDofMapping(f,fj);
 
             double aij = robin_bndry->a* fe_intgrl_values.IntS_shapeI_shapeJ(f, i, j);
             aij /= robin_bndry->b;
 
-            MatSetValue(A,ir ,jr, aij,ADD_VALUES);
+            A_cell[i*num_nodes + j] += aij;
           }//for fj
 
           double aii = robin_bndry->f* fe_intgrl_values.IntS_shapeI(f, i);
           aii /= robin_bndry->b;
 
-          MatSetValue(A,ir ,ir, aii,ADD_VALUES);
+          A_cell[i*num_nodes + i] += aii;
         }//for fi
       }//robin
     }
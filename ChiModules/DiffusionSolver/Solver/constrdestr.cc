@@ -3,6 +3,9 @@
 #include <chi_log.h>
 extern ChiLog& chi_log;
 
+#include "chi_mpi.h"
+extern ChiMPI& chi_mpi;
+
 chi_diffusion::Solver::Solver()
 {}
 
@@ -13,7 +16,7 @@ chi_diffusion::Solver::Solver(std::string in_solver_name):Solver()
 
 chi_diffusion::Solver::~Solver()
 {
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
   chi_log.Log(LOG_0)
     << "Cleaning up diffusion solver: " << solver_name;
 
@@ -22,7 +25,13 @@ chi_diffusion::Solver::~Solver()
   MatDestroy(&A);
   KSPDestroy(&ksp);
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  if (matrix_free)
+  {
+    VecDestroy(&mf_x_work);
+    VecScatterDestroy(&mf_ghost_scatter);
+  }
+
+  MPI_Barrier(chi_mpi.comm);
   chi_log.Log(LOG_0)
     << "Done cleaning up diffusion solver: " << solver_name;
 }
\ No newline at end of file
@@ -18,6 +18,7 @@
 
 #include "ChiPhysics/FieldFunction/fieldfunction.h"
 #include "ChiTimer/chi_timer.h"
+#include "ChiMath/chi_math.h"
 
 #include <petscksp.h>
 
@@ -87,6 +88,8 @@ public:
 
   std::vector<double>            pwld_phi_local;
 
+  bool                           matrix_free = false;
+
   int    max_iters = 500;
   double residual_tolerance = 1.0e-8;
   int    gi = 0;
@@ -118,10 +121,42 @@ public:
   void CFEM_Assemble_A_and_b(chi_mesh::Cell& cell, int group=0);
 
   //02c_c
+  /**Dense MIP element blocks of a cell for a single component, in cell
+   * and neighbor face node indices.*/
+  struct PWLDCellBlocks
+  {
+    /**Couplings to the face nodes of a neighbor.*/
+    struct FaceBlocks
+    {
+      const chi_mesh::Cell* adj_cell = nullptr;
+      std::vector<int>      adj_face_nodes;  ///< Adj node of each face node
+      std::vector<double>   A_cell_adj;      ///< [i*num_face_nodes + fj]
+      std::vector<double>   A_adj_cell;      ///< [fi*num_nodes + j]
+    };
+
+    std::vector<double>     A_cell;          ///< [i*num_nodes + j]
+    std::vector<double>     b_cell;          ///< [i]
+    std::vector<FaceBlocks> faces;           ///< Per interior face
+  };
+
   void PWLD_Assemble_A_and_b(const chi_mesh::Cell& cell,
                              int component=0);
   void PWLD_Assemble_b(const chi_mesh::Cell& cell,
                        int component=0);
+  void PWLD_Assemble_CellBlocks(const chi_mesh::Cell& cell,
+                                const std::vector<double>& D,
+                                const std::vector<double>& q,
+                                const std::vector<double>& siga,
+                                int material_group,
+                                int component,
+                                bool dirichlet_rhs);
+  void PWLD_Compute_CellBlocks(const chi_mesh::Cell& cell,
+                               const std::vector<double>& D,
+                               const std::vector<double>& q,
+                               const std::vector<double>& siga,
+                               int material_group,
+                               bool dirichlet_rhs,
+                               PWLDCellBlocks& blocks);
 
   //02e_c
   void PWLD_Assemble_A_and_b_GAGG(const chi_mesh::Cell& cell);
@@ -141,6 +176,60 @@ public:
   unsigned int MapCellFace(const chi_mesh::Cell& cur_cell,
                            const chi_mesh::Cell& adj_cell,
                            unsigned int f);
+
+  //04 Matrix-free MIP
+public:
+  /**Face data of the matrix-free MIP operator. Indices into the
+   * work vector are local dofs followed by ghost dofs. The integrals of
+   * interior faces are the same for all components.*/
+  struct MFFaceData
+  {
+    enum FaceType {INTERIOR, DIRICHLET, ROBIN, OTHER} type = OTHER;
+    double hm = 1.0;                         ///< Own h-perpendicular
+    double hp = 1.0;                         ///< Neighbor h-perpendicular
+    std::vector<int64_t> adj_dofs;           ///< [comp*num_adj_nodes + j]
+    std::vector<int>     cell_node_of_face_node; ///< Own face node to own node
+    std::vector<int>     adj_node_of_face_node;  ///< Own face node to adj node
+    std::vector<int>     cell_node_of_adj_face_node; ///< Adj face node to own node
+    MatDbl               IntS_shapeI_shapeJ; ///< [face node][face node]
+    MatDbl               n_IntS_shapeI_gradshapeJ; ///< [face node j][node i]
+    MatDbl               adj_n_IntS_shapeI_gradshapeJ; ///< [adj face node][adj node]
+    std::vector<double>  kappa;              ///< Per component
+    std::vector<double>  D_avg;              ///< Per component
+    std::vector<double>  adj_D_avg;          ///< Per component
+  };
+  /**Cell data of the matrix-free MIP operator.*/
+  struct MFCellData
+  {
+    std::vector<int64_t>     dofs;           ///< [comp*num_nodes + i]
+    std::vector<double>      D;              ///< [comp*num_nodes + i]
+    std::vector<double>      siga;           ///< [comp*num_nodes + i]
+    std::vector<MFFaceData>  faces;
+    std::vector<MatDbl>      A;              ///< Cell block per comp
+    std::vector<MatDbl>      A_inv;          ///< Inverse cell block per comp
+  };
+
+private:
+  std::vector<MFCellData>        mf_cell_data;
+  Vec                            mf_x_work = nullptr;
+  VecScatter                     mf_ghost_scatter = nullptr;
+
+  int MFNumComponents() const
+  {return (fem_method == PWLD_MIP_GAGG)? G : 1;}
+  int MFMaterialGroup(int c) const
+  {return (fem_method == PWLD_MIP_GAGG)? gi + c : gi;}
+  int MFDOFComponent(int c) const
+  {return (fem_method == PWLD_MIP_GAGG)? c : gi;}
+
+public:
+  void MF_Initialize();
+  void MF_ComputeCoefficients();
+  void MF_CellMatrix(const chi_mesh::Cell& cell,
+                     const MFCellData& cell_data,
+                     int c,
+                     MatDbl& A_cell);
+  void MF_Apply(Vec x_in, Vec y_out);
+  void MF_ApplyBlockJacobi(Vec r_in, Vec z_out);
 };
 
 #endif
@@ -33,6 +33,17 @@ int chi_diffusion::Solver::ExecuteS(bool suppress_assembly,
     chi_log.Log(LOG_0) << chi_program_timer.GetTimeString() << " "
                        << solver_name << ": Assembling A locally";
 
+  //================================================== Zero a previously
+  //                                                   assembled matrix
+  // The element blocks are added to the existing nonzero structure, so
+  // re-assembly only updates values.
+  if (!suppress_assembly and !matrix_free)
+  {
+    PetscBool assembled;
+    MatAssembled(A,&assembled);
+    if (assembled) MatZeroEntries(A);
+  }
+
   //================================================== Loop over locally owned
   //                                                   cells
   if (fem_method == PWLC)
@@ -42,6 +53,18 @@ int chi_diffusion::Solver::ExecuteS(bool suppress_assembly,
         CFEM_Assemble_A_and_b(cell, gi);
     else {}
   }
+  else if (matrix_free)
+  {
+    if (!suppress_assembly)
+      MF_ComputeCoefficients();
+
+    if (fem_method == PWLD_MIP)
+      for (auto& cell : grid->local_cells)
+        PWLD_Assemble_b(cell,gi);
+    else
+      for (auto& cell : grid->local_cells)
+        PWLD_Assemble_b_GAGG(cell);
+  }
   else if (fem_method == PWLD_MIP)
   {
     if (!suppress_assembly)
@@ -71,7 +94,7 @@ int chi_diffusion::Solver::ExecuteS(bool suppress_assembly,
   if (!suppress_assembly)
     chi_log.Log(LOG_0) << chi_program_timer.GetTimeString() << " "
                        << solver_name << ": Done Assembling A locally";
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //=================================== Call matrix assembly
   if (verbose_info || chi_log.GetVerbosity() >= LOG_0VERBOSE_1)
@@ -79,7 +102,7 @@ int chi_diffusion::Solver::ExecuteS(bool suppress_assembly,
       << chi_program_timer.GetTimeString() << " "
       << solver_name << ": Communicating matrix assembly";
 
-  if (!suppress_assembly)
+  if (!suppress_assembly and !matrix_free)
   {
     chi_log.Log(LOG_0) << chi_program_timer.GetTimeString() << " "
                        << solver_name << ": Assembling A globally";
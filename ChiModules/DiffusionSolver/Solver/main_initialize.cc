@@ -17,6 +17,8 @@ DiffusionConvergenceTestNPT(KSP ksp, PetscInt n, PetscReal rnorm,
                             KSPConvergedReason* convergedReason,
                             void *monitordestroy);
 
+PetscErrorCode DiffusionMFBlockJacobiAction(PC pc, Vec r, Vec z);
+
 //###################################################################
 /**Initializes the diffusion solver using the PETSc library.*/
 int chi_diffusion::Solver::Initialize(bool verbose)
@@ -61,7 +63,7 @@ int chi_diffusion::Solver::Initialize(bool verbose)
       exit(EXIT_FAILURE);
     }
   }//switch fem_method
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
   auto& sdm = discretization;
 
   //============================================= Get DOF counts
@@ -114,12 +116,15 @@ int chi_diffusion::Solver::Initialize(bool verbose)
 
 
   //================================================== Determine nodal DOF
-  chi_log.Log(LOG_0) << "Building sparsity pattern.";
   std::vector<int64_t> nodal_nnz_in_diag;
   std::vector<int64_t> nodal_nnz_off_diag;
-  sdm->BuildSparsityPattern(nodal_nnz_in_diag,
-                            nodal_nnz_off_diag,
-                            unknown_manager);
+  if (not matrix_free)
+  {
+    chi_log.Log(LOG_0) << "Building sparsity pattern.";
+    sdm->BuildSparsityPattern(nodal_nnz_in_diag,
+                              nodal_nnz_off_diag,
+                              unknown_manager);
+  }
 
   chi_log.Log(LOG_0)
     << chi_program_timer.GetTimeString() << " "
@@ -137,18 +142,23 @@ int chi_diffusion::Solver::Initialize(bool verbose)
   VecSet(b,0.0);
 
   //################################################## Create matrix
-  ierr = MatCreate(PETSC_COMM_WORLD,&A);CHKERRQ(ierr);
-  ierr = MatSetSizes(A, local_dof_count, local_dof_count,
-                     global_dof_count, global_dof_count);CHKERRQ(ierr);
-  ierr = MatSetType(A,MATMPIAIJ);CHKERRQ(ierr);
-
-  //================================================== Allocate matrix memory
-  chi_log.Log(LOG_0) << "Setting matrix preallocation.";
-  MatMPIAIJSetPreallocation(A,0,nodal_nnz_in_diag.data(),
-                            0,nodal_nnz_off_diag.data());
-  MatSetOption(A, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);
-  MatSetOption(A, MAT_IGNORE_ZERO_ENTRIES, PETSC_TRUE);
-  MatSetUp(A);
+  if (matrix_free)
+    MF_Initialize();
+  else
+  {
+    ierr = MatCreate(PETSC_COMM_WORLD,&A);CHKERRQ(ierr);
+    ierr = MatSetSizes(A, local_dof_count, local_dof_count,
+                       global_dof_count, global_dof_count);CHKERRQ(ierr);
+    ierr = MatSetType(A,MATMPIAIJ);CHKERRQ(ierr);
+
+    //================================================ Allocate matrix memory
+    chi_log.Log(LOG_0) << "Setting matrix preallocation.";
+    MatMPIAIJSetPreallocation(A,0,nodal_nnz_in_diag.data(),
+                              0,nodal_nnz_off_diag.data());
+    MatSetOption(A, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);
+    MatSetOption(A, MAT_IGNORE_ZERO_ENTRIES, PETSC_TRUE);
+    MatSetUp(A);
+  }
 
   //================================================== Set up solver
   ierr = KSPCreate(PETSC_COMM_WORLD,&ksp);
@@ -157,61 +167,71 @@ int chi_diffusion::Solver::Initialize(bool verbose)
 
   //================================================== Set up preconditioner
   ierr = KSPGetPC(ksp,&pc);
-  PCSetType(pc,PCHYPRE);
+  if (matrix_free)
+  {
+    PCSetType(pc,PCSHELL);
+    PCShellSetContext(pc,this);
+    PCShellSetApply(pc,DiffusionMFBlockJacobiAction);
+    PCShellSetName(pc,"MIP-CellBlockJacobi");
+  }
+  else
+  {
+    PCSetType(pc,PCHYPRE);
 
-  PCHYPRESetType(pc,"boomeramg");
+    PCHYPRESetType(pc,"boomeramg");
 
-  //================================================== Setting Hypre parameters
-  //The default HYPRE parameters used for polyhedra
-  //seemed to have caused a lot of trouble for Slab
-  //geometries. This section makes some custom options
-  //per cell type
-  auto first_cell = &grid->local_cells[0];
+    //================================================ Setting Hypre parameters
+    //The default HYPRE parameters used for polyhedra
+    //seemed to have caused a lot of trouble for Slab
+    //geometries. This section makes some custom options
+    //per cell type
+    auto first_cell = &grid->local_cells[0];
 
-  if (first_cell->Type() == chi_mesh::CellType::SLAB)
-  {
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_agg_nl 1");
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_P_max 4");
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_grid_sweeps_coarse 1");
+    if (first_cell->Type() == chi_mesh::CellType::SLAB)
+    {
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_agg_nl 1");
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_P_max 4");
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_grid_sweeps_coarse 1");
 
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_grid_sweeps_coarse 1");
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_max_levels 25");
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_relax_type_all symmetric-SOR/Jacobi");
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_coarsen_type HMIS");
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_interp_type ext+i");
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_grid_sweeps_coarse 1");
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_max_levels 25");
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_relax_type_all symmetric-SOR/Jacobi");
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_coarsen_type HMIS");
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_interp_type ext+i");
 
-    PetscOptionsInsertString(NULL,"-options_left");
-  }
-  if (first_cell->Type() == chi_mesh::CellType::POLYGON)
-  {
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_strong_threshold 0.6");
+      PetscOptionsInsertString(NULL,"-options_left");
+    }
+    if (first_cell->Type() == chi_mesh::CellType::POLYGON)
+    {
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_strong_threshold 0.6");
 
-    //PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_agg_nl 1");
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_P_max 4");
+      //PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_agg_nl 1");
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_P_max 4");
 
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_grid_sweeps_coarse 1");
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_max_levels 25");
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_relax_type_all symmetric-SOR/Jacobi");
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_coarsen_type HMIS");
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_interp_type ext+i");
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_grid_sweeps_coarse 1");
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_max_levels 25");
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_relax_type_all symmetric-SOR/Jacobi");
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_coarsen_type HMIS");
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_interp_type ext+i");
 
-    PetscOptionsInsertString(NULL,"-options_left");
-  }
-  if (first_cell->Type() == chi_mesh::CellType::POLYHEDRON)
-  {
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_strong_threshold 0.8");
+      PetscOptionsInsertString(NULL,"-options_left");
+    }
+    if (first_cell->Type() == chi_mesh::CellType::POLYHEDRON)
+    {
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_strong_threshold 0.8");
 
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_agg_nl 1");
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_P_max 4");
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_agg_nl 1");
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_P_max 4");
 
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_grid_sweeps_coarse 1");
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_max_levels 25");
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_relax_type_all symmetric-SOR/Jacobi");
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_coarsen_type HMIS");
-    PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_interp_type ext+i");
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_grid_sweeps_coarse 1");
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_max_levels 25");
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_relax_type_all symmetric-SOR/Jacobi");
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_coarsen_type HMIS");
+      PetscOptionsInsertString(NULL,"-pc_hypre_boomeramg_interp_type ext+i");
+    }
+    PetscOptionsInsertString(NULL,options_string.c_str());
+    PCSetFromOptions(pc);
   }
-  PetscOptionsInsertString(NULL,options_string.c_str());
-  PCSetFromOptions(pc);
 
   //=================================== Set up monitor
   if (verbose)
@@ -0,0 +1,602 @@
+#include "diffusion_solver.h"
+
+#include "chi_log.h"
+extern ChiLog& chi_log;
+
+#include "chi_mpi.h"
+extern ChiMPI& chi_mpi;
+
+#include <map>
+
+//###################################################################
+/**PETSc shell matrix action of the matrix-free MIP operator.*/
+PetscErrorCode DiffusionMFMatrixAction(Mat matrix, Vec x, Vec y)
+{
+  chi_diffusion::Solver* solver;
+  MatShellGetContext(matrix,&solver);
+
+  solver->MF_Apply(x,y);
+
+  return 0;
+}
+
+//###################################################################
+/**PETSc shell preconditioner action of the matrix-free MIP operator.*/
+PetscErrorCode DiffusionMFBlockJacobiAction(PC pc, Vec r, Vec z)
+{
+  chi_diffusion::Solver* solver;
+  PCShellGetContext(pc,(void**)&solver);
+
+  solver->MF_ApplyBlockJacobi(r,z);
+
+  return 0;
+}
+
+//###################################################################
+/**Initializes the geometric data of the matrix-free MIP operator, the
+ * scatter of ghost dofs and the shell matrix and preconditioner.
+ *
+ * The operator computes each row of the MIP matrix of PWLD_MIP and
+ * PWLD_MIP_GAGG from the diagonal cell blocks and the couplings to the
+ * neighbors. The diagonal cell blocks are stored per component, together
+ * with their inverses that are used as a block-Jacobi preconditioner.
+ * The couplings to the neighbors are applied from face integrals that are
+ * stored once for all components, scaled with the material coefficients
+ * and face penalty factors of each component. The off-diagonal blocks,
+ * i.e. most of the assembled matrix for PWLD_MIP_GAGG, are not stored.*/
+void chi_diffusion::Solver::MF_Initialize()
+{
+  if (not (fem_method == PWLD_MIP or fem_method == PWLD_MIP_GAGG))
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << solver_name << ": The matrix-free operator is only available "
+      << "for the PWLD_MIP and PWLD_MIP_GAGG methods.";
+    exit(EXIT_FAILURE);
+  }
+
+  auto pwl_sdm = std::static_pointer_cast<SpatialDiscretization_PWLD>(this->discretization);
+  const int num_comps = MFNumComponents();
+
+  PetscInt local_begin, local_end;
+  VecGetOwnershipRange(x,&local_begin,&local_end);
+
+  //================================================== Map global dofs to
+  //                                                   work vector indices
+  std::map<int64_t,int64_t> ghost_map;
+  std::vector<PetscInt>     ghost_ids;
+  auto WorkIndex = [local_begin,local_end,&ghost_map,&ghost_ids](int64_t dof)
+    -> int64_t
+  {
+    if (dof >= local_begin and dof < local_end)
+      return dof - local_begin;
+
+    auto ghost = ghost_map.find(dof);
+    if (ghost != ghost_map.end())
+      return ghost->second;
+
+    int64_t index = (local_end - local_begin) +
+                    static_cast<int64_t>(ghost_ids.size());
+    ghost_map.insert(std::make_pair(dof,index));
+    ghost_ids.push_back(dof);
+    return index;
+  };
+
+  //================================================== Cell and face data
+  mf_cell_data.clear();
+  mf_cell_data.resize(grid->local_cells.size());
+  for (const auto& cell : grid->local_cells)
+  {
+    auto& cell_data = mf_cell_data[cell.local_id];
+    const int num_nodes = static_cast<int>(cell.vertex_ids.size());
+
+    cell_data.dofs.resize(num_comps*num_nodes);
+    for (int c=0; c<num_comps; c++)
+      for (int i=0; i<num_nodes; i++)
+        cell_data.dofs[c*num_nodes + i] = WorkIndex(
+          pwl_sdm->MapDOF(cell, i, unknown_manager, 0, MFDOFComponent(c)));
+
+    cell_data.faces.resize(cell.faces.size());
+    for (unsigned int f=0; f<cell.faces.size(); f++)
+    {
+      const auto& face = cell.faces[f];
+      auto& face_data = cell_data.faces[f];
+      const int num_face_dofs = static_cast<int>(face.vertex_ids.size());
+
+      {
+        const auto& fe_intgrl_values = pwl_sdm->GetUnitIntegrals(cell);
+        const int num_nodes_i = static_cast<int>(fe_intgrl_values.NumNodes());
+        face_data.hm = HPerpendicular(cell, fe_intgrl_values, f);
+
+        //The penalty and own gradient terms of the neighbor couplings
+        if (face.has_neighbor)
+        {
+          face_data.cell_node_of_face_node.resize(num_face_dofs);
+          face_data.IntS_shapeI_shapeJ.assign(
+            num_face_dofs, VecDbl(num_face_dofs, 0.0));
+          face_data.n_IntS_shapeI_gradshapeJ.assign(
+            num_face_dofs, VecDbl(num_nodes_i, 0.0));
+          for (int fj=0; fj<num_face_dofs; fj++)
+          {
+            int j = fe_intgrl_values.FaceDofMapping(f,fj);
+            face_data.cell_node_of_face_node[fj] = j;
+
+            for (int fi=0; fi<num_face_dofs; fi++)
+            {
+              int i = fe_intgrl_values.FaceDofMapping(f,fi);
+              face_data.IntS_shapeI_shapeJ[fi][fj] =
+                fe_intgrl_values.IntS_shapeI_shapeJ(f, i, j);
+            }
+
+            for (int i=0; i<num_nodes_i; i++)
+              face_data.n_IntS_shapeI_gradshapeJ[fj][i] =
+                face.normal.Dot(fe_intgrl_values.IntS_shapeI_gradshapeJ(f, j, i));
+          }
+        }
+      }
+
+      if (face.has_neighbor)
+      {
+        face_data.type = MFFaceData::INTERIOR;
+
+        const auto& adj_cell = pwl_sdm->GetNeighborCell(face.neighbor_id);
+        const auto& adj_fe_intgrl_values = pwl_sdm->GetUnitIntegrals(adj_cell);
+        const int num_adj_nodes = static_cast<int>(adj_cell.vertex_ids.size());
+
+        unsigned int fmap = MapCellFace(cell,adj_cell,f);
+        const auto& adj_face = adj_cell.faces[fmap];
+        face_data.hp = HPerpendicular(adj_cell, adj_fe_intgrl_values, fmap);
+
+        face_data.adj_dofs.resize(num_comps*num_adj_nodes);
+        for (int c=0; c<num_comps; c++)
+          for (int j=0; j<num_adj_nodes; j++)
+            face_data.adj_dofs[c*num_adj_nodes + j] = WorkIndex(
+              pwl_sdm->MapDOF(adj_cell, j, unknown_manager, 0, MFDOFComponent(c)));
+
+        face_data.adj_node_of_face_node.resize(num_face_dofs);
+        for (int fj=0; fj<num_face_dofs; fj++)
+          face_data.adj_node_of_face_node[fj] = static_cast<int>(
+            MapCellLocalNodeIDFromGlobalID(adj_cell, face.vertex_ids[fj]));
+
+        //The neighbor's gradient term couples its face nodes, which are
+        //rows of this cell, to all of its nodes
+        const int num_adj_face_dofs = static_cast<int>(adj_face.vertex_ids.size());
+        face_data.cell_node_of_adj_face_node.resize(num_adj_face_dofs);
+        face_data.adj_n_IntS_shapeI_gradshapeJ.assign(
+          num_adj_face_dofs, VecDbl(num_adj_nodes, 0.0));
+        for (int fi=0; fi<num_adj_face_dofs; fi++)
+        {
+          int i = adj_fe_intgrl_values.FaceDofMapping(fmap,fi);
+          face_data.cell_node_of_adj_face_node[fi] = static_cast<int>(
+            MapCellLocalNodeIDFromGlobalID(cell, adj_face.vertex_ids[fi]));
+
+          for (int j=0; j<num_adj_nodes; j++)
+            face_data.adj_n_IntS_shapeI_gradshapeJ[fi][j] =
+              adj_face.normal.Dot(
+                adj_fe_intgrl_values.IntS_shapeI_gradshapeJ(fmap, i, j));
+        }
+      }
+      else
+      {
+        auto boundary_type = boundaries[face.neighbor_id]->type;
+        if (boundary_type == BoundaryType::Dirichlet)
+        {
+          face_data.type = MFFaceData::DIRICHLET;
+
+          auto dc_boundary =
+            (chi_diffusion::BoundaryDirichlet*)boundaries[face.neighbor_id];
+          if (std::fabs(dc_boundary->boundary_value) > 0.0)
+          {
+            chi_log.Log(LOG_ALLERROR)
+              << solver_name << ": The matrix-free operator only supports "
+              << "homogeneous Dirichlet boundaries.";
+            exit(EXIT_FAILURE);
+          }
+        }
+        else if (boundary_type == BoundaryType::Robin)
+          face_data.type = MFFaceData::ROBIN;
+      }
+    }//for f
+  }//for cell
+
+  //================================================== Ghost scatter
+  const int64_t num_local = local_end - local_begin;
+  const int64_t num_work  = num_local + static_cast<int64_t>(ghost_ids.size());
+
+  std::vector<PetscInt> global_indices(num_work);
+  std::vector<PetscInt> work_indices(num_work);
+  for (int64_t k=0; k<num_work; k++)
+  {
+    global_indices[k] = (k < num_local)? local_begin + k :
+                                         ghost_ids[k - num_local];
+    work_indices[k] = k;
+  }
+
+  VecCreateSeq(PETSC_COMM_SELF,num_work,&mf_x_work);
+
+  IS global_set;
+  IS work_set;
+  ISCreateGeneral(PETSC_COMM_SELF, num_work, global_indices.data(),
+                  PETSC_COPY_VALUES,&global_set);
+  ISCreateGeneral(PETSC_COMM_SELF, num_work, work_indices.data(),
+                  PETSC_COPY_VALUES,&work_set);
+  VecScatterCreate(x,global_set,mf_x_work,work_set,&mf_ghost_scatter);
+  ISDestroy(&global_set);
+  ISDestroy(&work_set);
+
+  //================================================== Shell matrix
+  MatCreateShell(PETSC_COMM_WORLD,local_dof_count,local_dof_count,
+                                  global_dof_count,global_dof_count,
+                                  this,&A);
+  MatShellSetOperation(A, MATOP_MULT, (void (*)()) DiffusionMFMatrixAction);
+
+  int64_t num_ghosts = static_cast<int64_t>(ghost_ids.size());
+  int64_t total_num_ghosts = 0;
+  int64_t max_num_ghosts = 0;
+  MPI_Allreduce(&num_ghosts, &total_num_ghosts, 1, MPI_INT64_T,
+                MPI_SUM, chi_mpi.comm);
+  MPI_Allreduce(&num_ghosts, &max_num_ghosts, 1, MPI_INT64_T,
+                MPI_MAX, chi_mpi.comm);
+
+  chi_log.Log(LOG_0)
+    << solver_name << ": Matrix-free operator initialized with "
+    << total_num_ghosts << " ghost dofs in total, at most "
+    << max_num_ghosts << " on a location.";
+}
+
+//###################################################################
+/**Computes the material coefficients and face penalty factors of the
+ * matrix-free MIP operator, as well as the diagonal cell blocks and their
+ * inverses. Must be called whenever the materials change.*/
+void chi_diffusion::Solver::MF_ComputeCoefficients()
+{
+  auto pwl_sdm = std::static_pointer_cast<SpatialDiscretization_PWLD>(this->discretization);
+  const int num_comps = MFNumComponents();
+
+  for (const auto& cell : grid->local_cells)
+  {
+    auto& cell_data = mf_cell_data[cell.local_id];
+    const int num_nodes = static_cast<int>(cell.vertex_ids.size());
+
+    cell_data.D.assign(num_comps*num_nodes, 1.0);
+    cell_data.siga.assign(num_comps*num_nodes, 0.0);
+
+    for (int c=0; c<num_comps; c++)
+    {
+      std::vector<double> D(num_nodes, 1.0);
+      std::vector<double> q(num_nodes, 1.0);
+      std::vector<double> siga(num_nodes, 0.0);
+
+      GetMaterialProperties(cell, num_nodes, D, q, siga, MFMaterialGroup(c));
+
+      for (int i=0; i<num_nodes; i++)
+      {
+        cell_data.D   [c*num_nodes + i] = D[i];
+        cell_data.siga[c*num_nodes + i] = siga[i];
+      }
+    }
+
+    //=========================================== Face factors
+    for (unsigned int f=0; f<cell.faces.size(); f++)
+    {
+      const auto& face = cell.faces[f];
+      auto& face_data = cell_data.faces[f];
+      const int num_face_dofs = static_cast<int>(face.vertex_ids.size());
+
+      if (face_data.type != MFFaceData::INTERIOR and
+          face_data.type != MFFaceData::DIRICHLET) continue;
+
+      face_data.kappa.assign(num_comps, 1.0);
+      face_data.D_avg.assign(num_comps, 0.0);
+      face_data.adj_D_avg.assign(num_comps, 0.0);
+
+      for (int c=0; c<num_comps; c++)
+      {
+        //==================== Compute surface average D
+        //Pinned, since the neighbor's integrals are obtained as well
+        const auto fe_intgrl_ptr = pwl_sdm->PinUnitIntegrals(cell);
+        const auto& fe_intgrl_values = *fe_intgrl_ptr;
+        double D_avg = 0.0;
+        double intS = 0.0;
+        for (int fi=0; fi<num_face_dofs; fi++)
+        {
+          int i = fe_intgrl_values.FaceDofMapping(f,fi);
+          D_avg += cell_data.D[c*num_nodes + i]* fe_intgrl_values.IntS_shapeI(f, i);
+          intS += fe_intgrl_values.IntS_shapeI(f, i);
+        }
+        D_avg /= intS;
+        face_data.D_avg[c] = D_avg;
+
+        double kappa = 1.0;
+        if (face_data.type == MFFaceData::INTERIOR)
+        {
+          const auto& adj_cell = pwl_sdm->GetNeighborCell(face.neighbor_id);
+          const auto adj_fe_intgrl_ptr = pwl_sdm->PinUnitIntegrals(adj_cell);
+          const auto& adj_fe_intgrl_values = *adj_fe_intgrl_ptr;
+          unsigned int fmap = MapCellFace(cell,adj_cell,f);
+
+          std::vector<double> adj_D,adj_Q,adj_sigma;
+          GetMaterialProperties(adj_cell,
+                                adj_fe_intgrl_values.NumNodes(),
+                                adj_D,
+                                adj_Q,
+                                adj_sigma,
+                                MFMaterialGroup(c));
+
+          //============= Compute surface average D_adj
+          double adj_D_avg = 0.0;
+          double adj_intS = 0.0;
+          for (int fi=0; fi<num_face_dofs; fi++)
+          {
+            int imap = face_data.adj_node_of_face_node[fi];
+            adj_D_avg += adj_D[imap]* adj_fe_intgrl_values.IntS_shapeI(fmap, imap);
+            adj_intS += adj_fe_intgrl_values.IntS_shapeI(fmap, imap);
+          }
+          adj_D_avg /= adj_intS;
+          face_data.adj_D_avg[c] = adj_D_avg;
+
+          const double hp = face_data.hp;
+          const double hm = face_data.hm;
+          if (cell.Type() == chi_mesh::CellType::SLAB)
+            kappa = fmax(2.0*(adj_D_avg/hp + D_avg/hm),0.25);
+          if (cell.Type() == chi_mesh::CellType::POLYGON)
+            kappa = fmax(2.0*(adj_D_avg/hp + D_avg/hm),0.25);
+          if (cell.Type() == chi_mesh::CellType::POLYHEDRON)
+            kappa = fmax(4.0*(adj_D_avg/hp + D_avg/hm),0.25);
+        }
+        else
+        {
+          const double hm = face_data.hm;
+          if (cell.Type() == chi_mesh::CellType::SLAB)
+            kappa = fmax(4.0*(D_avg/hm),0.25);
+          if (cell.Type() == chi_mesh::CellType::POLYGON)
+            kappa = fmax(4.0*(D_avg/hm),0.25);
+          if (cell.Type() == chi_mesh::CellType::POLYHEDRON)
+            kappa = fmax(8.0*(D_avg/hm),0.25);
+        }
+        face_data.kappa[c] = kappa;
+      }//for c
+    }//for f
+
+    //=========================================== Cell blocks and their
+    //                                            block-Jacobi inverses
+    cell_data.A.resize(num_comps);
+    cell_data.A_inv.resize(num_comps);
+    for (int c=0; c<num_comps; c++)
+    {
+      MF_CellMatrix(cell, cell_data, c, cell_data.A[c]);
+      cell_data.A_inv[c] = chi_math::Inverse(cell_data.A[c]);
+    }
+  }//for cell
+}
+
+//###################################################################
+/**Computes the diagonal block of a cell, i.e. the coupling of the
+ * cell's dofs amongst themselves, for a component of the matrix-free
+ * MIP operator.*/
+void chi_diffusion::Solver::MF_CellMatrix(const chi_mesh::Cell& cell,
+                                          const MFCellData& cell_data,
+                                          int c,
+                                          MatDbl& A_cell)
+{
+  auto pwl_sdm = std::static_pointer_cast<SpatialDiscretization_PWLD>(this->discretization);
+  const auto fe_intgrl_ptr = pwl_sdm->PinUnitIntegrals(cell);
+  const auto& fe_intgrl_values = *fe_intgrl_ptr;
+  const int num_nodes = static_cast<int>(fe_intgrl_values.NumNodes());
+  const double* D    = &cell_data.D   [c*num_nodes];
+  const double* siga = &cell_data.siga[c*num_nodes];
+
+  A_cell.assign(num_nodes, VecDbl(num_nodes, 0.0));
+
+  //========================================= Volume terms
+  for (int i=0; i<num_nodes; i++)
+    for (int j=0; j<num_nodes; j++)
+      A_cell[i][j] = D[j]* fe_intgrl_values.IntV_gradShapeI_gradShapeJ(i, j) +
+                     siga[j]* fe_intgrl_values.IntV_shapeI_shapeJ(i, j);
+
+  //========================================= Face terms
+  for (unsigned int f=0; f<cell.faces.size(); f++)
+  {
+    const auto& face = cell.faces[f];
+    const auto& face_data = cell_data.faces[f];
+    const chi_mesh::Vector3& n = face.normal;
+    const int num_face_dofs = static_cast<int>(face.vertex_ids.size());
+
+    if (face_data.type == MFFaceData::INTERIOR)
+    {
+      const double kappa = face_data.kappa[c];
+      const double D_avg = face_data.D_avg[c];
+
+      for (int fi=0; fi<num_face_dofs; fi++)
+      {
+        int i = fe_intgrl_values.FaceDofMapping(f,fi);
+        for (int fj=0; fj<num_face_dofs; fj++)
+        {
+          int j = fe_intgrl_values.FaceDofMapping(f,fj);
+          A_cell[i][j] += kappa* fe_intgrl_values.IntS_shapeI_shapeJ(f, i, j);
+        }
+      }
+
+      for (int fj=0; fj<num_face_dofs; fj++)
+      {
+        int j = fe_intgrl_values.FaceDofMapping(f,fj);
+        for (int i=0; i<num_nodes; i++)
+        {
+          A_cell[i][j] +=
+            -0.5*D_avg*n.Dot(fe_intgrl_values.IntS_shapeI_gradshapeJ(f, j, i));
+          A_cell[j][i] +=
+            -0.5*D_avg*n.Dot(fe_intgrl_values.IntS_shapeI_gradshapeJ(f, j, i));
+        }
+      }
+    }
+    else if (face_data.type == MFFaceData::DIRICHLET)
+    {
+      const double kappa = face_data.kappa[c];
+      const double D_avg = face_data.D_avg[c];
+
+      for (int fi=0; fi<num_face_dofs; fi++)
+      {
+        int i = fe_intgrl_values.FaceDofMapping(f,fi);
+        for (int fj=0; fj<num_face_dofs; fj++)
+        {
+          int j = fe_intgrl_values.FaceDofMapping(f,fj);
+          A_cell[i][j] += kappa* fe_intgrl_values.IntS_shapeI_shapeJ(f, i, j);
+        }
+      }
+
+      for (int i=0; i<num_nodes; i++)
+        for (int j=0; j<num_nodes; j++)
+        {
+          double gij =
+            n.Dot(fe_intgrl_values.IntS_shapeI_gradshapeJ(f, i, j) +
+                  fe_intgrl_values.IntS_shapeI_gradshapeJ(f, j, i));
+          A_cell[i][j] += -0.5*D_avg*gij;
+        }
+    }
+    else if (face_data.type == MFFaceData::ROBIN)
+    {
+      auto robin_bndry =
+        (chi_diffusion::BoundaryRobin*)boundaries[face.neighbor_id];
+
+      for (int fi=0; fi<num_face_dofs; fi++)
+      {
+        int i = fe_intgrl_values.FaceDofMapping(f,fi);
+        for (int fj=0; fj<num_face_dofs; fj++)
+        {
+          int j = fe_intgrl_values.FaceDofMapping(f,fj);
+          A_cell[i][j] += robin_bndry->a*
+                          fe_intgrl_values.IntS_shapeI_shapeJ(f, i, j)/
+                          robin_bndry->b;
+        }
+        A_cell[i][i] += robin_bndry->f*
+                        fe_intgrl_values.IntS_shapeI(f, i)/robin_bndry->b;
+      }
+    }
+  }//for f
+}
+
+//###################################################################
+/**Applies the matrix-free MIP operator, y = A x. Each location computes
+ * only its own rows, for which it needs the values of x on the
+ * neighbors of its cells. These are scattered into the work vector
+ * beforehand. Only the stored cell blocks and face integrals are used,
+ * the unit integrals are not accessed.*/
+void chi_diffusion::Solver::MF_Apply(Vec x_in, Vec y_out)
+{
+  const int num_comps = MFNumComponents();
+
+  VecScatterBegin(mf_ghost_scatter,x_in,mf_x_work,INSERT_VALUES,SCATTER_FORWARD);
+  VecScatterEnd  (mf_ghost_scatter,x_in,mf_x_work,INSERT_VALUES,SCATTER_FORWARD);
+
+  const double* x_work;
+  double* y;
+  VecGetArrayRead(mf_x_work,&x_work);
+  VecGetArray(y_out,&y);
+
+  VecDbl x_cell, y_cell, x_adj;
+  for (const auto& cell : grid->local_cells)
+  {
+    const auto& cell_data = mf_cell_data[cell.local_id];
+    const int num_nodes = static_cast<int>(cell.vertex_ids.size());
+
+    for (int c=0; c<num_comps; c++)
+    {
+      //==================================== Cell block
+      const auto& A_cell = cell_data.A[c];
+
+      x_cell.assign(num_nodes, 0.0);
+      y_cell.assign(num_nodes, 0.0);
+      for (int i=0; i<num_nodes; i++)
+        x_cell[i] = x_work[cell_data.dofs[c*num_nodes + i]];
+
+      for (int i=0; i<num_nodes; i++)
+        for (int j=0; j<num_nodes; j++)
+          y_cell[i] += A_cell[i][j]*x_cell[j];
+
+      //==================================== Neighbor couplings
+      for (const auto& face_data : cell_data.faces)
+      {
+        if (face_data.type != MFFaceData::INTERIOR) continue;
+
+        const int num_face_dofs =
+          static_cast<int>(face_data.cell_node_of_face_node.size());
+        const double kappa     = face_data.kappa[c];
+        const double D_avg     = face_data.D_avg[c];
+        const double adj_D_avg = face_data.adj_D_avg[c];
+
+        const auto& adj_grad = face_data.adj_n_IntS_shapeI_gradshapeJ;
+        const size_t num_adj_nodes = face_data.adj_dofs.size()/num_comps;
+        x_adj.assign(num_adj_nodes, 0.0);
+        for (size_t j=0; j<num_adj_nodes; j++)
+          x_adj[j] = x_work[face_data.adj_dofs[c*num_adj_nodes + j]];
+
+        //Penalty and own gradient terms
+        for (int fj=0; fj<num_face_dofs; fj++)
+        {
+          double x_adj_j = x_adj[face_data.adj_node_of_face_node[fj]];
+
+          for (int fi=0; fi<num_face_dofs; fi++)
+          {
+            int i = face_data.cell_node_of_face_node[fi];
+            y_cell[i] -= kappa*face_data.IntS_shapeI_shapeJ[fi][fj]*x_adj_j;
+          }
+
+          const auto& own_grad = face_data.n_IntS_shapeI_gradshapeJ[fj];
+          for (int i=0; i<num_nodes; i++)
+            y_cell[i] += 0.5*D_avg*own_grad[i]*x_adj_j;
+        }
+
+        //Neighbor gradient terms
+        for (size_t fi=0; fi<adj_grad.size(); fi++)
+        {
+          int i = face_data.cell_node_of_adj_face_node[fi];
+          double aij_x = 0.0;
+          for (size_t j=0; j<num_adj_nodes; j++)
+            aij_x += adj_grad[fi][j]*x_adj[j];
+          y_cell[i] += 0.5*adj_D_avg*aij_x;
+        }
+      }//for face
+
+      for (int i=0; i<num_nodes; i++)
+        y[cell_data.dofs[c*num_nodes + i]] = y_cell[i];
+    }//for c
+  }//for cell
+
+  VecRestoreArrayRead(mf_x_work,&x_work);
+  VecRestoreArray(y_out,&y);
+}
+
+//###################################################################
+/**Applies the cell block-Jacobi preconditioner of the matrix-free MIP
+ * operator, z = D^{-1} r, with D the diagonal cell blocks.*/
+void chi_diffusion::Solver::MF_ApplyBlockJacobi(Vec r_in, Vec z_out)
+{
+  const int num_comps = MFNumComponents();
+
+  const double* r;
+  double* z;
+  VecGetArrayRead(r_in,&r);
+  VecGetArray(z_out,&z);
+
+  for (const auto& cell : grid->local_cells)
+  {
+    const auto& cell_data = mf_cell_data[cell.local_id];
+    const int num_nodes = static_cast<int>(cell.vertex_ids.size());
+
+    for (int c=0; c<num_comps; c++)
+    {
+      const auto& A_inv = cell_data.A_inv[c];
+      const int64_t* dofs = &cell_data.dofs[c*num_nodes];
+
+      for (int i=0; i<num_nodes; i++)
+      {
+        double value = 0.0;
+        for (int j=0; j<num_nodes; j++)
+          value += A_inv[i][j]*r[dofs[j]];
+        z[dofs[i]] = value;
+      }
+    }
+  }
+
+  VecRestoreArrayRead(r_in,&r);
+  VecRestoreArray(z_out,&z);
+}
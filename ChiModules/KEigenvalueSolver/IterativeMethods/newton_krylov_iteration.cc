@@ -0,0 +1,300 @@
+#include "../k_eigenvalue_solver.h"
+
+#include "ChiMesh/SweepUtilities/SweepScheduler/sweepscheduler.h"
+#include "ChiMath/PETScUtils/petsc_utils.h"
+
+#include <petscsnes.h>
+
+#include "chi_log.h"
+
+extern ChiLog& chi_log;
+
+#include "chi_mpi.h"
+
+extern ChiMPI& chi_mpi;
+
+#include "ChiTimer/chi_timer.h"
+
+extern ChiTimer chi_program_timer;
+
+namespace sweep_namespace = chi_mesh::sweep_management;
+typedef sweep_namespace::SweepChunk SweepChunk;
+typedef sweep_namespace::SweepScheduler MainSweepScheduler;
+typedef sweep_namespace::SchedulingAlgorithm SchedulingAlgorithm;
+
+using namespace LinearBoltzmann;
+
+#include <iomanip>
+
+namespace
+{
+/**Data available to the JFNK residual evaluation.*/
+struct KEigenNewtonContext
+{
+  KEigenvalue::Solver* solver;
+  std::vector<MainSweepScheduler*> sweep_schedulers;
+};
+
+//###################################################################
+/**Applies the transport operator to the flux moments in phi_old_local,
+ * i.e. a single sweep of each groupset with the scattering source and
+ * the fission source divided by k. The result is placed in
+ * phi_new_local. Since phi_old_local is not updated between the
+ * groupsets this is a function of (phi, k), apart from the delayed
+ * angular fluxes of cyclic dependencies, which lag from the previous
+ * evaluation as they do between power iterations.*/
+void KEigenNewtonSweep(KEigenNewtonContext& context, double k)
+{
+  auto& solver = *context.solver;
+
+  solver.phi_new_local.assign(solver.phi_new_local.size(), 0.0);
+  for (size_t gs=0; gs<solver.group_sets.size(); ++gs)
+  {
+    auto& groupset = solver.group_sets[gs];
+    auto& sweep_scheduler = *context.sweep_schedulers[gs];
+
+    solver.q_moments_local.assign(solver.q_moments_local.size(), 0.0);
+    solver.SetSource(groupset, solver.q_moments_local,
+                     APPLY_WGS_SCATTER_SOURCE | APPLY_AGS_SCATTER_SOURCE);
+    solver.AddFissionSource(groupset, solver.q_moments_local,
+                            solver.phi_old_local, 1.0/k,
+                            APPLY_WGS_FISSION_SOURCE | APPLY_AGS_FISSION_SOURCE);
+
+    groupset.ZeroAngularFluxDataStructures();
+    sweep_scheduler.Sweep();
+    solver.AllreduceReplicaFluxMoments(groupset, solver.phi_new_local);
+  }
+}
+
+//###################################################################
+/**Evaluates the residual of the nonlinear k-eigenvalue system
+ * \f[
+ *   r = \begin{bmatrix} \phi - T(\phi,k) \\ 1 - P(\phi) \end{bmatrix}
+ * \f]
+ * where T is the sweep based transport operator and P the fission
+ * production. The eigenvalue is the last entry of location 0.*/
+PetscErrorCode KEigenNewtonResidual(SNES, Vec x, Vec r, void* ctx)
+{
+  auto& context = *(KEigenNewtonContext*)ctx;
+  auto& solver = *context.solver;
+
+  const size_t num_phi = solver.phi_old_local.size();
+
+  //============================================= Unpack phi and k
+  double k = 0.0;
+  const double* x_raw;
+  VecGetArrayRead(x, &x_raw);
+  std::copy(x_raw, x_raw + num_phi, solver.phi_old_local.begin());
+  if (chi_mpi.location_id == 0) k = x_raw[num_phi];
+  VecRestoreArrayRead(x, &x_raw);
+
+  MPI_Bcast(&k, 1, MPI_DOUBLE, 0, chi_mpi.comm);
+
+  //============================================= Apply operator
+  KEigenNewtonSweep(context, k);
+  const double production = solver.ComputeProduction(solver.phi_old_local);
+
+  //============================================= Pack residual
+  double* r_raw;
+  VecGetArray(r, &r_raw);
+  for (size_t i=0; i<num_phi; ++i)
+    r_raw[i] = solver.phi_old_local[i] - solver.phi_new_local[i];
+  if (chi_mpi.location_id == 0) r_raw[num_phi] = 1.0 - production;
+  VecRestoreArray(r, &r_raw);
+
+  return 0;
+}
+
+//###################################################################
+/**Prints the Newton iteration information.*/
+PetscErrorCode KEigenNewtonMonitor(SNES snes, PetscInt it,
+                                   PetscReal fnorm, void* ctx)
+{
+  auto& context = *(KEigenNewtonContext*)ctx;
+  const size_t num_phi = context.solver->phi_old_local.size();
+
+  Vec x;
+  SNESGetSolution(snes, &x);
+
+  double k = 0.0;
+  const double* x_raw;
+  VecGetArrayRead(x, &x_raw);
+  if (chi_mpi.location_id == 0) k = x_raw[num_phi];
+  VecRestoreArrayRead(x, &x_raw);
+
+  if (context.solver->options.verbose_outer_iterations)
+    chi_log.Log(LOG_0)
+      << chi_program_timer.GetTimeString() << " "
+      << "  Newton iteration " << std::setw(5) << it
+      << "  k_eff " << std::setw(10) << k
+      << "  Residual norm " << std::setw(10) << fnorm;
+
+  return 0;
+}
+}//namespace
+
+//###################################################################
+/**Jacobian-free Newton-Krylov solution of the k-eigenvalue problem.
+ *
+ * The flux moments of all groupsets and k_eff are solved simultaneously
+ * from the nonlinear system evaluated by KEigenNewtonResidual, with the
+ * flux normalized to unit fission production. PETSc's SNES performs the
+ * Newton iterations, where the Jacobian-vector products are
+ * approximated with finite differences of the residual (one sweep per
+ * groupset each) and the linear systems are solved inexactly with GMRES
+ * using Eisenstat-Walker forcing terms.
+ *
+ * jfnk_num_initial_power_iterations unaccelerated power iterations
+ * provide the initial guess, unless a flux initial guess is available
+ * from angular continuation. The Krylov solver is preconditioned with a
+ * PC of type jfnk_pc_type. The options prefix of the solver is "keigen_",
+ * PETSc options override these settings.*/
+void KEigenvalue::Solver::NewtonKrylovIteration()
+{
+  chi_log.Log(LOG_0)
+      << "\n\n********** Solving k-eigenvalue problem with "
+      << "Jacobian-free Newton-Krylov.\n\n";
+
+  if (use_inexact_inners)
+    chi_log.Log(LOG_0WARNING)
+      << "JFNK does not converge inner iterations, the accuracy of the "
+      << "linear solves is set by the Eisenstat-Walker forcing terms. "
+      << "Inexact inner tolerances will be ignored.";
+
+  //======================================== Setup sweep chunks
+  std::vector<std::shared_ptr<SweepChunk>> sweep_chunks;
+  std::vector<std::unique_ptr<MainSweepScheduler>> sweep_schedulers;
+  KEigenNewtonContext context;
+  context.solver = this;
+  for (auto& groupset : group_sets)
+  {
+    groupset.angle_agg.ZeroIncomingDelayedPsi();
+
+    sweep_chunks.push_back(SetSweepChunk(groupset));
+    sweep_schedulers.push_back(std::make_unique<MainSweepScheduler>(
+      SchedulingAlgorithm::DEPTH_OF_GRAPH,
+      groupset.angle_agg,
+      *sweep_chunks.back()));
+    sweep_schedulers.back()->sweep_chunk.SetDestinationPhi(phi_new_local);
+    sweep_schedulers.back()->sweep_chunk.SetSurfaceSourceActiveFlag(false);
+    context.sweep_schedulers.push_back(sweep_schedulers.back().get());
+  }
+
+  //======================================== Initial guess
+  if (use_flux_initial_guess)
+    phi_old_local = phi_prev_local;
+  else
+    phi_old_local.assign(phi_old_local.size(), 1.0);
+  double F_prev = ComputeProduction(phi_old_local);
+  const int num_its = use_flux_initial_guess ?
+                      0 : jfnk_num_initial_power_iterations;
+  for (int it=0; it<num_its; ++it)
+  {
+    KEigenNewtonSweep(context, k_eff);
+    double F_new = ComputeProduction(phi_new_local);
+    k_eff *= F_new/F_prev;
+    F_prev = F_new;
+    phi_old_local = phi_new_local;
+  }
+
+  for (double& value : phi_old_local)
+    value /= F_prev;
+
+  //======================================== Create vectors
+  const size_t num_phi = phi_old_local.size();
+  const int64_t local_size = static_cast<int64_t>(num_phi) +
+                             ((chi_mpi.location_id == 0) ? 1 : 0);
+  int64_t global_size = 0;
+  MPI_Allreduce(&local_size, &global_size, 1, MPI_INT64_T,
+                MPI_SUM, chi_mpi.comm);
+
+  Vec x = chi_math::PETScUtils::CreateVector(local_size, global_size);
+  Vec r;
+  VecDuplicate(x, &r);
+
+  {
+    double* x_raw;
+    VecGetArray(x, &x_raw);
+    std::copy(phi_old_local.begin(), phi_old_local.end(), x_raw);
+    if (chi_mpi.location_id == 0) x_raw[num_phi] = k_eff;
+    VecRestoreArray(x, &x_raw);
+  }
+
+  //======================================== Setup SNES
+  SNES snes;
+  SNESCreate(PETSC_COMM_WORLD, &snes);
+  SNESSetType(snes, SNESNEWTONLS);
+  SNESSetOptionsPrefix(snes, "keigen_");
+  SNESSetFunction(snes, r, KEigenNewtonResidual, &context);
+
+  Mat J;
+  MatCreateSNESMF(snes, &J);
+  SNESSetJacobian(snes, J, J, MatMFFDComputeJacobian, nullptr);
+
+  KSP ksp;
+  PC pc;
+  SNESGetKSP(snes, &ksp);
+  KSPSetType(ksp, KSPGMRES);
+  KSPGetPC(ksp, &pc);
+  PCSetType(pc, jfnk_pc_type.c_str());
+  SNESKSPSetUseEW(snes, PETSC_TRUE);
+
+  SNESSetTolerances(snes, 1.0e-50, options.tolerance, 0.0,
+                    options.max_iterations, 1000000);
+  SNESMonitorSet(snes, KEigenNewtonMonitor, &context, nullptr);
+  SNESSetFromOptions(snes);
+
+  //======================================== Solve
+  SNESSolve(snes, nullptr, x);
+
+  SNESConvergedReason reason;
+  PetscInt num_newton_its = 0, num_krylov_its = 0;
+  SNESGetConvergedReason(snes, &reason);
+  SNESGetIterationNumber(snes, &num_newton_its);
+  SNESGetLinearSolveIterations(snes, &num_krylov_its);
+
+  if (reason < 0)
+    chi_log.Log(LOG_0WARNING)
+      << "JFNK k-eigenvalue solve did not converge. Reason "
+      << static_cast<int>(reason) << ".";
+
+  //======================================== Unpack solution
+  {
+    const double* x_raw;
+    VecGetArrayRead(x, &x_raw);
+    std::copy(x_raw, x_raw + num_phi, phi_old_local.begin());
+    if (chi_mpi.location_id == 0) k_eff = x_raw[num_phi];
+    VecRestoreArrayRead(x, &x_raw);
+  }
+  MPI_Bcast(&k_eff, 1, MPI_DOUBLE, 0, chi_mpi.comm);
+
+  phi_new_local = phi_old_local;
+  phi_prev_local = phi_old_local;
+
+  MatDestroy(&J);
+  VecDestroy(&x);
+  VecDestroy(&r);
+  SNESDestroy(&snes);
+
+  //============================== Initialize the precursor vector
+  InitializePrecursors();
+
+  num_outer_iterations = num_newton_its;
+  num_sweeps = 0;
+  for (auto& sweep_scheduler : sweep_schedulers)
+    num_sweeps += sweep_scheduler->GetNumberOfSweeps();
+
+  chi_log.Log(LOG_0)
+      << "\n";
+  chi_log.Log(LOG_0)
+      << "        Final k-eigenvalue    :        "
+      << std::setprecision(6) << k_eff;
+  chi_log.Log(LOG_0)
+      << "        Newton iterations     :        " << num_newton_its;
+  chi_log.Log(LOG_0)
+      << "        Krylov iterations     :        " << num_krylov_its;
+  chi_log.Log(LOG_0)
+      << "        Total number of sweeps:        " << num_sweeps;
+  chi_log.Log(LOG_0)
+      << "\n\n";
+}
@@ -22,6 +22,7 @@ typedef sweep_namespace::SchedulingAlgorithm SchedulingAlgorithm;
 using namespace LinearBoltzmann;
 
 #include <iomanip>
+#include <cmath>
 
 //###################################################################
 /**Power iterative scheme for k-eigenvalue calculations.
@@ -48,16 +49,40 @@ void KEigenvalue::Solver::PowerIteration()
   sweep_scheduler.sweep_chunk.SetDestinationPhi(phi_new_local);
 
   //======================================== Initial guess
-  phi_prev_local.assign(phi_prev_local.size(), 1.0);
+  if (not use_flux_initial_guess)
+    phi_prev_local.assign(phi_prev_local.size(), 1.0);
   ScopedCopySTLvectors(groupset, phi_prev_local, phi_old_local);
 
+  //======================================== Inexact inner tolerances
+  const double full_inner_tolerance = groupset.residual_tolerance;
+  double inner_tolerance = full_inner_tolerance;
+  if (use_inexact_inners)
+    inner_tolerance = std::max(inexact_inner_max_tolerance,
+                               full_inner_tolerance);
+  size_t num_inner_sweeps = 0;
+
   //======================================== Start power iterations
   double F_prev = 1.0;
   double k_eff_prev = 1.0;
+  if (use_flux_initial_guess)
+  {
+    F_prev = ComputeProduction(phi_prev_local);
+    k_eff_prev = k_eff;
+  }
+  double k_eff_change = 1.0;
   int nit = 0;      //number of iterations
   bool converged = false;
   while (nit < options.max_iterations)
   {
+    //============================== Set the inner tolerance
+    if (use_inexact_inners)
+    {
+      inner_tolerance = ComputeInexactInnerTolerance(full_inner_tolerance,
+                                                     k_eff_change,
+                                                     inner_tolerance);
+      groupset.residual_tolerance = inner_tolerance;
+    }
+    const size_t num_sweeps_before = sweep_scheduler.GetNumberOfSweeps();
 
     //============================== Clear source moments
     q_moments_local.assign(q_moments_local.size(), 0.0);
@@ -75,13 +100,23 @@ void KEigenvalue::Solver::PowerIteration()
                         APPLY_WGS_SCATTER_SOURCE | APPLY_AGS_SCATTER_SOURCE,
                         options.verbose_inner_iterations);
     }
+    else if (groupset.iterative_method == IterativeMethod::ANDERSON)
+    {
+      Anderson(groupset, 0, sweep_scheduler,
+               APPLY_WGS_SCATTER_SOURCE | APPLY_AGS_SCATTER_SOURCE,
+               options.verbose_inner_iterations);
+    }
     else if (groupset.iterative_method == IterativeMethod::GMRES)
     {
       GMRES(groupset, 0, sweep_scheduler,
             APPLY_WGS_SCATTER_SOURCE, APPLY_AGS_SCATTER_SOURCE,
-            options.verbose_inner_iterations);
+            options.verbose_inner_iterations,
+            reuse_krylov_objects);
     }
 
+    num_inner_sweeps +=
+      sweep_scheduler.GetNumberOfSweeps() - num_sweeps_before;
+
     //============================== Recompute k-eigenvalue
     double F_new = ComputeProduction();
     k_eff = F_new / F_prev * k_eff;
@@ -89,12 +124,14 @@ void KEigenvalue::Solver::PowerIteration()
 
     //============================== Check convergence, reset book-keeping
     ScopedCopySTLvectors(groupset, phi_new_local, phi_prev_local);
-    double k_eff_change = fabs(k_eff - k_eff_prev) / k_eff;
+    k_eff_change = fabs(k_eff - k_eff_prev) / k_eff;
     k_eff_prev = k_eff;
     F_prev = F_new;
     nit += 1;
 
-    if (k_eff_change < std::max(options.tolerance, 1.0e-12))
+    // Only outer iterations with fully converged inners may converge
+    if (k_eff_change < std::max(options.tolerance, 1.0e-12) and
+        inner_tolerance <= full_inner_tolerance)
       converged = true;
 
     //============================== Print iteration summary
@@ -107,6 +144,8 @@ void KEigenvalue::Solver::PowerIteration()
           << "  k_eff " << std::setw(10) << k_eff
           << "  k_eff change " << std::setw(10) << k_eff_change
           << "  reactivity " << std::setw(10) << reactivity * 1e5;
+      if (use_inexact_inners)
+        k_iter_info << "  inner tolerance " << std::setw(10) << inner_tolerance;
       if (converged) k_iter_info << " CONVERGED\n";
 
       chi_log.Log(LOG_0) << k_iter_info.str();
@@ -115,6 +154,12 @@ void KEigenvalue::Solver::PowerIteration()
     if (converged) break;
   }//for k iterations
 
+  DestroyGMRESKrylovObjects();
+  groupset.residual_tolerance = full_inner_tolerance;
+
+  num_outer_iterations = nit;
+  num_sweeps = num_inner_sweeps;
+
   //============================== Initialize the precursor vector
   InitializePrecursors();
 
@@ -142,6 +187,12 @@ void KEigenvalue::Solver::PowerIteration()
       << sweep_time * 1.0e9 * chi_mpi.process_count / static_cast<double>(num_unknowns);
   chi_log.Log(LOG_0)
       << "        Number of unknowns per sweep:  " << num_unknowns;
+  chi_log.Log(LOG_0)
+      << "        Outer iterations      :        " << nit;
+  chi_log.Log(LOG_0)
+      << "        Inner iterations      :        " << num_inner_iterations;
+  chi_log.Log(LOG_0)
+      << "        Total number of sweeps:        " << num_inner_sweeps;
   chi_log.Log(LOG_0)
       << "\n\n";
 
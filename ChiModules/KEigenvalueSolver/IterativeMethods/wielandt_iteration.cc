@@ -0,0 +1,194 @@
+#include "../k_eigenvalue_solver.h"
+
+#include "ChiMesh/SweepUtilities/SweepScheduler/sweepscheduler.h"
+
+#include "chi_log.h"
+
+extern ChiLog& chi_log;
+
+#include "chi_mpi.h"
+
+extern ChiMPI& chi_mpi;
+
+#include "ChiTimer/chi_timer.h"
+
+extern ChiTimer chi_program_timer;
+
+namespace sweep_namespace = chi_mesh::sweep_management;
+typedef sweep_namespace::SweepChunk SweepChunk;
+typedef sweep_namespace::SweepScheduler MainSweepScheduler;
+typedef sweep_namespace::SchedulingAlgorithm SchedulingAlgorithm;
+
+using namespace LinearBoltzmann;
+
+#include <iomanip>
+#include <cmath>
+
+//###################################################################
+/**Wielandt-shifted inverse iteration for k-eigenvalue calculations.
+ *
+ * With the shift \f$ k_s > k \f$, each outer iteration solves
+ * \f[
+ *   \left( L - S - \frac{1}{k_s} F \right) \phi^{n+1} =
+ *   \left( \frac{1}{k^n} - \frac{1}{k_s} \right) F \phi^n
+ * \f]
+ * where the shifted fission operator is treated like scattering in the
+ * groupsets' inner iterations. The eigenvalue is then updated from
+ * \f[
+ *   \frac{1}{k^{n+1}} = \frac{1}{k_s} +
+ *   \left( \frac{1}{k^n} - \frac{1}{k_s} \right)
+ *   \frac{P(\phi^n)}{P(\phi^{n+1})}.
+ * \f]
+ * The dominance ratio of the shifted iteration is
+ * \f$ (1/k_1 - 1/k_s)/(1/k_0 - 1/k_s) \f$, which vanishes as
+ * \f$ k_s \rightarrow k_0 \f$, at the expense of harder inner solves.
+ *
+ * The shift is adaptive. The first iteration is unshifted since the
+ * initial k_eff is only a guess. Thereafter
+ * \f$ k_s = k + \max(\delta_{min}, 10 |\Delta k|) \f$, i.e. the shift is
+ * kept wide while k_eff still changes considerably so that \f$ k_s \f$
+ * remains above the eigenvalue. Groupsets are solved in sequence
+ * within each outer iteration.*/
+void KEigenvalue::Solver::WielandtIteration()
+{
+  chi_log.Log(LOG_0)
+      << "\n\n********** Solving k-eigenvalue problem with "
+      << "Wielandt-shifted inverse iteration.\n\n";
+
+  //======================================== Setup sweep chunks
+  std::vector<std::shared_ptr<SweepChunk>> sweep_chunks;
+  std::vector<std::unique_ptr<MainSweepScheduler>> sweep_schedulers;
+  for (auto& groupset : group_sets)
+  {
+    groupset.angle_agg.ZeroIncomingDelayedPsi();
+
+    sweep_chunks.push_back(SetSweepChunk(groupset));
+    sweep_schedulers.push_back(std::make_unique<MainSweepScheduler>(
+      SchedulingAlgorithm::DEPTH_OF_GRAPH,
+      groupset.angle_agg,
+      *sweep_chunks.back()));
+    sweep_schedulers.back()->sweep_chunk.SetDestinationPhi(phi_new_local);
+  }
+
+  //======================================== Initial guess
+  if (not use_flux_initial_guess)
+    phi_prev_local.assign(phi_prev_local.size(), 1.0);
+  phi_old_local = phi_prev_local;
+
+  //======================================== Inexact inner tolerances
+  std::vector<double> full_inner_tolerances;
+  std::vector<double> inner_tolerances;
+  for (auto& groupset : group_sets)
+  {
+    full_inner_tolerances.push_back(groupset.residual_tolerance);
+    inner_tolerances.push_back(use_inexact_inners ?
+                               std::max(inexact_inner_max_tolerance,
+                                        groupset.residual_tolerance) :
+                               groupset.residual_tolerance);
+  }
+
+  //======================================== Start outer iterations
+  double F_prev = ComputeProduction(phi_prev_local);
+  double k_eff_change = 1.0;
+  int nit = 0;      //number of iterations
+  bool converged = false;
+  while (nit < options.max_iterations)
+  {
+    //============================== Adaptive shift
+    double k_shift = 0.0;
+    double inv_k_shift = 0.0;
+    if (nit > 0)
+    {
+      k_shift = k_eff + std::max(wielandt_min_shift, 10.0*k_eff_change*k_eff);
+      inv_k_shift = 1.0/k_shift;
+    }
+
+    //============================== Solve the shifted problem
+    bool full_tolerance_inners = true;
+    fission_operator_scale = inv_k_shift;
+    for (size_t gs=0; gs<group_sets.size(); ++gs)
+    {
+      auto& groupset = group_sets[gs];
+
+      if (use_inexact_inners)
+      {
+        inner_tolerances[gs] =
+          ComputeInexactInnerTolerance(full_inner_tolerances[gs],
+                                       k_eff_change, inner_tolerances[gs]);
+        groupset.residual_tolerance = inner_tolerances[gs];
+      }
+      if (inner_tolerances[gs] > full_inner_tolerances[gs])
+        full_tolerance_inners = false;
+
+      q_moments_local.assign(q_moments_local.size(), 0.0);
+      AddFissionSource(groupset, q_moments_local, phi_prev_local,
+                       1.0/k_eff - inv_k_shift,
+                       APPLY_WGS_FISSION_SOURCE | APPLY_AGS_FISSION_SOURCE);
+
+      SolveGroupsetInners(groupset, static_cast<int>(gs),
+                          *sweep_schedulers[gs]);
+    }
+    fission_operator_scale = 1.0;
+
+    //============================== Recompute k-eigenvalue
+    double F_new = ComputeProduction(phi_old_local);
+    double k_eff_new = 1.0/(inv_k_shift +
+                            (1.0/k_eff - inv_k_shift)*F_prev/F_new);
+    double reactivity = (k_eff_new - 1.0) / k_eff_new;
+
+    //============================== Check convergence, reset book-keeping
+    phi_prev_local = phi_old_local;
+    k_eff_change = fabs(k_eff_new - k_eff) / k_eff_new;
+    k_eff = k_eff_new;
+    F_prev = F_new;
+    nit += 1;
+
+    // Only outer iterations with fully converged inners may converge
+    if (k_eff_change < std::max(options.tolerance, 1.0e-12) and
+        full_tolerance_inners)
+      converged = true;
+
+    //============================== Print iteration summary
+    if (options.verbose_outer_iterations)
+    {
+      std::stringstream k_iter_info;
+      k_iter_info
+          << chi_program_timer.GetTimeString() << " "
+          << "  Iteration " << std::setw(5) << nit
+          << "  k_eff " << std::setw(10) << k_eff
+          << "  k_eff change " << std::setw(10) << k_eff_change
+          << "  reactivity " << std::setw(10) << reactivity * 1e5
+          << "  k_shift " << std::setw(10) << k_shift;
+      if (converged) k_iter_info << " CONVERGED\n";
+
+      chi_log.Log(LOG_0) << k_iter_info.str();
+    }
+
+    if (converged) break;
+  }//for k iterations
+
+  DestroyGMRESKrylovObjects();
+  for (size_t gs=0; gs<group_sets.size(); ++gs)
+    group_sets[gs].residual_tolerance = full_inner_tolerances[gs];
+
+  //============================== Initialize the precursor vector
+  phi_new_local = phi_old_local;
+  InitializePrecursors();
+
+  num_outer_iterations = nit;
+  num_sweeps = 0;
+  for (auto& sweep_scheduler : sweep_schedulers)
+    num_sweeps += sweep_scheduler->GetNumberOfSweeps();
+
+  chi_log.Log(LOG_0)
+      << "\n";
+  chi_log.Log(LOG_0)
+      << "        Final k-eigenvalue    :        "
+      << std::setprecision(6) << k_eff;
+  chi_log.Log(LOG_0)
+      << "        Outer iterations      :        " << nit;
+  chi_log.Log(LOG_0)
+      << "        Total number of sweeps:        " << num_sweeps;
+  chi_log.Log(LOG_0)
+      << "\n\n";
+}
@@ -0,0 +1,407 @@
+#include "../k_eigenvalue_solver.h"
+
+#include "ChiMath/SpatialDiscretization/FiniteElement/PiecewiseLinear/pwl.h"
+#include "ChiMath/PETScUtils/petsc_utils.h"
+
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+extern ChiLog& chi_log;
+extern ChiMPI& chi_mpi;
+
+#include <cmath>
+
+using namespace LinearBoltzmann;
+
+//###################################################################
+/**Initializes the coarse-mesh finite difference (CMFD) system used to
+ * accelerate the power iteration.
+ *
+ * The coarse mesh is the transport mesh with a single, cell-averaged,
+ * unknown per cell and group. It is discretized with the finite volume
+ * spatial discretization which also provides the ghost cell mappings.
+ * The face current tallies of the transport sweep are enabled here.*/
+void KEigenvalue::Solver::InitializeCMFD()
+{
+  if (options.geometry_type == GeometryType::ONED_CYLINDRICAL or
+      options.geometry_type == GeometryType::ONED_SPHERICAL or
+      options.geometry_type == GeometryType::TWOD_CYLINDRICAL)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "KEigenvalue::Solver::InitializeCMFD: CMFD acceleration is "
+         "only supported for cartesian geometries.";
+    exit(EXIT_FAILURE);
+  }
+
+  const size_t num_groups = groups.size();
+
+  //======================================== Enable current tallies
+  for (const auto& cell : grid->local_cells)
+    cell_transport_views[cell.local_id].EnableFaceCurrents(cell.faces.size());
+
+  for (auto& xs : material_xs)
+    xs->ComputeDiffusionParameters();
+
+  //======================================== Coarse discretization
+  if (not cmfd_discretization)
+    cmfd_discretization = SpatialDiscretization_FV::New(grid);
+  if (cmfd_uk_man.unknowns.empty())
+    cmfd_uk_man.AddUnknown(chi_math::UnknownType::VECTOR_N, num_groups);
+
+  auto& fv = *cmfd_discretization;
+
+  const int64_t num_local_dofs = fv.GetNumLocalDOFs(cmfd_uk_man);
+  const int64_t num_globl_dofs = fv.GetNumGlobalDOFs(cmfd_uk_man);
+
+  //======================================== Sparsity pattern
+  // A row couples to all the groups of its own cell through scattering
+  // and to the same group of each face neighbor through leakage.
+  std::vector<int64_t> nnz_in_diag(num_local_dofs, num_groups);
+  std::vector<int64_t> nnz_off_diag(num_local_dofs, 0);
+  for (const auto& cell : grid->local_cells)
+    for (const auto& face : cell.faces)
+    {
+      if (not face.has_neighbor) continue;
+
+      const bool neighbor_local = grid->IsCellLocal(face.neighbor_id);
+      for (size_t g=0; g<num_groups; ++g)
+      {
+        int64_t ir = fv.MapDOFLocal(cell,0,cmfd_uk_man,0,g);
+        if (neighbor_local) nnz_in_diag[ir] += 1;
+        else                nnz_off_diag[ir] += 1;
+      }
+    }//for face
+
+  //======================================== Create PETSc objects
+  cmfd_A = chi_math::PETScUtils::CreateSquareMatrix(num_local_dofs,
+                                                   num_globl_dofs);
+  chi_math::PETScUtils::InitMatrixSparsity(cmfd_A, nnz_in_diag, nnz_off_diag);
+
+  auto ghost_ids = fv.GetGhostDOFIndices(grid,cmfd_uk_man);
+  std::vector<int64_t> ghost_dof_ids(ghost_ids.begin(), ghost_ids.end());
+  cmfd_phi = chi_math::PETScUtils::CreateVectorWithGhosts(
+    num_local_dofs, num_globl_dofs,
+    static_cast<int64_t>(ghost_dof_ids.size()), ghost_dof_ids);
+
+  cmfd_x = chi_math::PETScUtils::CreateVector(num_local_dofs, num_globl_dofs);
+  VecDuplicate(cmfd_x, &cmfd_b);
+
+  auto setup = chi_math::PETScUtils::CreateCommonKrylovSolverSetup(
+    cmfd_A, "CMFDSolver", KSPGMRES, PCBJACOBI, 1.0e-10, 1000);
+  cmfd_ksp = setup.ksp;
+
+  chi_log.Log(LOG_0)
+    << "CMFD acceleration initialized with "
+    << num_globl_dofs << " coarse unknowns.";
+}
+
+//###################################################################
+/**Performs the coarse-mesh finite difference (CMFD) update after a
+ * transport sweep.
+ *
+ * The sweep's net face currents and cell-averaged scalar fluxes are
+ * used to compute, per face and group, the nonlinear current correction
+ * \f$ \hat{D} \f$ such that
+ * \f[
+ *   J_f = -\tilde{D}(\bar{\phi}_j - \bar{\phi}_i)
+ *         + \hat{D}(\bar{\phi}_i + \bar{\phi}_j)
+ * \f]
+ * reproduces the transport current exactly. The resulting low-order
+ * diffusion eigenproblem is solved with power iterations, after which
+ * k_eff is set to the low-order eigenvalue and the transport flux
+ * moments (phi_new_local) of each cell are rescaled by the ratio of the
+ * low-order to transport cell-averaged flux.*/
+void KEigenvalue::Solver::CMFDAccelerate()
+{
+  const size_t num_groups = groups.size();
+  const size_t num_local_cells = grid->local_cells.size();
+  auto& fv = *cmfd_discretization;
+
+  auto pwl = std::static_pointer_cast<SpatialDiscretization_PWLD>(discretization);
+
+  //======================================== Sum replica tallies
+  if (chi_mpi.num_replicas > 1)
+  {
+    std::vector<double> buffer;
+    for (const auto& cell : grid->local_cells)
+    {
+      auto& currents = cell_transport_views[cell.local_id].FaceCurrents();
+      buffer.insert(buffer.end(), currents.begin(), currents.end());
+    }
+
+    MPI_Allreduce(MPI_IN_PLACE, buffer.data(), static_cast<int>(buffer.size()),
+                  MPI_DOUBLE, MPI_SUM, chi_mpi.replica_comm);
+
+    size_t k=0;
+    for (const auto& cell : grid->local_cells)
+      for (double& val : cell_transport_views[cell.local_id].FaceCurrents())
+        val = buffer[k++];
+  }
+
+  //======================================== Compute cell averages
+  std::vector<double> cell_volumes(num_local_cells, 0.0);
+  std::vector<double> phi_avg(num_local_cells*num_groups, 0.0);
+  for (const auto& cell : grid->local_cells)
+  {
+    auto& cell_fe_view = pwl->GetUnitIntegrals(cell);
+    auto& transport_view = cell_transport_views[cell.local_id];
+
+    double volume = 0.0;
+    for (int i=0; i < cell_fe_view.NumNodes(); ++i)
+    {
+      const double intV_shapeI = cell_fe_view.IntV_shapeI(i);
+      const size_t ir = transport_view.MapDOF(i,0,0);
+      volume += intV_shapeI;
+      for (size_t g=0; g<num_groups; ++g)
+        phi_avg[cell.local_id*num_groups + g] += phi_new_local[ir+g]*intV_shapeI;
+    }
+    cell_volumes[cell.local_id] = volume;
+    for (size_t g=0; g<num_groups; ++g)
+      phi_avg[cell.local_id*num_groups + g] /= volume;
+  }//for cell
+
+  //======================================== Communicate ghost averages
+  {
+    double* phi_raw;
+    VecGetArray(cmfd_phi, &phi_raw);
+    for (size_t k=0; k<phi_avg.size(); ++k)
+      phi_raw[k] = phi_avg[k];
+    VecRestoreArray(cmfd_phi, &phi_raw);
+  }
+  chi_math::PETScUtils::CommunicateGhostEntries(cmfd_phi);
+  auto phi_ghosted =
+    chi_math::PETScUtils::GetGhostVectorLocalViewRead(cmfd_phi);
+
+  // Ghost values follow the local values in the local form
+  auto NeighborAverage = [this,&phi_ghosted,num_groups,num_local_cells]
+    (const chi_mesh::Cell& neighbor, size_t g)
+  {
+    if (neighbor.partition_id == chi_mpi.location_id)
+      return phi_ghosted[static_cast<int>(neighbor.local_id*num_groups + g)];
+
+    const uint64_t ghost_id = grid->cells.GetGhostLocalID(neighbor.global_id);
+    return phi_ghosted[static_cast<int>((num_local_cells + ghost_id)*num_groups + g)];
+  };
+
+  //======================================== Fission operator
+  // Consistent with SetKSource
+  auto FissionCoefficient = [this](const chi_physics::TransportCrossSections& xs,
+                                   size_t g, size_t gp)
+  {
+    double nu_sig_f = (options.use_precursors) ?
+                      xs.nu_prompt_sigma_f[gp] : xs.nu_sigma_f[gp];
+    double value = xs.chi[g]*nu_sig_f;
+    if (options.use_precursors)
+      for (size_t j=0; j<xs.num_precursors; ++j)
+        value += xs.chi_delayed[g][j]*xs.precursor_yield[j]*
+                 xs.nu_delayed_sigma_f[gp];
+    return value;
+  };
+
+  // Sets s = F x (volume integrated) and returns the global sum of s
+  auto ApplyFission = [this,&fv,&cell_volumes,num_groups,&FissionCoefficient]
+    (Vec x, Vec s)
+  {
+    const double* x_raw;
+    double* s_raw;
+    VecGetArrayRead(x, &x_raw);
+    VecGetArray(s, &s_raw);
+
+    double local_production = 0.0;
+    for (const auto& cell : grid->local_cells)
+    {
+      const auto& xs = *material_xs[matid_to_xs_map[cell.material_id]];
+      const double volume = cell_volumes[cell.local_id];
+      for (size_t g=0; g<num_groups; ++g)
+      {
+        int64_t ir = fv.MapDOFLocal(cell,0,cmfd_uk_man,0,g);
+        s_raw[ir] = 0.0;
+        if (not xs.is_fissile) continue;
+        for (size_t gp=0; gp<num_groups; ++gp)
+        {
+          int64_t jr = fv.MapDOFLocal(cell,0,cmfd_uk_man,0,gp);
+          s_raw[ir] += FissionCoefficient(xs,g,gp)*x_raw[jr]*volume;
+        }
+        local_production += s_raw[ir];
+      }
+    }//for cell
+
+    VecRestoreArrayRead(x, &x_raw);
+    VecRestoreArray(s, &s_raw);
+
+    double global_production = 0.0;
+    MPI_Allreduce(&local_production, &global_production, 1,
+                  MPI_DOUBLE, MPI_SUM, chi_mpi.comm);
+    return global_production;
+  };
+
+  //======================================== Assemble loss operator
+  MatZeroEntries(cmfd_A);
+  for (const auto& cell : grid->local_cells)
+  {
+    const auto& xs = *material_xs[matid_to_xs_map[cell.material_id]];
+    const double volume = cell_volumes[cell.local_id];
+    const auto& transport_view = cell_transport_views[cell.local_id];
+    const auto& IntS_shapeI = pwl->GetUnitIntegrals(cell).GetIntS_shapeI();
+
+    for (size_t g=0; g<num_groups; ++g)
+    {
+      const int64_t ir = fv.MapDOF(cell,0,cmfd_uk_man,0,g);
+      const double phi_i = phi_avg[cell.local_id*num_groups + g];
+      double diagonal = xs.sigma_t[g]*volume;
+
+      //=================================== Scattering
+      const auto& S0 = xs.transfer_matrices[0];
+      for (size_t t=0; t<S0.rowI_indices[g].size(); ++t)
+      {
+        const size_t gp = S0.rowI_indices[g][t];
+        const double sigma_s = S0.rowI_values[g][t];
+        if (gp == g)
+          diagonal -= sigma_s*volume;
+        else
+          MatSetValue(cmfd_A, ir, fv.MapDOF(cell,0,cmfd_uk_man,0,gp),
+                      -sigma_s*volume, ADD_VALUES);
+      }
+
+      //=================================== Leakage
+      for (size_t f=0; f<cell.faces.size(); ++f)
+      {
+        const auto& face = cell.faces[f];
+        double area = 0.0;
+        for (double intS_shapeI : IntS_shapeI[f])
+          area += intS_shapeI;
+
+        const double J = transport_view.GetFaceCurrent(f,g)/area;
+
+        if (not face.has_neighbor)
+        {
+          const double D_hat = (phi_i > 0.0) ? J/phi_i : 0.0;
+          diagonal += area*D_hat;
+          continue;
+        }
+
+        const auto& neighbor = grid->cells[face.neighbor_id];
+        const auto& xs_j = *material_xs[matid_to_xs_map[neighbor.material_id]];
+        const double phi_j = NeighborAverage(neighbor,g);
+
+        const double D_i = xs.diffusion_coeff[g];
+        const double D_j = xs_j.diffusion_coeff[g];
+        const double h_i = std::fabs((face.centroid - cell.centroid).Dot(face.normal));
+        const double h_j = std::fabs((face.centroid - neighbor.centroid).Dot(face.normal));
+
+        double D_tilde = D_i*D_j/(D_i*h_j + D_j*h_i);
+        double D_hat = 0.0;
+        if (phi_i > 0.0 and phi_j > 0.0)
+        {
+          D_hat = (J - D_tilde*(phi_i - phi_j))/(phi_i + phi_j);
+
+          //============================ Positivity fix
+          if (std::fabs(D_hat) > D_tilde)
+          {
+            if (J > 0.0) { D_tilde =  J/(2.0*phi_i); D_hat =  D_tilde; }
+            else         { D_tilde = -J/(2.0*phi_j); D_hat = -D_tilde; }
+          }
+        }
+
+        diagonal += area*(D_tilde + D_hat);
+        MatSetValue(cmfd_A, ir, fv.MapDOF(neighbor,0,cmfd_uk_man,0,g),
+                    area*(D_hat - D_tilde), ADD_VALUES);
+      }//for f
+
+      MatSetValue(cmfd_A, ir, ir, diagonal, ADD_VALUES);
+    }//for g
+  }//for cell
+
+  MatAssemblyBegin(cmfd_A, MAT_FINAL_ASSEMBLY);
+  MatAssemblyEnd(cmfd_A, MAT_FINAL_ASSEMBLY);
+  KSPSetOperators(cmfd_ksp, cmfd_A, cmfd_A);
+
+  chi_math::PETScUtils::RestoreGhostVectorLocalViewRead(cmfd_phi, phi_ghosted);
+
+  //======================================== Low-order power iterations
+  {
+    double* x_raw;
+    VecGetArray(cmfd_x, &x_raw);
+    for (size_t k=0; k<phi_avg.size(); ++k)
+      x_raw[k] = phi_avg[k];
+    VecRestoreArray(cmfd_x, &x_raw);
+  }
+
+  const double F_0 = ApplyFission(cmfd_x, cmfd_b);
+  if (F_0 <= 0.0)
+  {
+    chi_log.Log(LOG_0WARNING)
+      << "CMFD: Non-positive fission production. Update skipped.";
+    return;
+  }
+
+  const double lo_tolerance = std::max(0.1*options.tolerance, 1.0e-12);
+  const int    lo_max_iterations = 1000;
+
+  double k_lo = k_eff;
+  double F_prev = F_0;
+  int lo_it = 0;
+  for (; lo_it < lo_max_iterations; ++lo_it)
+  {
+    VecScale(cmfd_b, 1.0/k_lo);
+    KSPSolve(cmfd_ksp, cmfd_b, cmfd_x);
+
+    const double F_new = ApplyFission(cmfd_x, cmfd_b);
+    const double k_lo_new = k_lo*F_new/F_prev;
+    const double k_lo_change = std::fabs(k_lo_new - k_lo)/k_lo_new;
+
+    //=================================== Normalize to the transport
+    //                                    production
+    VecScale(cmfd_x, F_0/F_new);
+    VecScale(cmfd_b, F_0/F_new);
+    F_prev = F_0;
+    k_lo = k_lo_new;
+
+    if (k_lo_change < lo_tolerance) break;
+  }
+
+  chi_log.Log(LOG_0VERBOSE_1)
+    << "CMFD: " << lo_it+1 << " low-order iterations, k_eff " << k_lo;
+
+  k_eff = k_lo;
+
+  //======================================== Prolongate
+  const double* x_raw;
+  VecGetArrayRead(cmfd_x, &x_raw);
+  for (const auto& cell : grid->local_cells)
+  {
+    auto& transport_view = cell_transport_views[cell.local_id];
+    for (size_t g=0; g<num_groups; ++g)
+    {
+      const double phi_ho = phi_avg[cell.local_id*num_groups + g];
+      if (phi_ho <= 0.0) continue;
+
+      const int64_t ir_lo = fv.MapDOFLocal(cell,0,cmfd_uk_man,0,g);
+      const double ratio = x_raw[ir_lo]/phi_ho;
+      for (int i=0; i < transport_view.NumNodes(); ++i)
+        for (int m=0; m < transport_view.NumMoments(); ++m)
+          phi_new_local[transport_view.MapDOF(i,m,g)] *= ratio;
+    }
+  }//for cell
+  VecRestoreArrayRead(cmfd_x, &x_raw);
+}
+
+//###################################################################
+/**Destroys the CMFD system and disables the face current tallies.*/
+void KEigenvalue::Solver::CleanUpCMFD()
+{
+  for (const auto& cell : grid->local_cells)
+    cell_transport_views[cell.local_id].EnableFaceCurrents(0);
+
+  if (cmfd_ksp != nullptr) KSPDestroy(&cmfd_ksp);
+  if (cmfd_A   != nullptr) MatDestroy(&cmfd_A);
+  if (cmfd_phi != nullptr) VecDestroy(&cmfd_phi);
+  if (cmfd_x   != nullptr) VecDestroy(&cmfd_x);
+  if (cmfd_b   != nullptr) VecDestroy(&cmfd_b);
+
+  cmfd_ksp = nullptr;
+  cmfd_A   = nullptr;
+  cmfd_phi = nullptr;
+  cmfd_x   = nullptr;
+  cmfd_b   = nullptr;
+}
@@ -13,6 +13,13 @@ using namespace LinearBoltzmann;
 //###################################################################
 /**Compute the total fission production in the problem.*/
 double KEigenvalue::Solver::ComputeProduction()
+{
+  return ComputeProduction(phi_new_local);
+}
+
+//###################################################################
+/**Compute the total fission production of the given flux moments.*/
+double KEigenvalue::Solver::ComputeProduction(const std::vector<double>& phi)
 {
   int first_grp = groups.front().id;
   int last_grp = groups.back().id;
@@ -49,14 +56,14 @@ double KEigenvalue::Solver::ComputeProduction()
           else
             nu_sigma_f = xs->nu_prompt_sigma_f[g];
 
-          local_F += nu_sigma_f * phi_new_local[ir + g] * intV_shapeI;
+          local_F += nu_sigma_f * phi[ir + g] * intV_shapeI;
         }
       }
     }//for i
   }//for c
 
   double global_F = 0.0;
-  MPI_Allreduce(&local_F, &global_F, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(&local_F, &global_F, 1, MPI_DOUBLE, MPI_SUM, chi_mpi.comm);
 
   return global_F;
 }
\ No newline at end of file
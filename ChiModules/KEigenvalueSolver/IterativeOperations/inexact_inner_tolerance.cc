@@ -0,0 +1,28 @@
+#include "../k_eigenvalue_solver.h"
+
+#include <algorithm>
+
+using namespace LinearBoltzmann;
+
+//###################################################################
+/**Computes the inner iteration tolerance of an inexact outer iteration.
+ *
+ * The tolerance is a fraction (inexact_inner_factor) of the change of
+ * the previous outer iteration, capped by inexact_inner_max_tolerance and
+ * never looser than the previous inner tolerance. It is bounded below by
+ * the groupset's own tolerance, `full_tolerance`, which is also used as
+ * soon as the outer change drops below ten times the outer tolerance so
+ * that the final outer iterations are converged fully.*/
+double KEigenvalue::Solver::
+  ComputeInexactInnerTolerance(double full_tolerance,
+                               double outer_change,
+                               double previous_tolerance) const
+{
+  if (outer_change < 10.0*options.tolerance) return full_tolerance;
+
+  double tolerance = std::min(inexact_inner_max_tolerance,
+                              inexact_inner_factor*outer_change);
+  tolerance = std::min(tolerance, previous_tolerance);
+
+  return std::max(tolerance, full_tolerance);
+}
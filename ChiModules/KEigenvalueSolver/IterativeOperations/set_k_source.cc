@@ -32,16 +32,11 @@ SetKSource(LBSGroupset& groupset,
 
   const bool apply_wgs_scatter_src = (source_flags & APPLY_WGS_SCATTER_SOURCE);
   const bool apply_ags_scatter_src = (source_flags & APPLY_AGS_SCATTER_SOURCE);
-  const bool apply_wgs_fission_src = (source_flags & APPLY_WGS_FISSION_SOURCE);
-  const bool apply_ags_fission_src = (source_flags & APPLY_AGS_FISSION_SOURCE);
 
   //============================== Get group setup
   int gs_i = groupset.groups[0].id;
   int gs_f = groupset.groups.back().id;
 
-  int first_grp = groups.front().id;
-  int last_grp = groups.back().id;
-
   const auto& m_to_ell_em_map = groupset.quadrature->GetMomentToHarmonicsIndexMap();
 
   std::vector<double> default_zero_src(groups.size(), 0.0);
@@ -69,7 +64,7 @@ SetKSource(LBSGroupset& groupset,
     for (int i = 0; i < num_nodes; ++i)
     {
       //============================== Loop over moments
-      for (int m = 0; m < num_moments; ++m)
+      for (int m = 0; m < full_cell_view.NumMoments(); ++m)
       {
         unsigned int ell = m_to_ell_em_map[m].ell;
 
@@ -121,79 +116,114 @@ SetKSource(LBSGroupset& groupset,
             }
           }//if moment avail
           destination_q[ir + g] += inscatter_g;
+        }//for g
+      }//for m
+    }//for i
+  }//for cell
 
-          //======================================== Apply fission
-          if (xs->is_fissile and (ell == 0))
-          {
-            double fission_g = 0.0;
-            //============================== Across-groupset
-            if (apply_ags_fission_src)
-            {
-              //============================== Loop over groups
-              for (size_t gprime = first_grp; gprime <= last_grp; ++gprime)
-              {
-                double nu_sig_f = (options.use_precursors) ?
-                                  xs->nu_prompt_sigma_f[gprime] :
-                                  xs->nu_sigma_f[gprime];
+  //============================== Apply fission
+  AddFissionSource(groupset, destination_q, phi_prev_local, 1.0/k_eff,
+                   source_flags);
 
-                if ((gprime < gs_i) or (gprime > gs_f))
-                {
-                  fission_g += xs->chi[g] * nu_sig_f *
-                               phi_prev_local[ir + gprime] / k_eff;
-
-                  //============================== Delayed contributions
-                  if (options.use_precursors and xs->num_precursors > 0)
-                  {
-                    //============================== Loop over precursors
-                    for (size_t j = 0; j < xs->num_precursors; ++j)
-                    {
-                      fission_g += xs->chi_delayed[g][j] *
-                                   xs->precursor_yield[j] *
-                                   xs->nu_delayed_sigma_f[gprime] *
-                                   phi_prev_local[ir + gprime] / k_eff;
-                    }
-                  }//if use precursors and has precursors
-                }//if across groupset
-              }//for gprime
-            }//if across-groupset
+  chi_log.LogEvent(source_event_tag, ChiLog::EventType::EVENT_END);
+}
 
-            //============================== Across-groupset
-            if (apply_wgs_fission_src)
-            {
-              //============================== Loop over groups
-              for (size_t gprime = first_grp; gprime <= last_grp; ++gprime)
-              {
-                double nu_sig_f = (options.use_precursors) ?
-                                  xs->nu_prompt_sigma_f[gprime] : xs->nu_sigma_f[gprime];
+//###################################################################
+/**Adds the fission source, computed from the flux moments `phi` and
+ * multiplied by `scale`, to the source moments of the groups in the
+ * given groupset. The APPLY_WGS_FISSION_SOURCE and
+ * APPLY_AGS_FISSION_SOURCE flags select the within- and
+ * across-groupset contributions.*/
+void KEigenvalue::Solver::
+AddFissionSource(LBSGroupset& groupset,
+                 std::vector<double>& destination_q,
+                 const std::vector<double>& phi,
+                 double scale,
+                 SourceFlags source_flags)
+{
+  const bool apply_wgs_fission_src = (source_flags & APPLY_WGS_FISSION_SOURCE);
+  const bool apply_ags_fission_src = (source_flags & APPLY_AGS_FISSION_SOURCE);
 
-                if ((gprime >= gs_i) and (gprime <= gs_f))
-                {
-                  fission_g += xs->chi[g] * nu_sig_f *
-                               phi_prev_local[ir + gprime] / k_eff;
-
-                  //============================== Delayed contributions
-                  if (options.use_precursors and xs->num_precursors > 0)
-                  {
-                    //============================== Loop over precursors
-                    for (size_t j = 0; j < xs->num_precursors; ++j)
-                    {
-                      fission_g += xs->chi_delayed[g][j] *
-                                   xs->precursor_yield[j] *
-                                   xs->nu_delayed_sigma_f[gprime] *
-                                   phi_prev_local[ir + gprime] / k_eff;
-                    }
-                  }//if use precursors and has precursors
-                }//if across groupset
-              }//for gprime
-            }//if within-groupset
-            destination_q[ir + g] += fission_g;
-
-          }//if fissile and ell == 0
+  if (not (apply_wgs_fission_src or apply_ags_fission_src)) return;
 
-        }//for g
-      }//for m
+  //============================== Get group setup
+  int gs_i = groupset.groups[0].id;
+  int gs_f = groupset.groups.back().id;
+
+  int first_grp = groups.front().id;
+  int last_grp = groups.back().id;
+
+  //============================== Loop over local cells
+  for (auto& cell : grid->local_cells)
+  {
+    auto& full_cell_view = cell_transport_views[cell.local_id];
+
+    auto xs = material_xs[matid_to_xs_map[cell.material_id]];
+    if (not xs->is_fissile) continue;
+
+    //============================== Loop over nodes, zeroth moment only
+    int num_nodes = full_cell_view.NumNodes();
+    for (int i = 0; i < num_nodes; ++i)
+    {
+      size_t ir = full_cell_view.MapDOF(i, 0, 0);
+
+      //============================== Loop over groupset groups
+      for (size_t g = gs_i; g <= gs_f; ++g)
+      {
+        double fission_g = 0.0;
+
+        //============================== Loop over groups
+        for (size_t gprime = first_grp; gprime <= last_grp; ++gprime)
+        {
+          const bool within_groupset = (gprime >= gs_i) and (gprime <= gs_f);
+          if (within_groupset and (not apply_wgs_fission_src)) continue;
+          if ((not within_groupset) and (not apply_ags_fission_src)) continue;
+
+          double nu_sig_f = (options.use_precursors) ?
+                            xs->nu_prompt_sigma_f[gprime] :
+                            xs->nu_sigma_f[gprime];
+
+          fission_g += xs->chi[g] * nu_sig_f * phi[ir + gprime];
+
+          //============================== Delayed contributions
+          if (options.use_precursors and xs->num_precursors > 0)
+          {
+            //============================== Loop over precursors
+            for (size_t j = 0; j < xs->num_precursors; ++j)
+            {
+              fission_g += xs->chi_delayed[g][j] *
+                           xs->precursor_yield[j] *
+                           xs->nu_delayed_sigma_f[gprime] *
+                           phi[ir + gprime];
+            }
+          }//if use precursors and has precursors
+        }//for gprime
+
+        destination_q[ir + g] += scale * fission_g;
+      }//for g
     }//for i
   }//for cell
+}
 
-  chi_log.LogEvent(source_event_tag, ChiLog::EventType::EVENT_END);
+//###################################################################
+/**Sets the source moments for the inner iterations of the groups in
+ * the current groupset. Scattering and material sources are applied as
+ * for the fixed source solver, whereas the fission source, when
+ * requested, is computed from phi_old and multiplied by
+ * fission_operator_scale. This allows shifted eigenvalue iterations to
+ * carry part of the fission operator inside the inner iterations.*/
+void KEigenvalue::Solver::
+SetSource(LBSGroupset& groupset,
+          std::vector<double>& destination_q,
+          SourceFlags source_flags)
+{
+  const int fission_flags = APPLY_WGS_FISSION_SOURCE | APPLY_AGS_FISSION_SOURCE;
+
+  LinearBoltzmann::Solver::
+    SetSource(groupset, destination_q,
+              static_cast<SourceFlags>(source_flags & ~fission_flags));
+
+  if (fission_operator_scale != 0.0)
+    AddFissionSource(groupset, destination_q, phi_old_local,
+                     fission_operator_scale, source_flags);
 }
\ No newline at end of file
@@ -0,0 +1,53 @@
+#include "../k_eigenvalue_solver.h"
+
+#include "LinearBoltzmannSolver/IterativeMethods/lbs_iterativemethods.h"
+
+#include "chi_log.h"
+
+extern ChiLog& chi_log;
+
+using namespace LinearBoltzmann;
+
+//###################################################################
+/**Converges the inner iterations of a groupset with the groupset's
+ * iterative method. The source moments already in q_moments_local are
+ * kept fixed. Scattering and the fission operator, scaled by
+ * fission_operator_scale, are treated as part of the inner iterations.*/
+void KEigenvalue::Solver::
+  SolveGroupsetInners(LBSGroupset& groupset,
+                      int group_set_num,
+                      MainSweepScheduler& sweep_scheduler)
+{
+  const bool reuse = reuse_krylov_objects and group_sets.size() == 1;
+
+  if (groupset.iterative_method == IterativeMethod::CLASSICRICHARDSON)
+  {
+    ClassicRichardson(groupset, group_set_num, sweep_scheduler,
+                      APPLY_WGS_SCATTER_SOURCE | APPLY_AGS_SCATTER_SOURCE |
+                      APPLY_WGS_FISSION_SOURCE | APPLY_AGS_FISSION_SOURCE,
+                      options.verbose_inner_iterations);
+  }
+  else if (groupset.iterative_method == IterativeMethod::ANDERSON)
+  {
+    Anderson(groupset, group_set_num, sweep_scheduler,
+             APPLY_WGS_SCATTER_SOURCE | APPLY_AGS_SCATTER_SOURCE |
+             APPLY_WGS_FISSION_SOURCE | APPLY_AGS_FISSION_SOURCE,
+             options.verbose_inner_iterations);
+  }
+  else if (groupset.iterative_method == IterativeMethod::GMRES)
+  {
+    GMRES(groupset, group_set_num, sweep_scheduler,
+          APPLY_WGS_SCATTER_SOURCE | APPLY_WGS_FISSION_SOURCE,  //lhs_scope
+          APPLY_AGS_SCATTER_SOURCE | APPLY_AGS_FISSION_SOURCE,  //rhs_scope
+          options.verbose_inner_iterations,
+          reuse);
+  }
+  else
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "KEigenvalue::Solver::SolveGroupsetInners: Unsupported iterative "
+         "method for groupset " << group_set_num << ". Use NPT_CLASSICRICHARDSON,"
+         " NPT_ANDERSON or NPT_GMRES.";
+    exit(EXIT_FAILURE);
+  }
+}
@@ -12,20 +12,90 @@ extern ChiLog& chi_log;
 using namespace LinearBoltzmann;
 
 //###################################################################
+/**Executes the k-eigenvalue solver. When any groupset has a
+ * continuation quadrature, the eigenvalue problem is first solved with
+ * the coarse quadratures, to a tolerance no tighter than the groupsets'
+ * continuation tolerances, after which k_eff and the flux moments serve
+ * as the initial guess of the solve with the groupsets' own
+ * quadratures.*/
 void KEigenvalue::Solver::ExecuteKSolver()
 {
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
-  LBSGroupset& groupset = group_sets[0];
+  //=========================================== Angular continuation
+  bool angular_continuation = false;
+  double continuation_tolerance = options.tolerance;
+  for (auto& groupset : group_sets)
+    if (groupset.continuation_quadrature)
+    {
+      angular_continuation = true;
+      continuation_tolerance = std::max(continuation_tolerance,
+                                        groupset.continuation_tolerance);
+    }
 
-  ComputeSweepOrderings(groupset);
-  InitFluxDataStructures(groupset);
+  if (angular_continuation)
+  {
+    chi_log.Log(LOG_0)
+      << "\n********* Angular continuation with coarse quadratures\n"
+      << std::endl;
 
-  PowerIteration();
+    const double tolerance = options.tolerance;
+    std::vector<double> residual_tolerances;
+    for (auto& groupset : group_sets)
+    {
+      residual_tolerances.push_back(groupset.residual_tolerance);
+      if (groupset.continuation_quadrature)
+        groupset.residual_tolerance = std::max(groupset.residual_tolerance,
+                                               groupset.continuation_tolerance);
+      BeginAngularContinuation(groupset);
+    }
+    options.tolerance = continuation_tolerance;
 
-  ResetSweepOrderings(groupset);
+    ExecuteKMethod();
+
+    options.tolerance = tolerance;
+    for (size_t gs=0; gs<group_sets.size(); ++gs)
+    {
+      EndAngularContinuation(group_sets[gs]);
+      group_sets[gs].residual_tolerance = residual_tolerances[gs];
+    }
+    use_flux_initial_guess = true;
+  }
+
+  ExecuteKMethod();
+  use_flux_initial_guess = false;
 
   chi_log.Log(LOG_0) << "KEigenvalueSolver execution completed\n";
 
-  MPI_Barrier(MPI_COMM_WORLD);
-}
\ No newline at end of file
+  MPI_Barrier(chi_mpi.comm);
+}
+
+//###################################################################
+/**Initializes the groupsets' sweep data with their current
+ * quadratures and runs the selected outer iterative method.*/
+void KEigenvalue::Solver::ExecuteKMethod()
+{
+  num_inner_iterations = 0;
+
+  for (auto& groupset : group_sets)
+  {
+    ComputeSweepOrderings(groupset);
+    InitFluxDataStructures(groupset);
+    InitAngularMultigrid(groupset);
+  }
+
+  if (k_method == KEigenMethod::WIELANDT)
+    WielandtIteration();
+  else if (k_method == KEigenMethod::JFNK)
+    NewtonKrylovIteration();
+  else if (options.use_cmfd)
+    PowerIterationCMFD();
+  else
+    PowerIteration();
+
+  for (auto& groupset : group_sets)
+  {
+    CleanUpAngularMultigrid(groupset);
+    ResetSweepOrderings(groupset);
+  }
+}
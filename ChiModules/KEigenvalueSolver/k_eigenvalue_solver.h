@@ -3,12 +3,21 @@
 
 #include "LinearBoltzmannSolver/lbs_linear_boltzmann_solver.h"
 #include "ChiMath/UnknownManager/unknown_manager.h"
+#include "ChiMath/SpatialDiscretization/FiniteVolume/fv.h"
 
 #include <string>
 
 namespace LinearBoltzmann::KEigenvalue
 {
 
+/**Outer iterative methods for the k-eigenvalue problem.*/
+enum class KEigenMethod : int
+{
+  POWER_ITERATION = 1, ///< Power iteration (optionally CMFD accelerated)
+  WIELANDT        = 2, ///< Wielandt-shifted inverse iteration
+  JFNK            = 3  ///< Jacobian-free Newton-Krylov
+};
+
 /**A k-eigenvalue neutron transport solver.*/
 class Solver : public LinearBoltzmann::Solver
 {
@@ -18,6 +27,23 @@ private:
 public:
   double k_eff = 1.0;
 
+  KEigenMethod k_method = KEigenMethod::POWER_ITERATION;
+  double wielandt_min_shift = 0.05;
+  int    jfnk_num_initial_power_iterations = 5;
+  std::string jfnk_pc_type = "none";
+  double fission_operator_scale = 1.0;
+
+  bool   use_flux_initial_guess = false;
+  bool   reuse_krylov_objects = true; ///< Of GMRES inners, see GMRES
+
+  // Results of the last execution, num_sweeps and num_inner_iterations
+  // are in the base class
+  size_t num_outer_iterations = 0;
+
+  bool   use_inexact_inners = false;
+  double inexact_inner_factor = 0.1;
+  double inexact_inner_max_tolerance = 1.0e-2;
+
   size_t num_precursors;
   size_t max_num_precursors_per_material;
 
@@ -26,19 +52,50 @@ public:
   std::vector<double> phi_prev_local;
   std::vector<double> precursor_new_local;
 
+  // CMFD acceleration
+  std::shared_ptr<SpatialDiscretization_FV> cmfd_discretization;
+  chi_math::UnknownManager cmfd_uk_man;
+  Mat cmfd_A = nullptr;
+  Vec cmfd_phi = nullptr;
+  Vec cmfd_x = nullptr;
+  Vec cmfd_b = nullptr;
+  KSP cmfd_ksp = nullptr;
+
   // IterativeMethods
   void PowerIteration();
+  void PowerIterationCMFD();
+  void WielandtIteration();
+  void NewtonKrylovIteration();
+  void SolveGroupsetInners(LBSGroupset& groupset,
+                           int group_set_num,
+                           MainSweepScheduler& sweep_scheduler);
 
   // Iterative operations
   void SetKSource(LBSGroupset& groupset,
                   std::vector<double>& destination_q,
                   SourceFlags source_flags);
+  void SetSource(LBSGroupset& groupset,
+                 std::vector<double>& destination_q,
+                 SourceFlags source_flags) override;
+  void AddFissionSource(LBSGroupset& groupset,
+                        std::vector<double>& destination_q,
+                        const std::vector<double>& phi,
+                        double scale,
+                        SourceFlags source_flags);
   double ComputeProduction();
+  double ComputeProduction(const std::vector<double>& phi);
   void InitializePrecursors();
+  double ComputeInexactInnerTolerance(double full_tolerance,
+                                      double outer_change,
+                                      double previous_tolerance) const;
+  void InitializeCMFD();
+  void CMFDAccelerate();
+  void CleanUpCMFD();
 
   // Execute method
   void InitializeKSolver();
   void ExecuteKSolver();
+  void ExecuteKMethod();
 };
 
 }
@@ -0,0 +1,71 @@
+#include "ChiLua/chi_lua.h"
+
+#include "../k_eigenvalue_solver.h"
+
+#include "ChiPhysics/chi_physics.h"
+
+extern ChiPhysics& chi_physics_handler;
+
+#include "chi_log.h"
+
+extern ChiLog& chi_log;
+
+using namespace LinearBoltzmann;
+
+//###################################################################
+/**Returns the results of the last execution of a k-eigenvalue solver.
+
+\param SolverIndex int Handle to the solver.
+
+\return k_eff,outer_its,sweeps,inner_its The k-eigenvalue, the number of
+        outer iterations (Newton iterations for KEIGEN_JFNK), the total
+        number of sweeps, including those of the inner iterations and of
+        the GMRES initial guesses, and the total number of source or
+        Krylov iterations of the groupset inner solves. The linear
+        iterations of KEIGEN_JFNK are not included in the latter.
+
+\code
+k_eff, num_outers, num_sweeps, num_inners =
+  chiKEigenvalueLBSGetResults(phys1)
+\endcode*/
+int chiKEigenvalueLBSGetResults(lua_State* L)
+{
+  int num_args = lua_gettop(L);
+
+  if (num_args != 1)
+    LuaPostArgAmountError(__FUNCTION__, 1, num_args);
+  LuaCheckNilValue(__FUNCTION__, L, 1);
+
+  int solver_index = lua_tonumber(L, 1);
+
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  KEigenvalue::Solver* solver;
+  try
+  {
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<KEigenvalue::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR)
+          << __FUNCTION__ << ": Incorrect solver-type."
+                             " Cannot cast to KEigenvalue::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+        << __FUNCTION__ << ": Invalid handle to solver\n";
+    exit(EXIT_FAILURE);
+  }
+
+  lua_pushnumber(L, solver->k_eff);
+  lua_pushnumber(L, static_cast<lua_Number>(solver->num_outer_iterations));
+  lua_pushnumber(L, static_cast<lua_Number>(solver->num_sweeps));
+  lua_pushnumber(L, static_cast<lua_Number>(solver->num_inner_iterations));
+
+  return 4;
+}
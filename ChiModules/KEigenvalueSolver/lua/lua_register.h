@@ -5,8 +5,19 @@ RegisterFunction(chiKEigenvalueLBSInitialize);
 
 RegisterFunction(chiKEigenvalueLBSExecute);
 
+RegisterFunction(chiKEigenvalueLBSGetResults);
+
 RegisterFunction(chiLBSSetUsePrecursors);
 
 RegisterFunction(chiLBSSetMaxKIterations);
 
 RegisterFunction(chiLBSSetKTolerance);
+
+RegisterFunction(chiLBSSetUseCMFD);
+
+RegisterFunction(chiLBSSetKEigenMethod);
+RegisterConstant(KEIGEN_POWER,    1);
+RegisterConstant(KEIGEN_WIELANDT, 2);
+RegisterConstant(KEIGEN_JFNK,     3);
+RegisterFunction(chiLBSSetInexactInnerTolerance);
+RegisterFunction(chiLBSSetReuseKrylovObjects);
@@ -162,3 +162,331 @@ int chiLBSSetKTolerance(lua_State* L)
 
   return 0;
 }
+
+//############################################################
+/**Set boolean for using coarse-mesh finite difference (CMFD) acceleration
+ * of the k-eigenvalue power iterations.
+
+\param SolverIndex int Handle to the solver.
+\param UseCMFD bool Flag for using CMFD acceleration.
+
+When enabled, each outer iteration consists of a single transport sweep
+followed by a low-order diffusion eigenvalue solve that is corrected with
+the sweep's face currents. Only cartesian geometries are supported.*/
+int chiLBSSetUseCMFD(lua_State* L)
+{
+  int num_args = lua_gettop(L);
+
+  if (num_args != 2)
+    LuaPostArgAmountError(__FUNCTION__, 2, num_args);
+  LuaCheckNilValue(__FUNCTION__, L, 2);
+
+  int solver_index = lua_tonumber(L, 1);
+  bool use_cmfd = lua_toboolean(L, 2);
+
+  // ----- Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzmann::Solver* solver;
+  try
+  {
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<LinearBoltzmann::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR)
+          << __FUNCTION__ << ": Incorrect solver-type."
+                             " Cannot cast to KEigenvalue::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+        << __FUNCTION__ << ": Invalid handle to solver";
+    exit(EXIT_FAILURE);
+  }
+  solver->options.use_cmfd = use_cmfd;
+
+  chi_log.Log(LOG_0)
+      << "CMFD acceleration set to " << use_cmfd;
+
+  return 0;
+}
+
+//############################################################
+/**Sets the outer iterative method of a k-eigenvalue solver.
+
+\param SolverIndex int Handle to the solver.
+\param Method int The outer iterative method. See below.
+\param Options varying (Optional) Method specific options. See below.
+
+##_
+
+###Method
+KEIGEN_POWER\n
+ Power iteration. Only a single groupset is supported. Can be accelerated
+ with chiLBSSetUseCMFD.\n\n
+
+KEIGEN_WIELANDT\n
+ Wielandt-shifted inverse iteration with an adaptive shift. The groupsets'
+ iterative methods are used to solve the shifted problems. Options:\n
+ - MinShift double (Optional) Minimum Wielandt shift k_s - k_eff.
+   Default 0.05.\n\n
+
+KEIGEN_JFNK\n
+ Jacobian-free Newton-Krylov using PETSc's SNES. The PETSc options prefix
+ is "keigen_". Options:\n
+ - NumInitialPowerIterations int (Optional) Number of power iterations
+   providing the initial guess. Default 5.\n
+ - PCType string (Optional) PETSc preconditioner type of the Newton
+   linear solves. Since the Jacobian is matrix-free, only types that do
+   not need the matrix entries apply. Default "none".\n\n
+
+\code
+chiLBSSetKEigenMethod(phys1, KEIGEN_WIELANDT, 0.1)
+chiLBSSetKEigenMethod(phys1, KEIGEN_JFNK, 10, "none")
+\endcode*/
+int chiLBSSetKEigenMethod(lua_State* L)
+{
+  int num_args = lua_gettop(L);
+
+  if (num_args < 2)
+    LuaPostArgAmountError(__FUNCTION__, 2, num_args);
+  LuaCheckNilValue(__FUNCTION__, L, 1);
+  LuaCheckNilValue(__FUNCTION__, L, 2);
+
+  int solver_index = lua_tonumber(L, 1);
+  int method = lua_tointeger(L, 2);
+
+  // ----- Get pointer to solver
+  chi_physics::Solver* psolver;
+  KEigenvalue::Solver* solver;
+  try
+  {
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<KEigenvalue::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR)
+          << __FUNCTION__ << ": Incorrect solver-type."
+                             " Cannot cast to KEigenvalue::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+        << __FUNCTION__ << ": Invalid handle to solver";
+    exit(EXIT_FAILURE);
+  }
+
+  if (method == static_cast<int>(KEigenvalue::KEigenMethod::POWER_ITERATION))
+    solver->k_method = KEigenvalue::KEigenMethod::POWER_ITERATION;
+  else if (method == static_cast<int>(KEigenvalue::KEigenMethod::WIELANDT))
+    solver->k_method = KEigenvalue::KEigenMethod::WIELANDT;
+  else if (method == static_cast<int>(KEigenvalue::KEigenMethod::JFNK))
+    solver->k_method = KEigenvalue::KEigenMethod::JFNK;
+  else
+  {
+    chi_log.Log(LOG_ALLERROR)
+        << __FUNCTION__ << ": Unknown k-eigenvalue method " << method
+        << ". Use KEIGEN_POWER, KEIGEN_WIELANDT or KEIGEN_JFNK.";
+    exit(EXIT_FAILURE);
+  }
+
+  if (solver->k_method == KEigenvalue::KEigenMethod::WIELANDT and
+      num_args >= 3)
+  {
+    double min_shift = lua_tonumber(L, 3);
+    if (min_shift <= 0.0)
+    {
+      chi_log.Log(LOG_ALLERROR)
+          << __FUNCTION__ << ": The minimum Wielandt shift must be > 0.0";
+      exit(EXIT_FAILURE);
+    }
+    solver->wielandt_min_shift = min_shift;
+  }
+
+  if (solver->k_method == KEigenvalue::KEigenMethod::JFNK and
+      num_args >= 3)
+  {
+    int num_power_its = lua_tointeger(L, 3);
+    if (num_power_its < 0)
+    {
+      chi_log.Log(LOG_ALLERROR)
+          << __FUNCTION__ << ": The number of initial power iterations "
+          << "must be >= 0";
+      exit(EXIT_FAILURE);
+    }
+    solver->jfnk_num_initial_power_iterations = num_power_its;
+
+    if (num_args >= 4)
+    {
+      LuaCheckNilValue(__FUNCTION__, L, 4);
+      solver->jfnk_pc_type = lua_tostring(L, 4);
+    }
+  }
+
+  chi_log.Log(LOG_0)
+      << "k-eigenvalue method set to " << method;
+
+  return 0;
+}
+
+//############################################################
+/**Enables inexact inner iterations for k-eigenvalue outer iterations.
+
+\param SolverIndex int Handle to the solver.
+\param UseInexactInners bool Flag for using relaxed inner tolerances.
+\param Factor double (Optional) Ratio of the inner tolerance to the
+                     relative k_eff change of the previous outer iteration.
+                     Default 0.1.
+\param MaxTolerance double (Optional) Loosest allowed inner tolerance.
+                           Default 1.0e-2.
+
+When enabled, the groupsets' residual tolerances are loosened while k_eff
+is still far from converged and tightened monotonically to the user
+specified tolerances as the outer iterations converge. Convergence of the
+outer iterations is only declared once the inners are solved at the full
+tolerance.
+
+Only power iteration without CMFD and Wielandt iteration solve inner
+iterations. With CMFD acceleration, which performs a single sweep per outer
+iteration, and with JFNK, whose linear solves are already inexact, the
+option is ignored with a warning.
+
+\code
+chiLBSSetInexactInnerTolerance(phys1, true, 0.1)
+\endcode*/
+int chiLBSSetInexactInnerTolerance(lua_State* L)
+{
+  int num_args = lua_gettop(L);
+
+  if (num_args < 2)
+    LuaPostArgAmountError(__FUNCTION__, 2, num_args);
+  LuaCheckNilValue(__FUNCTION__, L, 1);
+  LuaCheckNilValue(__FUNCTION__, L, 2);
+
+  int solver_index = lua_tonumber(L, 1);
+  bool use_inexact_inners = lua_toboolean(L, 2);
+
+  // ----- Get pointer to solver
+  chi_physics::Solver* psolver;
+  KEigenvalue::Solver* solver;
+  try
+  {
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<KEigenvalue::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR)
+          << __FUNCTION__ << ": Incorrect solver-type."
+                             " Cannot cast to KEigenvalue::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+        << __FUNCTION__ << ": Invalid handle to solver";
+    exit(EXIT_FAILURE);
+  }
+
+  solver->use_inexact_inners = use_inexact_inners;
+
+  if (num_args >= 3)
+  {
+    double factor = lua_tonumber(L, 3);
+    if (factor <= 0.0)
+    {
+      chi_log.Log(LOG_ALLERROR)
+          << __FUNCTION__ << ": The inexact inner factor must be > 0.0";
+      exit(EXIT_FAILURE);
+    }
+    solver->inexact_inner_factor = factor;
+  }
+
+  if (num_args >= 4)
+  {
+    double max_tolerance = lua_tonumber(L, 4);
+    if (max_tolerance <= 0.0)
+    {
+      chi_log.Log(LOG_ALLERROR)
+          << __FUNCTION__ << ": The maximum inner tolerance must be > 0.0";
+      exit(EXIT_FAILURE);
+    }
+    solver->inexact_inner_max_tolerance = max_tolerance;
+  }
+
+  chi_log.Log(LOG_0)
+      << "Inexact inner tolerances set to " << use_inexact_inners;
+
+  return 0;
+}
+
+//############################################################
+/**Sets whether GMRES inner iterations keep their Krylov objects between
+ * outer iterations.
+
+\param SolverIndex int Handle to the solver.
+\param ReuseKrylovObjects bool Flag for reusing the Krylov objects.
+                               Default true.
+
+When enabled, and the solver has a single groupset, the KSP of the inner
+GMRES solves is kept between outer iterations and previous solutions are
+recycled into the initial guess with PETSc's POD guess. The POD guess
+costs one extra sweep per inner solve, which is included in the number of
+sweeps returned by chiKEigenvalueLBSGetResults.
+
+\code
+chiLBSSetReuseKrylovObjects(phys1, false)
+\endcode*/
+int chiLBSSetReuseKrylovObjects(lua_State* L)
+{
+  int num_args = lua_gettop(L);
+
+  if (num_args != 2)
+    LuaPostArgAmountError(__FUNCTION__, 2, num_args);
+  LuaCheckNilValue(__FUNCTION__, L, 1);
+  LuaCheckNilValue(__FUNCTION__, L, 2);
+
+  int solver_index = lua_tonumber(L, 1);
+  bool reuse_krylov_objects = lua_toboolean(L, 2);
+
+  // ----- Get pointer to solver
+  chi_physics::Solver* psolver;
+  KEigenvalue::Solver* solver;
+  try
+  {
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<KEigenvalue::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR)
+          << __FUNCTION__ << ": Incorrect solver-type."
+                             " Cannot cast to KEigenvalue::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+        << __FUNCTION__ << ": Invalid handle to solver";
+    exit(EXIT_FAILURE);
+  }
+
+  solver->reuse_krylov_objects = reuse_krylov_objects;
+
+  chi_log.Log(LOG_0)
+      << "Krylov object reuse set to " << reuse_krylov_objects;
+
+  return 0;
+}
@@ -332,7 +332,7 @@ LBSCurvilinear::Solver::InitializeSpatialDiscretization()
     SpatialDiscretization_PWLD::New(grid, setup_flags, qorder, system);
 
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
   chi_log.Log(LOG_0)
     << "Cell matrices computed.                   Process memory = "
     << std::setprecision(3)
@@ -110,6 +110,7 @@ LBSCurvilinear::SweepChunkPWL::Sweep(chi_mesh::sweep_management::AngleSet* angle
     const int num_nodes = static_cast<int>(fe_intgrl_values.NumNodes());
     auto& transport_view = grid_transport_view[cell.local_id];
     const int xs_mapping = transport_view.XSMapping();
+    const int num_cell_moms = transport_view.NumMoments();
     const auto& sigma_tg = xsections[xs_mapping]->sigma_t;
     std::vector<bool> face_incident_flags(num_faces, false);
     std::vector<double> face_mu_values(num_faces, 0.0);
@@ -277,7 +278,7 @@ LBSCurvilinear::SweepChunkPWL::Sweep(chi_mesh::sweep_management::AngleSet* angle
         for (int i = 0; i < num_nodes; ++i)
         {
           source[i] = 0;
-          for (int m = 0; m < num_moms; ++m)
+          for (int m = 0; m < num_cell_moms; ++m)
           {
             const size_t ir = transport_view.MapDOF(i, m, g);
             source[i] += m2d_op[m][angle_num] * q_moments[ir];
@@ -299,7 +300,7 @@ LBSCurvilinear::SweepChunkPWL::Sweep(chi_mesh::sweep_management::AngleSet* angle
 
 
       // ============================= Accumulate flux
-      for (int m = 0; m < num_moms; ++m)
+      for (int m = 0; m < num_cell_moms; ++m)
       {
         const double wn_d2m = d2m_op[m][angle_num];
         for (int i = 0; i < num_nodes; ++i)
@@ -15,6 +15,8 @@ extern ChiMPI& chi_mpi;
 LBSGroupset::LBSGroupset()
 {
   quadrature = nullptr;
+  continuation_quadrature = nullptr;
+  continuation_tolerance = 1.0e-4;
   iterative_method = LinearBoltzmann::IterativeMethod::CLASSICRICHARDSON;
   angleagg_method  = LinearBoltzmann::AngleAggregationType::POLAR;
   master_num_grp_subsets = 1;
@@ -22,6 +24,7 @@ LBSGroupset::LBSGroupset()
   residual_tolerance = 1.0e-6;
   max_iterations = 200;
   gmres_restart_intvl = 30;
+  anderson_depth = 5;
   apply_wgdsa = false;
   apply_tgdsa = false;
 
@@ -37,6 +40,10 @@ LBSGroupset::LBSGroupset()
   wgdsa_verbose = false;
   tgdsa_verbose = false;
 
+  dsa_right_preconditioning = false;
+  dsa_flexible_gmres = false;
+  dsa_matrix_free = false;
+
   allow_cycles = false;
 
   log_sweep_events = false;
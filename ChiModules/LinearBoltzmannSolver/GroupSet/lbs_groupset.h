@@ -14,6 +14,8 @@
 
 #include "ChiPhysics/chi_physics_namespace.h"
 
+class LBSGroupset;
+
 namespace LinearBoltzmann
 {
   enum class AngleAggregationType
@@ -23,6 +25,20 @@ namespace LinearBoltzmann
     POLAR = 2,
     AZIMUTHAL = 3,
   };
+
+  /**A coarse angular level of the angular multigrid preconditioner. The
+   * level's groupset, sweep chunk and sweep scheduler are created by
+   * InitAngularMultigrid and destroyed by CleanUpAngularMultigrid.*/
+  struct AngularMultigridLevel
+  {
+    std::shared_ptr<chi_math::AngularQuadrature> quadrature;
+    unsigned int scattering_order = 0; ///< Highest moment order corrected
+    int          num_sweeps = 2;       ///< Source iterations on the level
+
+    std::shared_ptr<LBSGroupset>                                 groupset;
+    std::shared_ptr<chi_mesh::sweep_management::SweepChunk>      sweep_chunk;
+    std::shared_ptr<chi_mesh::sweep_management::SweepScheduler>  sweep_scheduler;
+  };
 }
 
 typedef std::pair<int,int> GsSubSet;
@@ -39,6 +55,9 @@ protected:
 public:
   std::vector<LBSGroup>                        groups;
   std::shared_ptr<chi_math::AngularQuadrature> quadrature;
+  std::shared_ptr<chi_math::AngularQuadrature> continuation_quadrature;
+  double                                       continuation_tolerance;
+  bool                                         continuation_active=false;
   chi_mesh::sweep_management::AngleAggregation angle_agg;
   std::vector<SPDS_ptr>                        sweep_orderings;
   int                                          master_num_grp_subsets;
@@ -49,12 +68,14 @@ public:
   std::vector<int>                             ang_subset_sizes_top;
   std::vector<AngSubSet>                       ang_subsets_bot;
   std::vector<int>                             ang_subset_sizes_bot;
+  int                                          num_rhs=1; ///< Right-hand sides per sweep
 
   LinearBoltzmann::IterativeMethod             iterative_method;
   LinearBoltzmann::AngleAggregationType        angleagg_method;
   double                                       residual_tolerance;
   int                                          max_iterations;
   int                                          gmres_restart_intvl;
+  int                                          anderson_depth;
   bool                                         apply_wgdsa;
   bool                                         apply_tgdsa;
   int                                          wgdsa_max_iters;
@@ -65,6 +86,12 @@ public:
   bool                                         tgdsa_verbose;
   std::string                                  wgdsa_string;
   std::string                                  tgdsa_string;
+  bool                                         dsa_right_preconditioning;
+  bool                                         dsa_flexible_gmres;
+  bool                                         dsa_matrix_free;
+
+  std::vector<LinearBoltzmann::AngularMultigridLevel>
+                                               angular_multigrid_levels;
 
   bool                                         allow_cycles;
 
@@ -73,6 +100,12 @@ public:
 
   bool                                         log_sweep_events;
 
+  bool                                         setup_retained=false;
+  std::shared_ptr<chi_mesh::sweep_management::SweepChunk>
+                                               retained_sweep_chunk;
+  std::shared_ptr<chi_mesh::sweep_management::SweepScheduler>
+                                               retained_sweep_scheduler;
+
   chi_math::UnknownManager                     psi_uk_man;
   bool                                         psi_to_be_saved=false;
   size_t                                       num_psi_unknowns_local=0;
@@ -3,6 +3,8 @@
 #include "../Tools/kspmonitor_npt.h"
 #include "../Tools/ksp_data_context.h"
 #include "../IterativeOperations/lbs_matrixaction_Ax.h"
+#include "../IterativeOperations/lbs_preconditioner_dsa.h"
+#include "../IterativeOperations/lbs_preconditioner_angular_multigrid.h"
 
 #include "DiffusionSolver/Solver/diffusion_solver.h"
 
@@ -20,22 +22,46 @@ extern ChiMPI& chi_mpi;
 extern ChiTimer chi_program_timer;
 
 //###################################################################
-/**Solves a groupset using GMRES.*/
+/**Solves a groupset using GMRES.
+ *
+ * By default WGDSA/TGDSA are applied inside the Krylov operator. When
+ * the groupset requests DSA right preconditioning, the operator only
+ * contains the sweep and DSA is applied through a PCSHELL on the right,
+ * optionally with FGMRES so that the diffusion solves may be inexact.
+ * When the groupset has angular multigrid levels, the angular multigrid
+ * correction is applied through the PCSHELL on the right and DSA, if
+ * any, is moved into the same preconditioner.
+ *
+ * With reuse_krylov_objects the KSP, shell operator and vectors are kept
+ * alive for subsequent calls with the same groupset, sweep scheduler and
+ * lhs scope, and previous solutions are recycled into the initial guess.
+ * The caller must then call DestroyGMRESKrylovObjects when done. The
+ * POD initial guess applies the operator once more per solve, i.e. it
+ * costs an extra sweep, which is included in the reported number of
+ * sweeps.*/
 bool LinearBoltzmann::Solver::GMRES(LBSGroupset& groupset,
                                     int group_set_num,
                                     MainSweepScheduler& sweep_scheduler,
                                     SourceFlags lhs_src_scope,
                                     SourceFlags rhs_src_scope,
-                                    bool log_info /* = true*/)
+                                    bool log_info /* = true*/,
+                                    bool reuse_krylov_objects /* = false*/)
 {
   constexpr bool WITH_DELAYED_PSI = true;
+  const bool amg_as_pc = not groupset.angular_multigrid_levels.empty();
+  const bool dsa_as_pc = (groupset.dsa_right_preconditioning or amg_as_pc) and
+                         (groupset.apply_wgdsa or groupset.apply_tgdsa);
+  const bool flexible  = dsa_as_pc and groupset.dsa_flexible_gmres;
   if (log_info)
   {
     chi_log.Log(LOG_0)
       << "\n\n";
     chi_log.Log(LOG_0)
       << "********** Solving groupset " << group_set_num
-      << " with GMRES.\n\n";
+      << " with " << (flexible? "FGMRES" : "GMRES")
+      << (amg_as_pc? " right-preconditioned with angular multigrid" :
+          (dsa_as_pc? " right-preconditioned with DSA" : ""))
+      << ".\n\n";
     chi_log.Log(LOG_0)
       << "Quadrature number of angles: "
       << groupset.quadrature->abscissae.size() << "\n"
@@ -55,46 +81,115 @@ bool LinearBoltzmann::Solver::GMRES(LBSGroupset& groupset,
     chi_log.Log(LOG_0)
       << "Number of angular unknowns: " << num_delayed_ang_DOFs.second;
 
-  //================================================== Create PETSc vectors
-  phi_new = chi_math::PETScUtils::CreateVector(static_cast<int64_t>(local_size),
-                                               static_cast<int64_t>(globl_size));
-  Vec x_temp;
-  VecSet(phi_new,0.0);
-  VecDuplicate(phi_new,&phi_old);
-  VecDuplicate(phi_new,&q_fixed);
-  VecDuplicate(phi_new,&x_temp);
-
-  //=================================================== Create Data context
-  //                                                    available inside
-  //                                                    Action
-  KSPDataContext data_context(*this, groupset, x_temp,
-                              sweep_scheduler, lhs_src_scope);
-
-  //=================================================== Create the matrix-shell
-  Mat A;
-  MatCreateShell(PETSC_COMM_WORLD,static_cast<int64_t>(local_size),
-                                  static_cast<int64_t>(local_size),
-                                  static_cast<int64_t>(globl_size),
-                                  static_cast<int64_t>(globl_size),
-                                  &data_context,&A);
-
-  //================================================== Set the action-operator
-  MatShellSetOperation(A, MATOP_MULT, (void (*)()) LBSMatrixAction_Ax);
-
-  //================================================== Create Krylov Solver
-  KSP ksp;
-  KSPCreate(PETSC_COMM_WORLD, &ksp);
-  KSPSetType(ksp,KSPGMRES);
-  KSPSetOperators(ksp,A,A);
+  //================================================== Drop incompatible
+  //                                                   persistent objects
+  if (gmres_krylov_objects and
+      not (reuse_krylov_objects and
+           gmres_krylov_objects->groupset == &groupset and
+           gmres_krylov_objects->sweep_scheduler == &sweep_scheduler and
+           gmres_krylov_objects->lhs_scope == lhs_src_scope))
+    DestroyGMRESKrylovObjects();
+
+  const bool reusing = (gmres_krylov_objects != nullptr);
+
+  //================================================== Create Krylov objects
+  if (not reusing)
+  {
+    gmres_krylov_objects = std::make_shared<GMRESKrylovObjects>();
+    auto& kobj = *gmres_krylov_objects;
+    kobj.groupset        = &groupset;
+    kobj.sweep_scheduler = &sweep_scheduler;
+    kobj.lhs_scope       = lhs_src_scope;
+
+    //=============================================== Create PETSc vectors
+    phi_new = chi_math::PETScUtils::CreateVector(static_cast<int64_t>(local_size),
+                                                 static_cast<int64_t>(globl_size));
+    VecSet(phi_new,0.0);
+    VecDuplicate(phi_new,&phi_old);
+    VecDuplicate(phi_new,&q_fixed);
+    VecDuplicate(phi_new,&kobj.x_temp);
+
+    //=============================================== Create Data context
+    //                                                available inside
+    //                                                Action
+    kobj.context = std::make_unique<KSPDataContext>(*this, groupset,
+                                                    kobj.x_temp,
+                                                    sweep_scheduler,
+                                                    lhs_src_scope);
+    if (dsa_as_pc)
+      kobj.context->dsa_in_operator = false;
+    if (dsa_as_pc or amg_as_pc)
+      kobj.context->zero_phi.assign(phi_old_local.size(), 0.0);
+
+    //=============================================== Create the matrix-shell
+    MatCreateShell(PETSC_COMM_WORLD,static_cast<int64_t>(local_size),
+                                    static_cast<int64_t>(local_size),
+                                    static_cast<int64_t>(globl_size),
+                                    static_cast<int64_t>(globl_size),
+                                    kobj.context.get(),&kobj.A);
+
+    //=============================================== Set the action-operator
+    MatShellSetOperation(kobj.A, MATOP_MULT, (void (*)()) LBSMatrixAction_Ax);
+
+    //=============================================== Create Krylov Solver
+    KSPCreate(PETSC_COMM_WORLD, &kobj.ksp);
+    KSPSetType(kobj.ksp,flexible? KSPFGMRES : KSPGMRES);
+    KSPSetOperators(kobj.ksp,kobj.A,kobj.A);
+
+    //=============================================== Set preconditioner
+    if (amg_as_pc)
+    {
+      PC pc;
+      KSPGetPC(kobj.ksp,&pc);
+      PCSetType(pc,PCSHELL);
+      PCShellSetContext(pc,kobj.context.get());
+      PCShellSetApply(pc,LBSPreconditionerAction_AngularMultigrid);
+      PCShellSetName(pc,"LBS-AngularMultigrid");
+      KSPSetPCSide(kobj.ksp,PC_RIGHT);
+    }
+    else if (dsa_as_pc)
+    {
+      PC pc;
+      KSPGetPC(kobj.ksp,&pc);
+      PCSetType(pc,PCSHELL);
+      PCShellSetContext(pc,kobj.context.get());
+      PCShellSetApply(pc,LBSPreconditionerAction_DSA);
+      PCShellSetName(pc,"LBS-DSA");
+      KSPSetPCSide(kobj.ksp,PC_RIGHT);
+    }
+
+    KSPGMRESSetRestart(kobj.ksp, groupset.gmres_restart_intvl);
+    KSPSetApplicationContext(kobj.ksp, kobj.context.get());
+    KSPSetConvergenceTest(kobj.ksp, &KSPConvergenceTestNPT, nullptr, nullptr);
+    KSPSetInitialGuessNonzero(kobj.ksp, PETSC_TRUE);
+
+    //=============================================== Recycle previous solutions
+    // The operator is unchanged between the solves, only the right-hand
+    // side is. The POD guess projects each new right-hand side onto the
+    // space spanned by the previous solutions to form the initial guess.
+    if (reuse_krylov_objects)
+    {
+      KSPGuess guess;
+      KSPGetGuess(kobj.ksp,&guess);
+      KSPGuessSetType(guess,KSPGUESSPOD);
+    }
+    KSPSetUp(kobj.ksp);
+  }
+
+  auto& kobj = *gmres_krylov_objects;
+  KSP ksp = kobj.ksp;
+  kobj.context->last_iteration = -1;
+  kobj.context->num_operator_applications = 0;
+  const size_t num_sweeps_before = sweep_scheduler.GetNumberOfSweeps();
 
   KSPSetTolerances(ksp,1.e-50,
                    groupset.residual_tolerance,1.0e50,
                    groupset.max_iterations);
-  KSPGMRESSetRestart(ksp, groupset.gmres_restart_intvl);
-  KSPSetApplicationContext(ksp, &data_context);
-  KSPSetConvergenceTest(ksp, &KSPConvergenceTestNPT, nullptr, nullptr);
-  KSPSetInitialGuessNonzero(ksp, PETSC_TRUE);
-  KSPSetUp(ksp);
+
+  if (log_info and reusing)
+    chi_log.Log(LOG_0)
+      << "Reusing Krylov objects from " << kobj.num_solves
+      << " previous solve(s).";
 
   //================================================== Compute b
   auto& sweep_chunk = sweep_scheduler.sweep_chunk;
@@ -117,15 +212,17 @@ bool LinearBoltzmann::Solver::GMRES(LBSGroupset& groupset,
   //Sweep
   phi_new_local.assign(phi_new_local.size(),0.0);
   sweep_scheduler.Sweep();
+  AllreduceReplicaFluxMoments(groupset, phi_new_local);
 
   //=================================================== Apply DSA
-  if (groupset.apply_wgdsa)
+  //The right-hand side is only preconditioned when DSA is in the operator
+  if (groupset.apply_wgdsa and not dsa_as_pc)
   {
     AssembleWGDSADeltaPhiVector(groupset, phi_old_local.data(), phi_new_local.data());
     ((chi_diffusion::Solver*)groupset.wgdsa_solver)->ExecuteS(true,false);
     DisAssembleWGDSADeltaPhiVector(groupset, phi_new_local.data());
   }
-  if (groupset.apply_tgdsa)
+  if (groupset.apply_tgdsa and not dsa_as_pc)
   {
     AssembleTGDSADeltaPhiVector(groupset, phi_old_local.data(), phi_new_local.data());
     ((chi_diffusion::Solver*)groupset.tgdsa_solver)->ExecuteS(true,false);
@@ -162,6 +259,10 @@ bool LinearBoltzmann::Solver::GMRES(LBSGroupset& groupset,
 
   KSPConvergedReason reason;
   KSPGetConvergedReason(ksp,&reason);
+
+  PetscInt num_krylov_iterations = 0;
+  KSPGetIterationNumber(ksp,&num_krylov_iterations);
+  num_inner_iterations += static_cast<size_t>(num_krylov_iterations);
   if (reason != KSP_CONVERGED_RTOL)
     chi_log.Log(LOG_0WARNING)
       << "GMRES solver failed. "
@@ -183,16 +284,21 @@ bool LinearBoltzmann::Solver::GMRES(LBSGroupset& groupset,
 
   phi_new_local.assign(phi_new_local.size(),0.0);
   sweep_scheduler.Sweep();
+  AllreduceReplicaFluxMoments(groupset, phi_new_local);
 
   ScopedCopySTLvectors(groupset, phi_new_local, phi_old_local);
 
+  // Includes the right-hand side sweep, the final sweep and the operator
+  // applications of the initial residual, restarts and POD initial guess
+  const size_t num_solve_sweeps =
+    sweep_scheduler.GetNumberOfSweeps() - num_sweeps_before;
+  const size_t num_operator_applications =
+    kobj.context->num_operator_applications;
+
   //==================================================== Clean up
-  KSPDestroy(&ksp);
-  VecDestroy(&phi_new);
-  VecDestroy(&phi_old);
-  VecDestroy(&q_fixed);
-  VecDestroy(&x_temp);
-  MatDestroy(&A);
+  ++kobj.num_solves;
+  if (not reuse_krylov_objects)
+    DestroyGMRESKrylovObjects();
 
   //==================================================== Print solution info
   {
@@ -225,6 +331,13 @@ bool LinearBoltzmann::Solver::GMRES(LBSGroupset& groupset,
            static_cast<double>(num_unknowns);
       chi_log.Log(LOG_0)
         << "        Number of unknowns per sweep:  " << num_unknowns;
+      chi_log.Log(LOG_0)
+        << "        Krylov iterations     :        " << num_krylov_iterations;
+      chi_log.Log(LOG_0)
+        << "        Operator applications :        "
+        << num_operator_applications;
+      chi_log.Log(LOG_0)
+        << "        Total number of sweeps:        " << num_solve_sweeps;
       chi_log.Log(LOG_0)
         << "\n\n";
 
@@ -240,4 +353,19 @@ bool LinearBoltzmann::Solver::GMRES(LBSGroupset& groupset,
   return reason == KSP_CONVERGED_RTOL;
 }
 
+//###################################################################
+/**Destroys the Krylov objects kept alive by GMRES.*/
+void LinearBoltzmann::Solver::DestroyGMRESKrylovObjects()
+{
+  if (not gmres_krylov_objects) return;
 
+  auto& kobj = *gmres_krylov_objects;
+  KSPDestroy(&kobj.ksp);
+  MatDestroy(&kobj.A);
+  VecDestroy(&kobj.x_temp);
+  VecDestroy(&phi_new);
+  VecDestroy(&phi_old);
+  VecDestroy(&q_fixed);
+
+  gmres_krylov_objects = nullptr;
+}
@@ -0,0 +1,252 @@
+#include "../lbs_linear_boltzmann_solver.h"
+
+#include "ChiMath/chi_math.h"
+
+#include "chi_log.h"
+extern ChiLog& chi_log;
+
+#include "chi_mpi.h"
+extern ChiMPI& chi_mpi;
+
+#include <deque>
+#include <limits>
+#include <cmath>
+
+//###################################################################
+/**Solves a groupset using Anderson accelerated source iteration.
+ *
+ * Each iteration applies the fixed-point operator G, i.e. a sweep followed
+ * by the optional WGDSA/TGDSA corrections, to the groupset flux moments
+ * x_k. With the residual f_k = G(x_k) - x_k, the differences of the last
+ * m residuals (dF) and of the last m values of G (dG) are kept, and the
+ * next iterate is
+ * \f[
+ *   x_{k+1} = G(x_k) - dG \gamma, \quad
+ *   \gamma = \arg\min \| f_k - dF \gamma \|_2.
+ * \f]
+ * The small least-squares problem is solved through its regularized
+ * normal equations, which requires a single reduction per iteration.
+ * Only 2m iterate-sized vectors are stored, m being
+ * groupset.anderson_depth.
+ *
+ * With cyclic dependencies or opposing reflecting boundaries the sweep
+ * also depends on the delayed angular fluxes of the previous sweep. These
+ * are then part of the iterate, i.e. they are mixed along with the flux
+ * moments, such that x_{k+1} is a consistent fixed-point iterate.*/
+bool LinearBoltzmann::Solver::Anderson(LBSGroupset& groupset,
+                                       int group_set_num,
+                                       MainSweepScheduler& sweep_scheduler,
+                                       SourceFlags source_flags,
+                                       bool log_info /* = true*/)
+{
+  if (log_info)
+  {
+    chi_log.Log(LOG_0) << "\n\n";
+    chi_log.Log(LOG_0) << "********** Solving groupset" << group_set_num
+                       << " with Anderson accelerated Richardson"
+                       << " (depth " << groupset.anderson_depth << ").\n\n";
+    chi_log.Log(LOG_0)
+      << "Quadrature number of angles: "
+      << groupset.quadrature->abscissae.size() << "\n"
+      << "Groups " << groupset.groups.front().id << " "
+      << groupset.groups.back().id << "\n\n";
+  }
+
+  const int    gsi   = groupset.groups.front().id;
+  const size_t gss   = groupset.groups.size();
+  const size_t depth = static_cast<size_t>(std::max(groupset.anderson_depth,1));
+
+  //================================================== Groupset packing
+  auto PackGroupsetMoments = [this,gsi,gss](const std::vector<double>& src,
+                                            std::vector<double>& dest)
+  {
+    dest.clear();
+    for (const auto& cell : grid->local_cells)
+    {
+      auto& transport_view = cell_transport_views[cell.local_id];
+      for (int i=0; i < transport_view.NumNodes(); ++i)
+        for (int m=0; m < transport_view.NumMoments(); ++m)
+        {
+          size_t mapping = transport_view.MapDOF(i,m,gsi);
+          for (size_t g=0; g<gss; ++g)
+            dest.push_back(src[mapping+g]);
+        }
+    }
+  };
+
+  auto UnpackGroupsetMoments = [this,gsi,gss](const std::vector<double>& src,
+                                              std::vector<double>& dest)
+  {
+    size_t k=0;
+    for (const auto& cell : grid->local_cells)
+    {
+      auto& transport_view = cell_transport_views[cell.local_id];
+      for (int i=0; i < transport_view.NumNodes(); ++i)
+        for (int m=0; m < transport_view.NumMoments(); ++m)
+        {
+          size_t mapping = transport_view.MapDOF(i,m,gsi);
+          for (size_t g=0; g<gss; ++g)
+            dest[mapping+g] = src[k++];
+        }
+    }
+    return k;
+  };
+
+  //================================================== Iterate packing
+  // The flux moments of the groupset followed by the delayed angular
+  // fluxes, if any
+  const bool with_delayed_psi =
+    groupset.angle_agg.GetNumDelayedAngularDOFs().second > 0;
+
+  auto PackIterate = [&](std::vector<double>& dest)
+  {
+    PackGroupsetMoments(phi_old_local, dest);
+    if (with_delayed_psi)
+    {
+      auto psi = groupset.angle_agg.GetDelayedAngularDOFsAsSTLVector();
+      dest.insert(dest.end(), psi.begin(), psi.end());
+    }
+  };
+
+  auto UnpackIterate = [&](const std::vector<double>& src)
+  {
+    size_t num_phi = UnpackGroupsetMoments(src, phi_old_local);
+    if (with_delayed_psi)
+      groupset.angle_agg.SetDelayedAngularDOFsFromSTLVector(
+        std::vector<double>(src.begin() + num_phi, src.end()));
+  };
+
+  std::vector<double> init_q_moments_local = q_moments_local;
+
+  groupset.angle_agg.ZeroIncomingDelayedPsi();
+
+  //================================================== Tool the sweep chunk
+  sweep_scheduler.sweep_chunk.SetDestinationPhi(phi_new_local);
+  sweep_scheduler.sweep_chunk.SetSurfaceSourceActiveFlag(source_flags & APPLY_MATERIAL_SOURCE);
+
+  //================================================== History
+  std::deque<std::vector<double>> delta_f;
+  std::deque<std::vector<double>> delta_g;
+  std::vector<double> x, g, f, f_prev, g_prev;
+
+  //================================================== Now start iterating
+  double pw_change_prev = 1.0;
+  bool converged = false;
+  for (int k = 0; k < groupset.max_iterations; ++k)
+  {
+    //=========================================== Fixed-point operator,
+    //                                            x -> G(x)
+    PackIterate(x);
+
+    std::string history_info =
+      " Anderson history " + std::to_string(delta_f.size());
+    converged = RichardsonIteration(groupset, sweep_scheduler,
+                                    init_q_moments_local, source_flags,
+                                    k, pw_change_prev, log_info,
+                                    history_info);
+    if (converged) break;
+
+    //=========================================== Residual f = G(x) - x
+    PackIterate(g);
+    f.resize(g.size());
+    for (size_t i=0; i<g.size(); ++i)
+      f[i] = g[i] - x[i];
+
+    //======================================== Update history
+    if (k > 0)
+    {
+      std::vector<double> df(f.size()), dg(g.size());
+      for (size_t i=0; i<f.size(); ++i)
+      {
+        df[i] = f[i] - f_prev[i];
+        dg[i] = g[i] - g_prev[i];
+      }
+      delta_f.push_back(std::move(df));
+      delta_g.push_back(std::move(dg));
+      if (delta_f.size() > depth)
+      {
+        delta_f.pop_front();
+        delta_g.pop_front();
+      }
+    }
+    f_prev = f;
+    g_prev = g;
+
+    const size_t m = delta_f.size();
+    if (m == 0) continue;
+
+    //======================================== Build normal equations
+    // Packed as [dF^T dF (m x m), dF^T f (m)]
+    std::vector<double> local_products(m*m + m, 0.0);
+    for (size_t i=0; i<m; ++i)
+    {
+      for (size_t j=i; j<m; ++j)
+      {
+        double dot = 0.0;
+        for (size_t n=0; n<f.size(); ++n)
+          dot += delta_f[i][n]*delta_f[j][n];
+        local_products[i*m + j] = dot;
+        local_products[j*m + i] = dot;
+      }
+      double dot = 0.0;
+      for (size_t n=0; n<f.size(); ++n)
+        dot += delta_f[i][n]*f[n];
+      local_products[m*m + i] = dot;
+    }
+
+    std::vector<double> products(m*m + m, 0.0);
+    MPI_Allreduce(local_products.data(), products.data(),
+                  static_cast<int>(products.size()), MPI_DOUBLE, MPI_SUM,
+                  chi_mpi.comm);
+
+    MatDbl A(m, VecDbl(m, 0.0));
+    VecDbl gamma(m, 0.0);
+    double max_diag = 0.0;
+    for (size_t i=0; i<m; ++i)
+    {
+      for (size_t j=0; j<m; ++j)
+        A[i][j] = products[i*m + j];
+      gamma[i] = products[m*m + i];
+      max_diag = std::max(max_diag, A[i][i]);
+    }
+
+    //======================================== Solve least squares
+    // A stagnated history (zero differences) carries no information
+    if (max_diag <= std::numeric_limits<double>::min())
+    {
+      delta_f.clear();
+      delta_g.clear();
+      continue;
+    }
+    for (size_t i=0; i<m; ++i)
+      A[i][i] += 1.0e-12*max_diag;
+
+    chi_math::GaussElimination(A, gamma, static_cast<int>(m));
+
+    bool gamma_finite = true;
+    for (double val : gamma)
+      if (not std::isfinite(val)) gamma_finite = false;
+
+    if (not gamma_finite)
+    {
+      chi_log.Log(LOG_0VERBOSE_1)
+        << "Anderson: Ill-conditioned history. Restarting.";
+      delta_f.clear();
+      delta_g.clear();
+      continue;
+    }
+
+    //======================================== Mix x = G(x) - dG gamma
+    std::vector<double> x_new = g;
+    for (size_t i=0; i<m; ++i)
+      for (size_t n=0; n<x_new.size(); ++n)
+        x_new[n] -= gamma[i]*delta_g[i][n];
+
+    UnpackIterate(x_new);
+  }//for k
+
+  if (log_info)
+    LogRichardsonSolveInfo(groupset, group_set_num, sweep_scheduler);
+
+  return converged;
+}
@@ -46,43 +46,81 @@ bool LinearBoltzmann::Solver::ClassicRichardson(LBSGroupset& groupset,
   bool converged = false;
   for (int k = 0; k < groupset.max_iterations; ++k)
   {
-    q_moments_local = init_q_moments_local;
-    SetSource(groupset, q_moments_local, source_flags);
+    converged = RichardsonIteration(groupset, sweep_scheduler,
+                                    init_q_moments_local, source_flags,
+                                    k, pw_change_prev, log_info);
+    if (converged) break;
+  }
 
-    groupset.ZeroAngularFluxDataStructures();
-    phi_new_local.assign(phi_new_local.size(),0.0); //Ensure phi_new=0.0
-    sweep_scheduler.Sweep();
+  if (log_info)
+    LogRichardsonSolveInfo(groupset, group_set_num, sweep_scheduler);
 
-    if (groupset.apply_wgdsa)
-    {
-      AssembleWGDSADeltaPhiVector(groupset, phi_old_local.data(), phi_new_local.data());
-      ((chi_diffusion::Solver*)groupset.wgdsa_solver)->ExecuteS(true,false);
-      DisAssembleWGDSADeltaPhiVector(groupset, phi_new_local.data());
-    }
-    if (groupset.apply_tgdsa)
-    {
-      AssembleTGDSADeltaPhiVector(groupset, phi_old_local.data(), phi_new_local.data());
-      ((chi_diffusion::Solver*)groupset.tgdsa_solver)->ExecuteS(true,false);
-      DisAssembleTGDSADeltaPhiVector(groupset, phi_new_local.data());
-    }
+  return converged;
+}
+
+//###################################################################
+/**Performs a single Richardson iteration of a groupset. The sources are
+ * set from the initial source moments and phi_old_local, followed by a
+ * sweep into phi_new_local and the optional angular multigrid, WGDSA and
+ * TGDSA corrections. The groupset part of phi_new_local is then copied to
+ * phi_old_local, and the convergence is checked from the point-wise
+ * change, relative to the previous change pw_change_prev, which is
+ * updated. The iteration information is logged with an optional suffix,
+ * and restart data is written when due.
+ *
+ * \return true if the groupset converged.*/
+bool LinearBoltzmann::Solver::
+  RichardsonIteration(LBSGroupset& groupset,
+                      MainSweepScheduler& sweep_scheduler,
+                      const std::vector<double>& init_q_moments_local,
+                      SourceFlags source_flags,
+                      int k,
+                      double& pw_change_prev,
+                      bool log_info,
+                      const std::string& info_suffix/*=""*/)
+{
+  q_moments_local = init_q_moments_local;
+  SetSource(groupset, q_moments_local, source_flags);
+
+  groupset.ZeroAngularFluxDataStructures();
+  phi_new_local.assign(phi_new_local.size(),0.0); //Ensure phi_new=0.0
+  sweep_scheduler.Sweep();
+  ++num_inner_iterations;
+  AllreduceReplicaFluxMoments(groupset, phi_new_local);
 
-    double pw_change = ComputePiecewiseChange(groupset);
+  ApplyAngularMultigrid(groupset, phi_old_local, phi_new_local);
+
+  if (groupset.apply_wgdsa)
+  {
+    AssembleWGDSADeltaPhiVector(groupset, phi_old_local.data(), phi_new_local.data());
+    ((chi_diffusion::Solver*)groupset.wgdsa_solver)->ExecuteS(true,false);
+    DisAssembleWGDSADeltaPhiVector(groupset, phi_new_local.data());
+  }
+  if (groupset.apply_tgdsa)
+  {
+    AssembleTGDSADeltaPhiVector(groupset, phi_old_local.data(), phi_new_local.data());
+    ((chi_diffusion::Solver*)groupset.tgdsa_solver)->ExecuteS(true,false);
+    DisAssembleTGDSADeltaPhiVector(groupset, phi_new_local.data());
+  }
 
-    ScopedCopySTLvectors(groupset, phi_new_local, phi_old_local);
+  double pw_change = ComputePiecewiseChange(groupset);
 
-    double rho = sqrt(pw_change / pw_change_prev);
-    pw_change_prev = pw_change;
+  ScopedCopySTLvectors(groupset, phi_new_local, phi_old_local);
 
-    if (k==0) rho = 0.0;
+  double rho = sqrt(pw_change / pw_change_prev);
+  pw_change_prev = pw_change;
 
-    if (pw_change<std::max(groupset.residual_tolerance*(1.0-rho),1.0e-10))
-      converged = true;
+  if (k==0) rho = 0.0;
 
-    //======================================== Print iteration information
-    {
-      std::string offset;
-      if (groupset.apply_wgdsa || groupset.apply_tgdsa)
-        offset = std::string("    ");
+  bool converged = false;
+  if (pw_change<std::max(groupset.residual_tolerance*(1.0-rho),1.0e-10))
+    converged = true;
+
+  //======================================== Print iteration information
+  {
+    std::string offset;
+    if (groupset.apply_wgdsa || groupset.apply_tgdsa)
+      offset = std::string("    ");
 
     std::stringstream iter_info;
     iter_info
@@ -95,67 +133,69 @@ bool LinearBoltzmann::Solver::ClassicRichardson(LBSGroupset& groupset,
       << "]"
       << " Iteration " << std::setw(5) << k
       << " Point-wise change " << std::setw(14) << pw_change
-      <<" Spectral Radius Estimate " << std::setw(10) << rho;
-
-      if (converged)
-        iter_info << " CONVERGED\n";
+      <<" Spectral Radius Estimate " << std::setw(10) << rho
+      << info_suffix;
 
-      if (log_info)
-        chi_log.Log(LOG_0) << iter_info.str();
+    if (converged)
+      iter_info << " CONVERGED\n";
 
-      if (converged) break;
-
-      if (options.write_restart_data)
-      {
-        if ((chi_program_timer.GetTime()/60000.0) >
-            last_restart_write+options.write_restart_interval)
-        {
-          last_restart_write = chi_program_timer.GetTime()/60000.0;
-          WriteRestartData(options.write_restart_folder_name,
-                           options.write_restart_file_base);
-        }
-      }//if write restart data
-    }//print iterative info
-
-  }
+    if (log_info)
+      chi_log.Log(LOG_0) << iter_info.str();
 
-  //============================================= Print solution info
-  {
-    double sweep_time = sweep_scheduler.GetAverageSweepTime();
-    double source_time=
-      chi_log.ProcessEvent(source_event_tag,
-                           ChiLog::EventOperation::AVERAGE_DURATION);
-    size_t num_angles = groupset.quadrature->abscissae.size();
-    size_t num_unknowns = glob_node_count *
-                          num_angles *
-                          groupset.groups.size();
+    if (converged) return converged;
 
-    if (log_info)
+    if (options.write_restart_data)
     {
-      chi_log.Log(LOG_0)
-        << "\n\n";
-      chi_log.Log(LOG_0)
-        << "        Set Src Time/sweep (s):        "
-        << source_time;
-      chi_log.Log(LOG_0)
-        << "        Average sweep time (s):        "
-        << sweep_time;
-      chi_log.Log(LOG_0)
-        << "        Sweep Time/Unknown (ns):       "
-        << sweep_time*1.0e9*chi_mpi.process_count/
-            static_cast<double>(num_unknowns);
-      chi_log.Log(LOG_0)
-        << "        Number of unknowns per sweep:  " << num_unknowns;
-      chi_log.Log(LOG_0)
-        << "\n\n";
-
-      std::string sweep_log_file_name =
-          std::string("GS_") + std::to_string(group_set_num) +
-          std::string("_SweepLog_") + std::to_string(chi_mpi.location_id) +
-          std::string(".log");
-      groupset.PrintSweepInfoFile(sweep_scheduler.sweep_event_tag, sweep_log_file_name);
-    }
-  }//print solution info
+      if ((chi_program_timer.GetTime()/60000.0) >
+          last_restart_write+options.write_restart_interval)
+      {
+        last_restart_write = chi_program_timer.GetTime()/60000.0;
+        WriteRestartData(options.write_restart_folder_name,
+                         options.write_restart_file_base);
+      }
+    }//if write restart data
+  }//print iterative info
 
   return converged;
 }
+
+//###################################################################
+/**Logs the timing information of a Richardson groupset solve and
+ * writes the sweep log file.*/
+void LinearBoltzmann::Solver::
+  LogRichardsonSolveInfo(LBSGroupset& groupset,
+                         int group_set_num,
+                         MainSweepScheduler& sweep_scheduler)
+{
+  double sweep_time = sweep_scheduler.GetAverageSweepTime();
+  double source_time=
+    chi_log.ProcessEvent(source_event_tag,
+                         ChiLog::EventOperation::AVERAGE_DURATION);
+  size_t num_angles = groupset.quadrature->abscissae.size();
+  size_t num_unknowns = glob_node_count *
+                        num_angles *
+                        groupset.groups.size();
+
+  chi_log.Log(LOG_0)
+    << "\n\n";
+  chi_log.Log(LOG_0)
+    << "        Set Src Time/sweep (s):        "
+    << source_time;
+  chi_log.Log(LOG_0)
+    << "        Average sweep time (s):        "
+    << sweep_time;
+  chi_log.Log(LOG_0)
+    << "        Sweep Time/Unknown (ns):       "
+    << sweep_time*1.0e9*chi_mpi.process_count/
+        static_cast<double>(num_unknowns);
+  chi_log.Log(LOG_0)
+    << "        Number of unknowns per sweep:  " << num_unknowns;
+  chi_log.Log(LOG_0)
+    << "\n\n";
+
+  std::string sweep_log_file_name =
+      std::string("GS_") + std::to_string(group_set_num) +
+      std::string("_SweepLog_") + std::to_string(chi_mpi.location_id) +
+      std::string(".log");
+  groupset.PrintSweepInfoFile(sweep_scheduler.sweep_event_tag, sweep_log_file_name);
+}
@@ -9,7 +9,9 @@ namespace LinearBoltzmann
     CLASSICRICHARDSON        = 1, ///< Otherwise known as Source Iteration
     CLASSICRICHARDSON_CYCLES = 2, ///< Source Iteration with Cycles support
     GMRES                    = 3, ///< GMRES iterative algorithm
-    GMRES_CYCLES             = 4  ///< GMRES with Cycles support
+    GMRES_CYCLES             = 4, ///< GMRES with Cycles support
+    ANDERSON                 = 5, ///< Anderson accelerated Source Iteration
+    ANDERSON_CYCLES          = 6  ///< Anderson with Cycles support
   };
 }
 
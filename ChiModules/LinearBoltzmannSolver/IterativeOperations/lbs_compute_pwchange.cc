@@ -1,9 +1,27 @@
 #include "../lbs_linear_boltzmann_solver.h"
 #include <ChiMesh/Cell/cell.h>
 
+#include "chi_mpi.h"
+extern ChiMPI& chi_mpi;
+
 //###################################################################
 /**Computes the point wise change between phi_new and phi_old.*/
 double LinearBoltzmann::Solver::ComputePiecewiseChange(LBSGroupset& groupset)
+{
+  double pw_change = ComputeLocalPiecewiseChange(groupset);
+
+  double global_pw_change = 0.0;
+
+  MPI_Allreduce(&pw_change,&global_pw_change,1,MPI_DOUBLE,MPI_MAX,chi_mpi.comm);
+
+  return global_pw_change;
+}
+
+//###################################################################
+/**Computes the point wise change between phi_new and phi_old on this
+ * location only. No communication is performed.*/
+double LinearBoltzmann::Solver::
+  ComputeLocalPiecewiseChange(LBSGroupset& groupset)
 {
   double pw_change = 0.0;
   double sum_m0 = 0.0;
@@ -18,7 +36,7 @@ double LinearBoltzmann::Solver::ComputePiecewiseChange(LBSGroupset& groupset)
 
     for (int i=0; i < cell.vertex_ids.size(); i++)
     {
-      for (int m=0; m<num_moments; m++)
+      for (int m=0; m<transport_view.NumMoments(); m++)
       {
         size_t mapping = transport_view.MapDOF(i,m,gsi);
         double* phi_new_m = &phi_new_local.data()[mapping];
@@ -51,9 +69,5 @@ double LinearBoltzmann::Solver::ComputePiecewiseChange(LBSGroupset& groupset)
 //  const real8 pw_change = (maxv >= std::numeric_limits<real8>::min()) ?
 //                          (diff / maxv) : diff;
 
-  double global_pw_change = 0.0;
-
-  MPI_Allreduce(&pw_change,&global_pw_change,1,MPI_DOUBLE,MPI_MAX,MPI_COMM_WORLD);
-
-  return global_pw_change;
+  return pw_change;
 }
\ No newline at end of file
@@ -33,9 +33,11 @@ int LinearBoltzmann::LBSMatrixAction_Ax(Mat matrix, Vec krylov_vector, Vec Ax)
   groupset.ZeroAngularFluxDataStructures();
   solver.phi_new_local.assign(solver.phi_new_local.size(),0.0);
   sweepScheduler.Sweep();
+  ++context->num_operator_applications;
+  solver.AllreduceReplicaFluxMoments(groupset, solver.phi_new_local);
 
   //=================================================== Apply WGDSA
-  if (groupset.apply_wgdsa)
+  if (groupset.apply_wgdsa and context->dsa_in_operator)
   {
     solver.AssembleWGDSADeltaPhiVector(groupset,
                                        solver.phi_old_local.data(),
@@ -44,7 +46,7 @@ int LinearBoltzmann::LBSMatrixAction_Ax(Mat matrix, Vec krylov_vector, Vec Ax)
     solver.DisAssembleWGDSADeltaPhiVector(groupset,
                                           solver.phi_new_local.data());
   }
-  if (groupset.apply_tgdsa)
+  if (groupset.apply_tgdsa and context->dsa_in_operator)
   {
     solver.AssembleTGDSADeltaPhiVector(groupset,
                                        solver.phi_old_local.data(),
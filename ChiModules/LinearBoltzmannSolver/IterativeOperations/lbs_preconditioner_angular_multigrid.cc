@@ -0,0 +1,56 @@
+#include "lbs_preconditioner_angular_multigrid.h"
+#include "../Tools/ksp_data_context.h"
+
+#include "../../DiffusionSolver/Solver/diffusion_solver.h"
+
+//###################################################################
+/**Applies the angular multigrid operator to a vector, i.e.
+ * Px = x + C sigma_s x, where C is the coarse angular sawtooth cycle of
+ * ApplyAngularMultigrid with a zero reference (old) flux. When DSA is not
+ * part of the Krylov operator, the DSA correction is applied afterwards
+ * to the angular multigrid corrected vector. Delayed angular flux entries
+ * are passed through unchanged.*/
+int LinearBoltzmann::LBSPreconditionerAction_AngularMultigrid(PC preconditioner,
+                                                              Vec x, Vec Px)
+{
+  constexpr bool WITH_DELAYED_PSI = true;
+  KSPDataContext* context;
+  PCShellGetContext(preconditioner,(void**)&context);
+
+  //Shorten some names
+  LinearBoltzmann::Solver& solver = context->solver;
+  LBSGroupset& groupset  = context->groupset;
+  std::vector<double>& zero_phi = context->zero_phi;
+
+  //============================================= Copy vector into local
+  solver.SetSTLvectorFromPETScVec(groupset, x,
+                                  solver.phi_new_local, WITH_DELAYED_PSI);
+
+  //=================================================== Apply angular MG
+  solver.ApplyAngularMultigrid(groupset, zero_phi, solver.phi_new_local);
+
+  //=================================================== Apply DSA
+  if (groupset.apply_wgdsa and not context->dsa_in_operator)
+  {
+    solver.AssembleWGDSADeltaPhiVector(groupset,
+                                       zero_phi.data(),
+                                       solver.phi_new_local.data());
+    ((chi_diffusion::Solver*)groupset.wgdsa_solver)->ExecuteS(true,false);
+    solver.DisAssembleWGDSADeltaPhiVector(groupset,
+                                          solver.phi_new_local.data());
+  }
+  if (groupset.apply_tgdsa and not context->dsa_in_operator)
+  {
+    solver.AssembleTGDSADeltaPhiVector(groupset,
+                                       zero_phi.data(),
+                                       solver.phi_new_local.data());
+    ((chi_diffusion::Solver*)groupset.tgdsa_solver)->ExecuteS(true,false);
+    solver.DisAssembleTGDSADeltaPhiVector(groupset,
+                                          solver.phi_new_local.data());
+  }
+
+  solver.SetPETScVecFromSTLvector(groupset, Px,
+                                  solver.phi_new_local, WITH_DELAYED_PSI);
+
+  return 0;
+}
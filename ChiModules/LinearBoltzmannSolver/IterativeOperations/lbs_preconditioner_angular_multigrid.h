@@ -0,0 +1,13 @@
+#ifndef LBS_PRECONDITIONER_ANGULAR_MULTIGRID_H
+#define LBS_PRECONDITIONER_ANGULAR_MULTIGRID_H
+
+#include "LinearBoltzmannSolver/lbs_linear_boltzmann_solver.h"
+#include <petscksp.h>
+
+namespace LinearBoltzmann
+{
+int LBSPreconditionerAction_AngularMultigrid(PC preconditioner, Vec x, Vec Px);
+}
+
+
+#endif
@@ -0,0 +1,52 @@
+#include "lbs_preconditioner_dsa.h"
+#include "../Tools/ksp_data_context.h"
+
+#include "../../DiffusionSolver/Solver/diffusion_solver.h"
+
+//###################################################################
+/**Applies the diffusion synthetic acceleration operator to a vector,
+ * i.e. Px = x + D^{-1} sigma_s x, where D^{-1} is the WGDSA and/or TGDSA
+ * diffusion solve. This is the same correction that is otherwise applied
+ * inside the Krylov operator, except that the reference (old) flux is
+ * zero. Delayed angular flux entries are passed through unchanged.*/
+int LinearBoltzmann::LBSPreconditionerAction_DSA(PC preconditioner,
+                                                 Vec x, Vec Px)
+{
+  constexpr bool WITH_DELAYED_PSI = true;
+  KSPDataContext* context;
+  PCShellGetContext(preconditioner,(void**)&context);
+
+  //Shorten some names
+  LinearBoltzmann::Solver& solver = context->solver;
+  LBSGroupset& groupset  = context->groupset;
+  std::vector<double>& zero_phi = context->zero_phi;
+
+  //============================================= Copy vector into local
+  solver.SetSTLvectorFromPETScVec(groupset, x,
+                                  solver.phi_new_local, WITH_DELAYED_PSI);
+
+  //=================================================== Apply WGDSA
+  if (groupset.apply_wgdsa)
+  {
+    solver.AssembleWGDSADeltaPhiVector(groupset,
+                                       zero_phi.data(),
+                                       solver.phi_new_local.data());
+    ((chi_diffusion::Solver*)groupset.wgdsa_solver)->ExecuteS(true,false);
+    solver.DisAssembleWGDSADeltaPhiVector(groupset,
+                                          solver.phi_new_local.data());
+  }
+  if (groupset.apply_tgdsa)
+  {
+    solver.AssembleTGDSADeltaPhiVector(groupset,
+                                       zero_phi.data(),
+                                       solver.phi_new_local.data());
+    ((chi_diffusion::Solver*)groupset.tgdsa_solver)->ExecuteS(true,false);
+    solver.DisAssembleTGDSADeltaPhiVector(groupset,
+                                          solver.phi_new_local.data());
+  }
+
+  solver.SetPETScVecFromSTLvector(groupset, Px,
+                                  solver.phi_new_local, WITH_DELAYED_PSI);
+
+  return 0;
+}
@@ -0,0 +1,13 @@
+#ifndef LBS_PRECONDITIONER_DSA_H
+#define LBS_PRECONDITIONER_DSA_H
+
+#include "LinearBoltzmannSolver/lbs_linear_boltzmann_solver.h"
+#include <petscksp.h>
+
+namespace LinearBoltzmann
+{
+int LBSPreconditionerAction_DSA(PC preconditioner, Vec x, Vec Px);
+}
+
+
+#endif
@@ -0,0 +1,92 @@
+#include "../lbs_linear_boltzmann_solver.h"
+
+#include "chi_mpi.h"
+extern ChiMPI& chi_mpi;
+
+//###################################################################
+/**Determines whether a groupset subset is swept by this location's
+ * replica. Group subsets are distributed round-robin over the replicated
+ * spatial domains, unless the replicas decompose the angular domain.*/
+bool LinearBoltzmann::Solver::IsGroupSubsetLocal(size_t subset) const
+{
+  if (options.angle_domain_decomposition) return true;
+
+  return static_cast<int>(subset % chi_mpi.num_replicas) == chi_mpi.replica_id;
+}
+
+//###################################################################
+/**Determines whether an angular subset is swept by this location's
+ * replica when the replicas decompose the angular domain. An angular
+ * subset is an angle set group (quadrant or octant) for product
+ * quadratures and a single direction otherwise. Angular subsets are
+ * distributed round-robin over the replicated spatial domains.*/
+bool LinearBoltzmann::Solver::IsAngularSubsetLocal(size_t angular_subset) const
+{
+  if (not options.angle_domain_decomposition) return true;
+
+  return static_cast<int>(angular_subset % chi_mpi.num_replicas) ==
+         chi_mpi.replica_id;
+}
+
+//###################################################################
+/**Sums a groupset's flux moments over all the replicas of this
+ * location's spatial subdomain. After a sweep each replica only holds the
+ * moments of the group subsets it swept, or the partial moments of the
+ * angles it swept (the rest being zero). The sum therefore gives every
+ * replica the complete groupset moments, which also carry the
+ * within-groupset scattering coupling for the next source.*/
+void LinearBoltzmann::Solver::
+  AllreduceReplicaFluxMoments(LBSGroupset& groupset, std::vector<double>& phi)
+{
+  if (chi_mpi.num_replicas == 1) return;
+
+  const int gsi = groupset.groups.front().id;
+  const size_t gss = groupset.groups.size();
+
+  //============================================= Pack groupset entries
+  std::vector<double> buffer;
+  buffer.reserve(local_node_count*num_moments*gss);
+  for (const auto& cell : grid->local_cells)
+  {
+    auto& transport_view = cell_transport_views[cell.local_id];
+    for (int i=0; i < transport_view.NumNodes(); ++i)
+      for (int m=0; m < transport_view.NumMoments(); ++m)
+      {
+        size_t mapping = transport_view.MapDOF(i,m,gsi);
+        for (size_t g=0; g<gss; ++g)
+          buffer.push_back(phi[mapping+g]);
+      }
+  }
+
+  MPI_Allreduce(MPI_IN_PLACE, buffer.data(), static_cast<int>(buffer.size()),
+                MPI_DOUBLE, MPI_SUM, chi_mpi.replica_comm);
+
+  //============================================= Unpack
+  size_t k=0;
+  for (const auto& cell : grid->local_cells)
+  {
+    auto& transport_view = cell_transport_views[cell.local_id];
+    for (int i=0; i < transport_view.NumNodes(); ++i)
+      for (int m=0; m < transport_view.NumMoments(); ++m)
+      {
+        size_t mapping = transport_view.MapDOF(i,m,gsi);
+        for (size_t g=0; g<gss; ++g)
+          phi[mapping+g] = buffer[k++];
+      }
+  }
+}
+
+//###################################################################
+/**Sums a groupset's saved angular fluxes over all the replicas of this
+ * location's spatial subdomain so that each replica holds the angular
+ * fluxes of all the groups.*/
+void LinearBoltzmann::Solver::
+  AllreduceReplicaAngularFluxes(LBSGroupset& groupset)
+{
+  if (chi_mpi.num_replicas == 1) return;
+  if (groupset.psi_new_local.empty()) return;
+
+  MPI_Allreduce(MPI_IN_PLACE, groupset.psi_new_local.data(),
+                static_cast<int>(groupset.psi_new_local.size()),
+                MPI_DOUBLE, MPI_SUM, chi_mpi.replica_comm);
+}
@@ -73,7 +73,7 @@ SetSource(LBSGroupset& groupset,
     for (int i = 0; i < num_nodes; ++i)
     {
       //============================== Loop over moments
-      for (int m = 0; m < num_moments; ++m)
+      for (int m = 0; m < full_cell_view.NumMoments(); ++m)
       {
         unsigned int ell = m_to_ell_em_map[m].ell;
 
@@ -75,7 +75,9 @@ void LinearBoltzmann::SweepChunkPWL::
     const int num_nodes = static_cast<int>(fe_intgrl_values.NumNodes());
     auto& transport_view = grid_transport_view[cell.local_id];
     const int xs_mapping = transport_view.XSMapping();
+    const int num_cell_moms = transport_view.NumMoments();
     const auto& sigma_tg = xsections[xs_mapping]->sigma_t;
+    const bool tally_currents = transport_view.TalliesFaceCurrents();
     std::vector<bool> face_incident_flags(num_faces, false);
     std::vector<double> face_mu_values(num_faces, 0.0);
 
@@ -133,6 +135,10 @@ void LinearBoltzmann::SweepChunkPWL::
                 Amat[i][j] += mu_Nij;
                 for (int gsg = 0; gsg < gs_ss_size; ++gsg)
                   b[gsg][i] += psi[gsg]*mu_Nij;
+                if (tally_currents and fi == 0)
+                  for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+                    transport_view.AddFaceCurrent(f, gs_gi + gsg,
+                                                  wt*mu*psi[gsg]*IntS_shapeI[f][j]);
               }
             }
           }
@@ -150,6 +156,10 @@ void LinearBoltzmann::SweepChunkPWL::
                 Amat[i][j] += mu_Nij;
                 for (int gsg = 0; gsg < gs_ss_size; ++gsg)
                   b[gsg][i] += psi[gsg]*mu_Nij;
+                if (tally_currents and fi == 0)
+                  for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+                    transport_view.AddFaceCurrent(f, gs_gi + gsg,
+                                                  wt*mu*psi[gsg]*IntS_shapeI[f][j]);
               }
             }
           }
@@ -177,6 +187,10 @@ void LinearBoltzmann::SweepChunkPWL::
                 Amat[i][j] += mu_Nij;
                 for (int gsg = 0; gsg < gs_ss_size; ++gsg)
                   b[gsg][i] += psi[gsg]*mu_Nij;
+                if (tally_currents and fi == 0)
+                  for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+                    transport_view.AddFaceCurrent(f, gs_gi + gsg,
+                                                  wt*mu*psi[gsg]*IntS_shapeI[f][j]);
               }
             }
           }
@@ -192,7 +206,7 @@ void LinearBoltzmann::SweepChunkPWL::
         for (int i = 0; i < num_nodes; ++i)
         {
           double temp_src = 0.0;
-          for (int m = 0; m < num_moms; ++m)
+          for (int m = 0; m < num_cell_moms; ++m)
           {
             const size_t ir = transport_view.MapDOF(i, m, g);
             temp_src += m2d_op[m][angle_num]*q_moments[ir];
@@ -219,7 +233,7 @@ void LinearBoltzmann::SweepChunkPWL::
       }
 
       // ============================= Accumulate flux
-      for (int m = 0; m < num_moms; ++m)
+      for (int m = 0; m < num_cell_moms; ++m)
       {
         const double wn_d2m = d2m_op[m][angle_num];
         for (int i = 0; i < num_nodes; ++i)
@@ -258,7 +272,16 @@ void LinearBoltzmann::SweepChunkPWL::
         const bool local = transport_view.IsFaceLocal(f);
         const bool boundary = not face.has_neighbor;
         const size_t num_face_indices = face.vertex_ids.size();
-        const std::vector<double>& IntF_shapeI = IntS_shapeI[f];
+        const auto IntF_shapeI = IntS_shapeI[f];
+
+        if (tally_currents)
+          for (int fi = 0; fi < num_face_indices; ++fi)
+          {
+            const int i = fe_intgrl_values.FaceDofMapping(f,fi);
+            for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+              transport_view.AddFaceCurrent(f, gs_gi + gsg,
+                                            wt*mu*b[gsg][i]*IntF_shapeI[i]);
+          }
 
         if (local)
         {
@@ -0,0 +1,297 @@
+#include "lbs_sweepchunk_pwl_multirhs.h"
+
+#include "chi_log.h"
+extern ChiLog& chi_log;
+
+#include "chi_mpi.h"
+extern ChiMPI& chi_mpi;
+
+#include "ChiMath/chi_math.h"
+extern ChiMath& chi_math_handler;
+
+//###################################################################
+/**Constructor. destination_phis and source_moments hold one flux
+ * moment vector per right-hand side.*/
+LinearBoltzmann::SweepChunkPWLMultiRHS::
+  SweepChunkPWLMultiRHS(std::shared_ptr<chi_mesh::MeshContinuum> grid_ptr,
+                        SpatialDiscretization_PWLD& discretization,
+                        std::vector<LinearBoltzmann::CellLBSView>& cell_transport_views,
+                        std::vector<std::vector<double>>& destination_phis,
+                        const std::vector<std::vector<double>>& source_moments,
+                        LBSGroupset& in_groupset,
+                        const TCrossSections& in_xsections,
+                        const int in_num_moms,
+                        const int in_max_num_cell_dofs)
+                    : SweepChunk(destination_phis.front(), false),
+                      grid_view(std::move(grid_ptr)),
+                      grid_fe_view(discretization),
+                      grid_transport_view(cell_transport_views),
+                      rhs_phi(destination_phis),
+                      rhs_q_moments(source_moments),
+                      groupset(in_groupset),
+                      xsections(in_xsections),
+                      num_moms(in_num_moms),
+                      num_grps(in_groupset.groups.size()),
+                      num_rhs(in_groupset.num_rhs),
+                      max_num_cell_dofs(in_max_num_cell_dofs),
+                      a_and_b_initialized(false)
+{}
+
+//###################################################################
+/**Actual sweep function*/
+void LinearBoltzmann::SweepChunkPWLMultiRHS::
+  Sweep(chi_mesh::sweep_management::AngleSet *angle_set)
+{
+  if (!a_and_b_initialized)
+  {
+    Amat.resize(max_num_cell_dofs, std::vector<double>(max_num_cell_dofs));
+    Atemp.resize(max_num_cell_dofs, std::vector<double>(max_num_cell_dofs));
+    b.resize(num_grps*num_rhs, std::vector<double>(max_num_cell_dofs, 0.0));
+    source.resize(max_num_cell_dofs, 0.0);
+    a_and_b_initialized = true;
+  }
+
+  const auto spds = angle_set->GetSPDS();
+  const auto fluds = angle_set->fluds;
+  const bool surface_source_active = IsSurfaceSourceActive();
+  const int K = static_cast<int>(num_rhs);
+
+  const GsSubSet& subset = groupset.grp_subsets[angle_set->ref_subset];
+  const int gs_ss_size  = groupset.grp_subset_sizes[angle_set->ref_subset];
+  const int gs_ss_begin = subset.first;
+  const int gs_gi = groupset.groups[gs_ss_begin].id; // Groupset subset first group number
+
+  int deploc_face_counter = -1;
+  int preloc_face_counter = -1;
+
+  auto const& d2m_op = groupset.quadrature->GetDiscreteToMomentOperator();
+  auto const& m2d_op = groupset.quadrature->GetMomentToDiscreteOperator();
+
+  // ========================================================== Loop over each cell
+  size_t num_loc_cells = spds->spls.item_id.size();
+  for (size_t spls_index = 0; spls_index < num_loc_cells; ++spls_index)
+  {
+    const int cell_local_id = spds->spls.item_id[spls_index];
+    const auto& cell = grid_view->local_cells[cell_local_id];
+    const auto& fe_intgrl_values = grid_fe_view.GetUnitIntegrals(cell);
+    const auto num_faces = cell.faces.size();
+    const int num_nodes = static_cast<int>(fe_intgrl_values.NumNodes());
+    auto& transport_view = grid_transport_view[cell.local_id];
+    const int xs_mapping = transport_view.XSMapping();
+    const int num_cell_moms = transport_view.NumMoments();
+    const auto& sigma_tg = xsections[xs_mapping]->sigma_t;
+    std::vector<bool> face_incident_flags(num_faces, false);
+
+    // =================================================== Get Cell matrices
+    const auto& G           = fe_intgrl_values.GetIntV_shapeI_gradshapeJ();
+    const auto& M           = fe_intgrl_values.GetIntV_shapeI_shapeJ();
+    const auto& M_surf      = fe_intgrl_values.GetIntS_shapeI_shapeJ();
+
+    // =================================================== Loop over angles in set
+    const int ni_deploc_face_counter = deploc_face_counter;
+    const int ni_preloc_face_counter = preloc_face_counter;
+    const size_t as_num_angles = angle_set->angles.size();
+    for (size_t angle_set_index = 0; angle_set_index<as_num_angles; ++angle_set_index)
+    {
+      deploc_face_counter = ni_deploc_face_counter;
+      preloc_face_counter = ni_preloc_face_counter;
+      const int angle_num = angle_set->angles[angle_set_index];
+      const chi_mesh::Vector3& omega = groupset.quadrature->omegas[angle_num];
+
+      // ============================================ Gradient matrix
+      for (int i = 0; i < num_nodes; ++i)
+        for (int j = 0; j < num_nodes; ++j)
+          Amat[i][j] = omega.Dot(G[i][j]);
+
+      for (int gsgk = 0; gsgk < gs_ss_size*K; ++gsgk)
+        b[gsgk].assign(num_nodes, 0.0);
+
+      // ============================================ Surface integrals
+      int in_face_counter = -1;
+      for (int f = 0; f < num_faces; ++f)
+      {
+        const auto& face = cell.faces[f];
+        const double mu = omega.Dot(face.normal);
+
+        if (mu < 0.0) // Upwind
+        {
+          face_incident_flags[f] = true;
+          const bool local = transport_view.IsFaceLocal(f);
+          const bool boundary = not face.has_neighbor;
+          const size_t num_face_indices = face.vertex_ids.size();
+          if (local)
+          {
+            in_face_counter++;
+            for (int fi = 0; fi < num_face_indices; ++fi)
+            {
+              const int i = fe_intgrl_values.FaceDofMapping(f,fi);
+              for (int fj = 0; fj < num_face_indices; ++fj)
+              {
+                const int j = fe_intgrl_values.FaceDofMapping(f,fj);
+                const double *psi = fluds->UpwindPsi(spls_index,in_face_counter,fj,0,angle_set_index);
+                const double mu_Nij = -mu * M_surf[f][i][j];
+                Amat[i][j] += mu_Nij;
+                for (int gsgk = 0; gsgk < gs_ss_size*K; ++gsgk)
+                  b[gsgk][i] += psi[gsgk]*mu_Nij;
+              }
+            }
+          }
+          else if (not boundary)
+          {
+            preloc_face_counter++;
+            for (int fi = 0; fi < num_face_indices; ++fi)
+            {
+              const int i = fe_intgrl_values.FaceDofMapping(f,fi);
+              for (int fj = 0; fj < num_face_indices; ++fj)
+              {
+                const int j = fe_intgrl_values.FaceDofMapping(f,fj);
+                const double *psi = fluds->NLUpwindPsi(preloc_face_counter,fj,0,angle_set_index);
+                const double mu_Nij = -mu * M_surf[f][i][j];
+                Amat[i][j] += mu_Nij;
+                for (int gsgk = 0; gsgk < gs_ss_size*K; ++gsgk)
+                  b[gsgk][i] += psi[gsgk]*mu_Nij;
+              }
+            }
+          }
+          else
+          {
+            // Reflecting boundaries store num_rhs values per group whereas
+            // the other boundaries store a single value per group which is
+            // shared by all right-hand sides.
+            const uint64_t bndry_index = face.neighbor_id;
+            const bool reflecting =
+              angle_set->ref_boundaries[bndry_index]->IsReflecting();
+            for (int fi = 0; fi < num_face_indices; ++fi)
+            {
+              const int i = fe_intgrl_values.FaceDofMapping(f,fi);
+              for (int fj = 0; fj < num_face_indices; ++fj)
+              {
+                const int j = fe_intgrl_values.FaceDofMapping(f,fj);
+                const double *psi = angle_set->PsiBndry(bndry_index,
+                                                        angle_num,
+                                                        cell.local_id,
+                                                        f, fj, gs_gi,
+                                                        gs_ss_begin*K,
+                                                        surface_source_active);
+                const double mu_Nij = -mu * M_surf[f][i][j];
+                Amat[i][j] += mu_Nij;
+                for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+                  for (int k = 0; k < K; ++k)
+                    b[gsg*K+k][i] += mu_Nij*
+                                     (reflecting ? psi[gsg*K+k] : psi[gsg]);
+              }
+            }
+          }
+        } // if upwind
+      } // for f
+
+      // ========================================== Looping over groups
+      for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+      {
+        const int g = gs_gi+gsg;
+
+        // ============================= Mass Matrix
+        const double sigma_tgr = sigma_tg[g];
+        for (int i = 0; i < num_nodes; ++i)
+          for (int j = 0; j < num_nodes; ++j)
+            Atemp[i][j] = Amat[i][j] + M[i][j]*sigma_tgr;
+
+        for (int k = 0; k < K; ++k)
+        {
+          const auto& q_moments = rhs_q_moments[k];
+
+          // ============================= Contribute source moments
+          for (int i = 0; i < num_nodes; ++i)
+          {
+            double temp_src = 0.0;
+            for (int m = 0; m < num_cell_moms; ++m)
+            {
+              const size_t ir = transport_view.MapDOF(i, m, g);
+              temp_src += m2d_op[m][angle_num]*q_moments[ir];
+            }
+            source[i] = temp_src;
+          }
+
+          auto& bk = b[gsg*K+k];
+          for (int i = 0; i < num_nodes; ++i)
+          {
+            double temp = 0.0;
+            for (int j = 0; j < num_nodes; ++j)
+              temp += M[i][j]*source[j];
+            bk[i] += temp;
+          }
+        }//for rhs
+
+        // ============================= Solve system for all rhs
+        chi_math::GaussEliminationMultiRHS(Atemp, &b[gsg*K], num_rhs, num_nodes);
+      }
+
+      // ============================= Accumulate flux
+      for (int k = 0; k < K; ++k)
+      {
+        auto& output_vector = rhs_phi[k];
+        for (int m = 0; m < num_cell_moms; ++m)
+        {
+          const double wn_d2m = d2m_op[m][angle_num];
+          for (int i = 0; i < num_nodes; ++i)
+          {
+            const size_t ir = transport_view.MapDOF(i, m, gs_gi);
+            for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+              output_vector[ir + gsg] += wn_d2m*b[gsg*K+k][i];
+          }
+        }
+      }
+
+      int out_face_counter = -1;
+      for (int f = 0; f < num_faces; ++f)
+      {
+        if (face_incident_flags[f]) continue;
+
+        // ============================= Set flags and counters
+        out_face_counter++;
+        const auto& face = cell.faces[f];
+        const bool local = transport_view.IsFaceLocal(f);
+        const bool boundary = not face.has_neighbor;
+        const size_t num_face_indices = face.vertex_ids.size();
+
+        if (local)
+        {
+          for (int fi = 0; fi < num_face_indices; ++fi)
+          {
+            const int i = fe_intgrl_values.FaceDofMapping(f,fi);
+            double *psi = fluds->OutgoingPsi(spls_index, out_face_counter, fi, angle_set_index);
+            for (int gsgk = 0; gsgk < gs_ss_size*K; ++gsgk)
+              psi[gsgk] = b[gsgk][i];
+          }
+        }
+        else if (not boundary)
+        {
+          deploc_face_counter++;
+          for (int fi = 0; fi < num_face_indices; ++fi)
+          {
+            const int i = fe_intgrl_values.FaceDofMapping(f,fi);
+            double *psi = fluds->NLOutgoingPsi(deploc_face_counter, fi, angle_set_index);
+            for (int gsgk = 0; gsgk < gs_ss_size*K; ++gsgk)
+              psi[gsgk] = b[gsgk][i];
+          }
+        }
+        else // Store outgoing reflecting Psi
+        {
+          const uint64_t bndry_index = face.neighbor_id;
+          if (angle_set->ref_boundaries[bndry_index]->IsReflecting())
+          {
+            for (int fi = 0; fi < num_face_indices; ++fi)
+            {
+              const int i = fe_intgrl_values.FaceDofMapping(f,fi);
+              double *psi = angle_set->ReflectingPsiOutBoundBndry(bndry_index, angle_num,
+                                                                  cell.local_id, f,
+                                                                  fi, gs_ss_begin*K);
+              for (int gsgk = 0; gsgk < gs_ss_size*K; ++gsgk)
+                psi[gsgk] = b[gsgk][i];
+            }
+          }
+        }//bndry
+      }//for face
+    } // for n
+  } // for cell
+}//Sweep
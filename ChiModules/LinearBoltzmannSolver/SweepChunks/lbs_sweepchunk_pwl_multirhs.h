@@ -0,0 +1,64 @@
+#ifndef LBS_SWEEPCHUNK_PWL_MULTIRHS_H
+#define LBS_SWEEPCHUNK_PWL_MULTIRHS_H
+
+#include "ChiMesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "ChiPhysics/chi_physics.h"
+
+#include "ChiMath/SpatialDiscretization/FiniteElement/PiecewiseLinear/pwl.h"
+
+#include "LinearBoltzmannSolver/lbs_linear_boltzmann_solver.h"
+
+typedef std::vector<std::shared_ptr<chi_physics::TransportCrossSections>> TCrossSections;
+
+namespace LinearBoltzmann
+{
+//###################################################################
+/**Sweep chunk for cartesian PWLD discretization that sweeps multiple
+ * right-hand sides at once. The angular fluxes of the groupset's FLUDS
+ * and reflecting boundaries are num_rhs wide per group, ordered as
+ * [group][rhs]. The cell matrix of each angle and group is therefore
+ * built and eliminated once for all right-hand sides.
+ *
+ * Incident boundary fluxes are shared by all right-hand sides. Angular
+ * fluxes are not saved and face currents and outflows are not tallied.*/
+class SweepChunkPWLMultiRHS : public chi_mesh::sweep_management::SweepChunk
+{
+protected:
+  const std::shared_ptr<chi_mesh::MeshContinuum> grid_view;
+  SpatialDiscretization_PWLD& grid_fe_view;
+  std::vector<LinearBoltzmann::CellLBSView>& grid_transport_view;
+  std::vector<std::vector<double>>& rhs_phi;
+  const std::vector<std::vector<double>>& rhs_q_moments;
+  LBSGroupset& groupset;
+  const TCrossSections& xsections;
+  const int num_moms;
+  const size_t num_grps;
+  const size_t num_rhs;
+  const int max_num_cell_dofs;
+
+  //Runtime params
+  bool a_and_b_initialized;
+  std::vector<std::vector<double>> Amat;
+  std::vector<std::vector<double>> Atemp;
+  std::vector<double> source;
+
+public:
+  std::vector<std::vector<double>> b;
+
+  SweepChunkPWLMultiRHS(std::shared_ptr<chi_mesh::MeshContinuum> grid_ptr,
+                        SpatialDiscretization_PWLD& discretization,
+                        std::vector<LinearBoltzmann::CellLBSView>& cell_transport_views,
+                        std::vector<std::vector<double>>& destination_phis,
+                        const std::vector<std::vector<double>>& source_moments,
+                        LBSGroupset& in_groupset,
+                        const TCrossSections& in_xsections,
+                        int in_num_moms,
+                        int in_max_num_cell_dofs);
+
+  void Sweep(chi_mesh::sweep_management::AngleSet* angle_set) override;
+};
+}
+
+
+#endif
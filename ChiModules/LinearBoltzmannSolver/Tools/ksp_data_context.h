@@ -3,6 +3,8 @@
 
 #include "../lbs_linear_boltzmann_solver.h"
 
+#include <memory>
+
 namespace LinearBoltzmann
 {
 
@@ -17,6 +19,9 @@ struct KSPDataContext
   chi_mesh::sweep_management::SweepScheduler& sweep_scheduler;
   SourceFlags    lhs_scope;
   int64_t last_iteration = -1;
+  size_t num_operator_applications = 0; ///< Of the current solve
+  bool dsa_in_operator = true;   ///< False when DSA is the preconditioner
+  std::vector<double> zero_phi;  ///< Zero reference flux for the DSA PC
 
   KSPDataContext(LinearBoltzmann::Solver& in_solver,
                  LBSGroupset& in_groupset,
@@ -30,6 +35,25 @@ struct KSPDataContext
     lhs_scope(in_lhs_scope) {}
 };
 
+//###################################################################
+/**Krylov solver objects of the GMRES iterative method that can be kept
+ * alive between solves of the same groupset, e.g. for the inner solves of
+ * the k-eigenvalue power iteration where only the right-hand side
+ * changes.*/
+struct GMRESKrylovObjects
+{
+  LBSGroupset* groupset = nullptr;
+  chi_mesh::sweep_management::SweepScheduler* sweep_scheduler = nullptr;
+  SourceFlags lhs_scope = NO_FLAGS_SET;
+
+  Vec x_temp = nullptr;
+  Mat A      = nullptr;
+  KSP ksp    = nullptr;
+  std::unique_ptr<KSPDataContext> context;
+
+  size_t num_solves = 0;
+};
+
 }
 
 #endif //LBS_KSP_DATA_CONTEXT_H
\ No newline at end of file
@@ -20,7 +20,7 @@ void LinearBoltzmann::Solver::Initialize()
 {
   PerformInputChecks();
   PrintSimHeader();
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //================================================== Add unique material ids
   std::set<int> unique_material_ids;
@@ -56,7 +56,7 @@ void LinearBoltzmann::Solver::Initialize()
 
   InitializeParrays();
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
   chi_log.Log(LOG_0)
     << "Done with parallel arrays.                Process memory = "
     << std::setprecision(3)
@@ -1,8 +1,10 @@
 #include "lbs_linear_boltzmann_solver.h"
 
 #include <chi_log.h>
+#include <chi_mpi.h>
 
 extern ChiLog& chi_log;
+extern ChiMPI& chi_mpi;
 
 //###################################################################
 /**Performs general input checks before initialization continues.*/
@@ -32,6 +34,44 @@ void LinearBoltzmann::Solver::PerformInputChecks()
     }
     ++grpset_counter;
   }
+
+  //======================================== Replicated domain restrictions
+  // Each replica only sweeps its own group subsets (or angles) and
+  // therefore only holds the delayed angular fluxes of those. GMRES would
+  // then operate on different Krylov vectors on each replica. With angle
+  // decomposition reflecting boundaries would need the outgoing angular
+  // fluxes of other replicas.
+  if (chi_mpi.num_replicas > 1)
+  {
+    bool has_reflecting_bndry = false;
+    for (const auto& bndry : boundary_types)
+      if (bndry.first == BoundaryType::REFLECTING)
+        has_reflecting_bndry = true;
+
+    if (options.angle_domain_decomposition and has_reflecting_bndry)
+    {
+      chi_log.Log(LOG_ALLERROR)
+        << "LinearBoltzmann::Solver: Angle domain decomposition over "
+        << "replicated domains is not supported with reflecting boundaries.";
+      exit(EXIT_FAILURE);
+    }
+
+    grpset_counter=0;
+    for (auto& group_set : group_sets)
+    {
+      if (group_set.iterative_method == IterativeMethod::GMRES and
+          (group_set.allow_cycles or has_reflecting_bndry))
+      {
+        chi_log.Log(LOG_ALLERROR)
+          << "LinearBoltzmann::Solver: Groupset " << grpset_counter
+          << " uses GMRES with delayed angular fluxes (cycles or "
+          << "reflecting boundaries), which is not supported with "
+          << "replicated domains. Use Classic-Richardson instead.";
+        exit(EXIT_FAILURE);
+      }
+      ++grpset_counter;
+    }
+  }
   if (options.sd_type == chi_math::SpatialDiscretizationType::UNDEFINED)
   {
     chi_log.Log(LOG_ALLERROR)
@@ -121,7 +121,7 @@ void LinearBoltzmann::Solver::InitMaterials(std::set<int>& material_ids)
   chi_log.Log(LOG_0)
     << "Materials Initialized:\n" << materials_list.str() << "\n";
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%% Initialize Diffusion
   //                                                   properties
@@ -5,6 +5,9 @@
 #include "chi_log.h"
 extern ChiLog& chi_log;
 
+#include "chi_mpi.h"
+extern ChiMPI& chi_mpi;
+
 #include "ChiConsole/chi_console.h"
 extern ChiConsole&  chi_console;
 
@@ -19,7 +22,7 @@ void LinearBoltzmann::Solver::InitializeSpatialDiscretization()
                                           COMPUTE_UNIT_INTEGRALS);
 
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
   chi_log.Log(LOG_0)
     << "Cell matrices computed.                   Process memory = "
     << std::setprecision(3)
@@ -41,7 +41,7 @@ void LinearBoltzmann::Solver::InitializeParrays()
   if (options.read_restart_data)
     ReadRestartData(options.read_restart_folder_name,
                     options.read_restart_file_base);
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //================================================== Initialize transport views
   // Transport views act as a data structure to store information
@@ -56,6 +56,32 @@ void LinearBoltzmann::Solver::InitializeParrays()
   //
   size_t block_MG_counter = 0;       //Counts the strides of moment and group
 
+  //============================================= Active moments per xs
+  // When the material scattering order is used, a cell only sources and
+  // accumulates the moments with ell up to the scattering order of its
+  // material. The moment-to-harmonic map is ordered by increasing ell so
+  // this amounts to a truncation of the moment index. Storage is
+  // unaffected.
+  const auto& m_to_ell_em_map =
+    group_sets.front().quadrature->GetMomentToHarmonicsIndexMap();
+
+  std::vector<int> xs_num_moments(material_xs.size(), num_moments);
+  if (options.use_material_scattering_order)
+  {
+    for (size_t x=0; x<material_xs.size(); ++x)
+    {
+      size_t num_ell = std::max<size_t>(
+        material_xs[x]->transfer_matrices.size(), 1);
+
+      int num_xs_moms = 0;
+      for (const auto& ell_em : m_to_ell_em_map)
+        if (ell_em.ell < num_ell) ++num_xs_moms;
+
+      xs_num_moments[x] = num_xs_moms;
+    }
+  }
+  size_t num_active_moment_dofs = 0;
+
   chi_mesh::Vector3 ihat(1.0, 0.0, 0.0);
   chi_mesh::Vector3 jhat(0.0, 1.0, 0.0);
   chi_mesh::Vector3 khat(0.0, 0.0, 1.0);
@@ -100,16 +126,25 @@ void LinearBoltzmann::Solver::InitializeParrays()
     if (num_nodes > max_cell_dof_count)
       max_cell_dof_count = num_nodes;
 
+    int num_cell_moments = xs_num_moments[xs_mapping];
+
     cell_transport_views.emplace_back(cell_phi_address,
                                       num_nodes,
                                       num_grps,
                                       num_moments,
+                                      num_cell_moments,
                                       xs_mapping,
                                       face_local_flags,
                                       cell_on_boundary);
     block_MG_counter += num_nodes * num_grps * num_moments;
+    num_active_moment_dofs += num_nodes * num_grps * num_cell_moments;
   }//for local cell
 
+  if (options.use_material_scattering_order)
+    chi_log.Log(LOG_ALLVERBOSE_1)
+      << "LBS Number of active phi unknowns after material scattering order "
+      << "truncation: " << num_active_moment_dofs;
+
   //================================================== Populate grid nodal mappings
   // This is used in the Flux Data Structures (FLUDS)
   grid_nodal_mappings.clear();
@@ -2,6 +2,7 @@
 #include "IterativeMethods/lbs_iterativemethods.h"
 
 #include "ChiMesh/SweepUtilities/SweepScheduler/sweepscheduler.h"
+#include "ChiMath/SpatialDiscretization/FiniteElement/PiecewiseLinear/pwl.h"
 
 #include "chi_log.h"
 extern ChiLog&     chi_log;
@@ -18,29 +19,108 @@ extern ChiConsole&  chi_console;
 /**Execute the solver.*/
 void LinearBoltzmann::Solver::Execute()
 {
-  MPI_Barrier(MPI_COMM_WORLD);
-  int gs=-1;
-  for (auto& groupset : group_sets)
-  {
-    ++gs;
-    chi_log.Log(LOG_0)
-      << "\n********* Initializing Groupset " << gs << "\n" << std::endl;
+  MPI_Barrier(chi_mpi.comm);
 
-    ComputeSweepOrderings(groupset);
-    InitFluxDataStructures(groupset);
+  num_sweeps = 0;
+  num_inner_iterations = 0;
 
-    InitWGDSA(groupset);
-    InitTGDSA(groupset);
+  const bool multiple_rhs = not rhs_sources.empty();
+  const int  num_rhs = multiple_rhs ? static_cast<int>(rhs_sources.size()) : 1;
+  if (multiple_rhs and rhs_phi_local.size() != rhs_sources.size())
+    rhs_phi_local.assign(rhs_sources.size(),
+                         std::vector<double>(phi_old_local.size(), 0.0));
 
-    SolveGroupset(groupset, gs);
+  for (size_t gs=0; gs<group_sets.size(); ++gs)
+  {
+    //=========================================== Pipelined downscatter chains
+    if (options.pipeline_downscatter_groupsets and not multiple_rhs)
+    {
+      size_t last_gs = FindPipelinedGroupsetChainEnd(gs);
+      if (last_gs > gs)
+      {
+        for (size_t gsp=gs; gsp<=last_gs; ++gsp)
+        {
+          if (group_sets[gsp].setup_retained)
+            ReleaseGroupsetSetup(group_sets[gsp]);
+
+          chi_log.Log(LOG_0)
+            << "\n********* Initializing Groupset " << gsp << "\n" << std::endl;
+
+          ComputeSweepOrderings(group_sets[gsp]);
+          InitFluxDataStructures(group_sets[gsp]);
+        }
+
+        SolveGroupsetsPipelined(gs, last_gs);
+
+        for (size_t gsp=gs; gsp<=last_gs; ++gsp)
+          ResetSweepOrderings(group_sets[gsp]);
+
+        MPI_Barrier(chi_mpi.comm);
+        gs = last_gs;
+        continue;
+      }
+    }
+
+    auto& groupset = group_sets[gs];
+
+    //=========================================== Retained setups can only
+    //                                            be reused as is
+    if (groupset.setup_retained and groupset.num_rhs != num_rhs)
+      ReleaseGroupsetSetup(groupset);
+
+    if (not groupset.setup_retained)
+    {
+      chi_log.Log(LOG_0)
+        << "\n********* Initializing Groupset " << gs << "\n" << std::endl;
+
+      InitWGDSA(groupset);
+      InitTGDSA(groupset);
+      InitAngularMultigrid(groupset);
+
+      //========================================= Coarse quadrature initial
+      //                                          guess
+      if (not multiple_rhs)
+        SolveGroupsetAngularContinuation(groupset, static_cast<int>(gs));
+
+      //========================================= Batched right-hand sides
+      //                                          need wider angular fluxes
+      groupset.num_rhs = num_rhs;
+
+      ComputeSweepOrderings(groupset);
+      InitFluxDataStructures(groupset);
+    }
+    else
+      chi_log.Log(LOG_0)
+        << "\n********* Reusing setup of Groupset " << gs << "\n" << std::endl;
+
+    if (multiple_rhs)
+      SolveGroupsetMultiRHS(groupset, static_cast<int>(gs));
+    else
+      SolveGroupset(groupset, static_cast<int>(gs));
+
+    if (options.retain_setup)
+      groupset.setup_retained = true;
+    else
+      ReleaseGroupsetSetup(groupset);
+
+    MPI_Barrier(chi_mpi.comm);
+  }
 
-    CleanUpWGDSA(groupset);
-    CleanUpTGDSA(groupset);
+  //=========================================== Shared DSA solvers are only
+  //                                            kept with retained setups
+  if (not options.retain_setup)
+    DestroySharedDSASolvers();
 
-    ResetSweepOrderings(groupset);
+  //=========================================== Field functions show the
+  //                                            first right-hand side
+  if (multiple_rhs)
+    CopyRHSSolution(0);
 
-    MPI_Barrier(MPI_COMM_WORLD);
-  }
+  //=========================================== Unit integrals cache
+  auto pwl_sdm =
+    std::dynamic_pointer_cast<SpatialDiscretization_PWLD>(discretization);
+  if (pwl_sdm)
+    pwl_sdm->LogUnitIntegralsCacheStatistics();
 
   chi_log.Log(LOG_0) << "NPTransport solver execution completed\n";
 }
@@ -55,13 +135,32 @@ void LinearBoltzmann::Solver::SolveGroupset(LBSGroupset& groupset,
 
   //================================================== Setting up required
   //                                                   sweep chunks
-  auto sweep_chunk = SetSweepChunk(groupset);
-  MainSweepScheduler sweep_scheduler(SchedulingAlgorithm::DEPTH_OF_GRAPH,
-                                     groupset.angle_agg,
-                                     *sweep_chunk);
+  auto sweep_chunk = groupset.retained_sweep_chunk;
+  auto sweep_scheduler_ptr = groupset.retained_sweep_scheduler;
+  if (not sweep_scheduler_ptr)
+  {
+    sweep_chunk = SetSweepChunk(groupset);
+    sweep_scheduler_ptr = std::make_shared<MainSweepScheduler>(
+      SchedulingAlgorithm::DEPTH_OF_GRAPH,
+      groupset.angle_agg,
+      *sweep_chunk);
+  }
+  auto& sweep_scheduler = *sweep_scheduler_ptr;
+
+  //================================================== Keep the sweep chunk
+  //                                                   for re-entry
+  const bool retain = options.retain_setup and
+                      not groupset.continuation_active;
+  if (retain)
+  {
+    groupset.retained_sweep_chunk     = sweep_chunk;
+    groupset.retained_sweep_scheduler = sweep_scheduler_ptr;
+  }
 
   q_moments_local.assign(q_moments_local.size(), 0.0);
 
+  const size_t num_sweeps_before = sweep_scheduler.GetNumberOfSweeps();
+
   if (groupset.iterative_method == IterativeMethod::CLASSICRICHARDSON)
   {
     ClassicRichardson(groupset, group_set_num, sweep_scheduler,
@@ -72,15 +171,31 @@ void LinearBoltzmann::Solver::SolveGroupset(LBSGroupset& groupset,
                       APPLY_WGS_FISSION_SOURCE,
                       options.verbose_inner_iterations);
   }
+  else if (groupset.iterative_method == IterativeMethod::ANDERSON)
+  {
+    Anderson(groupset, group_set_num, sweep_scheduler,
+             APPLY_MATERIAL_SOURCE |
+             APPLY_AGS_SCATTER_SOURCE |
+             APPLY_WGS_SCATTER_SOURCE |
+             APPLY_AGS_FISSION_SOURCE |
+             APPLY_WGS_FISSION_SOURCE,
+             options.verbose_inner_iterations);
+  }
   else if (groupset.iterative_method == IterativeMethod::GMRES)
   {
     GMRES(groupset, group_set_num, sweep_scheduler,
           APPLY_WGS_SCATTER_SOURCE | APPLY_WGS_FISSION_SOURCE,  //lhs_scope
           APPLY_MATERIAL_SOURCE | APPLY_AGS_SCATTER_SOURCE |
           APPLY_AGS_FISSION_SOURCE,
-          options.verbose_inner_iterations);  //rhs_scope
+          options.verbose_inner_iterations,   //rhs_scope
+          retain);                            //reuse krylov objects
   }
 
+  num_sweeps += sweep_scheduler.GetNumberOfSweeps() - num_sweeps_before;
+
+  if (options.save_angular_flux)
+    AllreduceReplicaAngularFluxes(groupset);
+
   if (options.write_restart_data)
     WriteRestartData(options.write_restart_folder_name,
                      options.write_restart_file_base);
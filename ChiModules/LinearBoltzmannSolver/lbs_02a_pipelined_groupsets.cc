@@ -0,0 +1,285 @@
+#include "lbs_linear_boltzmann_solver.h"
+#include "IterativeMethods/lbs_iterativemethods.h"
+
+#include "ChiMesh/SweepUtilities/SweepScheduler/sweepscheduler.h"
+
+#include "chi_log.h"
+extern ChiLog&     chi_log;
+
+#include "chi_mpi.h"
+extern ChiMPI&      chi_mpi;
+
+#include "ChiTimer/chi_timer.h"
+extern ChiTimer chi_program_timer;
+
+#include "ChiConsole/chi_console.h"
+extern ChiConsole&  chi_console;
+
+#include <iomanip>
+
+//###################################################################
+/**Starting at the given groupset, finds the last groupset of a chain of
+ * consecutive groupsets that can be swept in a pipelined fashion. If
+ * no chain of at least two groupsets can be formed, first_gs is
+ * returned.
+ *
+ * A groupset can be part of a chain when it is solved with
+ * Classic-Richardson without cycles or DSA, and no reflecting boundaries
+ * are present (no delayed angular fluxes). Consecutive groupsets must
+ * have ascending groups, and no group of a later groupset in the chain
+ * may scatter into an earlier one. Fissile materials break chains since
+ * fission couples all groups. Pipelining is not used with replicated
+ * domains since the replica reductions would have to be performed inside
+ * the pipelined sweep.*/
+size_t LinearBoltzmann::Solver::
+  FindPipelinedGroupsetChainEnd(size_t first_gs) const
+{
+  if (chi_mpi.num_replicas > 1) return first_gs;
+
+  for (const auto& bndry : boundary_types)
+    if (bndry.first == BoundaryType::REFLECTING)
+      return first_gs;
+
+  for (const auto& xs : material_xs)
+    if (xs->is_fissile)
+      return first_gs;
+
+  auto Eligible = [](const LBSGroupset& groupset)
+  {
+    return (groupset.iterative_method == IterativeMethod::CLASSICRICHARDSON)
+           and (not groupset.allow_cycles)
+           and (not groupset.apply_wgdsa)
+           and (not groupset.apply_tgdsa);
+  };
+
+  if (not Eligible(group_sets[first_gs])) return first_gs;
+
+  const int chain_first_group = group_sets[first_gs].groups.front().id;
+
+  size_t last_gs = first_gs;
+  for (size_t gs=first_gs+1; gs<group_sets.size(); ++gs)
+  {
+    const auto& groupset = group_sets[gs];
+    if (not Eligible(groupset)) break;
+
+    const int gs_first = groupset.groups.front().id;
+    const int gs_last  = groupset.groups.back().id;
+    if (gs_first <= group_sets[last_gs].groups.back().id) break;
+
+    //=========================================== Check upscatter into chain
+    bool upscatter_into_chain = false;
+    for (const auto& xs : material_xs)
+      for (const auto& transfer_matrix : xs->transfer_matrices)
+        for (int g=chain_first_group; g<gs_first; ++g)
+        {
+          if (g >= transfer_matrix.rowI_indices.size()) break;
+          for (size_t t=0; t<transfer_matrix.rowI_indices[g].size(); ++t)
+          {
+            const int gprime = transfer_matrix.rowI_indices[g][t];
+            if ((gprime >= gs_first) and (gprime <= gs_last) and
+                (transfer_matrix.rowI_values[g][t] != 0.0))
+              upscatter_into_chain = true;
+          }
+        }
+    if (upscatter_into_chain) break;
+
+    last_gs = gs;
+  }
+
+  return last_gs;
+}
+
+//###################################################################
+/**Solves a chain of downscatter-only groupsets with Classic-Richardson
+ * where, in each iteration, all the groupsets are swept in a single
+ * pipelined pass. On each location the sweep of groupset k+1 starts as
+ * soon as groupset k's flux is final on that location, so that the sweep
+ * pipeline is filled only once per iteration instead of once per
+ * groupset.
+ *
+ * Within an iteration the groupsets are coupled Gauss-Seidel style: the
+ * source of groupset k+1 is built with groupset k's flux from the same
+ * pass. Groupsets at the front of the chain are dropped from subsequent
+ * passes once they are converged.*/
+void LinearBoltzmann::Solver::SolveGroupsetsPipelined(size_t first_gs,
+                                                      size_t last_gs)
+{
+  source_event_tag = chi_log.GetRepeatingEventTag("Set Source");
+
+  const size_t num_gs = last_gs - first_gs + 1;
+
+  chi_log.Log(LOG_0)
+    << "\n\n********** Solving groupsets " << first_gs << " to " << last_gs
+    << " with pipelined Classic-Richardson.\n\n";
+
+  //================================================== Setting up required
+  //                                                   sweep chunks
+  std::vector<std::shared_ptr<SweepChunk>> sweep_chunks;
+  std::vector<std::unique_ptr<MainSweepScheduler>> sweep_schedulers;
+  for (size_t gs=first_gs; gs<=last_gs; ++gs)
+  {
+    auto& groupset = group_sets[gs];
+    groupset.angle_agg.ZeroIncomingDelayedPsi();
+
+    sweep_chunks.push_back(SetSweepChunk(groupset));
+    sweep_chunks.back()->SetDestinationPhi(phi_new_local);
+    sweep_chunks.back()->SetSurfaceSourceActiveFlag(true);
+
+    sweep_schedulers.push_back(std::make_unique<MainSweepScheduler>(
+      SchedulingAlgorithm::DEPTH_OF_GRAPH,
+      groupset.angle_agg,
+      *sweep_chunks.back()));
+  }
+
+  //================================================== Zero a groupset's
+  //                                                   part of a vector
+  auto ZeroGroupsetEntries = [this](LBSGroupset& groupset,
+                                    std::vector<double>& vec)
+  {
+    const int gsi = groupset.groups.front().id;
+    const size_t gss = groupset.groups.size();
+    for (const auto& cell : grid->local_cells)
+    {
+      auto& transport_view = cell_transport_views[cell.local_id];
+      for (int i=0; i < transport_view.NumNodes(); ++i)
+        for (int m=0; m<num_moments; ++m)
+        {
+          size_t mapping = transport_view.MapDOF(i,m,gsi);
+          for (size_t g=0; g<gss; ++g)
+            vec[mapping+g] = 0.0;
+        }
+    }
+  };
+
+  const SourceFlags source_flags = APPLY_MATERIAL_SOURCE |
+                                   APPLY_AGS_SCATTER_SOURCE |
+                                   APPLY_WGS_SCATTER_SOURCE |
+                                   APPLY_AGS_FISSION_SOURCE |
+                                   APPLY_WGS_FISSION_SOURCE;
+
+  q_moments_local.assign(q_moments_local.size(), 0.0);
+
+  //================================================== Stage callbacks
+  // These are executed locally, without communication, when a stage
+  // begins or ends on this location.
+  size_t active_first = 0;
+  std::vector<double> local_pw_change(num_gs, 0.0);
+
+  auto StageBegin = [&](size_t k)
+  {
+    auto& groupset = group_sets[first_gs + active_first + k];
+    ZeroGroupsetEntries(groupset, q_moments_local);
+    SetSource(groupset, q_moments_local, source_flags);
+    groupset.ZeroAngularFluxDataStructures();
+    ZeroGroupsetEntries(groupset, phi_new_local);
+  };
+
+  auto StageEnd = [&](size_t k)
+  {
+    auto& groupset = group_sets[first_gs + active_first + k];
+    local_pw_change[active_first + k] = ComputeLocalPiecewiseChange(groupset);
+    ScopedCopySTLvectors(groupset, phi_new_local, phi_old_local);
+  };
+
+  //================================================== Now start iterating
+  std::vector<double> pw_change_prev(num_gs, 1.0);
+  std::vector<int>    num_iterations(num_gs, 0);
+  std::vector<bool>   converged(num_gs, false);
+  int max_iterations = 0;
+  for (size_t gs=first_gs; gs<=last_gs; ++gs)
+    max_iterations = std::max(max_iterations, group_sets[gs].max_iterations);
+
+  for (int k = 0; k < max_iterations; ++k)
+  {
+    //=========================================== Drop finished groupsets
+    // A groupset at the front of the chain whose predecessors are done
+    // will no longer change.
+    while (active_first < num_gs and
+           (converged[active_first] or
+            num_iterations[active_first] >=
+              group_sets[first_gs + active_first].max_iterations))
+      ++active_first;
+    if (active_first >= num_gs) break;
+
+    std::vector<MainSweepScheduler*> stages;
+    for (size_t s=active_first; s<num_gs; ++s)
+      stages.push_back(sweep_schedulers[s].get());
+
+    local_pw_change.assign(num_gs, 0.0);
+    MainSweepScheduler::PipelinedSweep(stages, StageBegin, StageEnd);
+
+    std::vector<double> pw_change(num_gs, 0.0);
+    MPI_Allreduce(local_pw_change.data(), pw_change.data(),
+                  static_cast<int>(num_gs), MPI_DOUBLE, MPI_MAX,
+                  chi_mpi.comm);
+
+    //=========================================== Check convergence
+    for (size_t s=active_first; s<num_gs; ++s)
+    {
+      auto& groupset = group_sets[first_gs + s];
+
+      double rho = sqrt(pw_change[s] / pw_change_prev[s]);
+      pw_change_prev[s] = pw_change[s];
+      if (num_iterations[s] == 0) rho = 0.0;
+
+      // A groupset can only be converged once all preceding groupsets
+      // in the chain are done, since its source still changes otherwise.
+      bool preceding_converged = true;
+      for (size_t p=active_first; p<s; ++p)
+        if (not converged[p]) preceding_converged = false;
+
+      if (preceding_converged and
+          pw_change[s]<std::max(groupset.residual_tolerance*(1.0-rho),1.0e-10))
+        converged[s] = true;
+
+      std::stringstream iter_info;
+      iter_info
+        << chi_program_timer.GetTimeString() << " "
+        << "WGS groups ["
+        << groupset.groups.front().id
+        << "-"
+        << groupset.groups.back().id
+        << "]"
+        << " Iteration " << std::setw(5) << num_iterations[s]
+        << " Point-wise change " << std::setw(14) << pw_change[s]
+        << " Spectral Radius Estimate " << std::setw(10) << rho;
+
+      if (converged[s])
+        iter_info << " CONVERGED\n";
+
+      if (options.verbose_inner_iterations)
+        chi_log.Log(LOG_0) << iter_info.str();
+
+      ++num_iterations[s];
+    }//for s
+  }//for k
+
+  for (const auto& sweep_scheduler : sweep_schedulers)
+    num_sweeps += sweep_scheduler->GetNumberOfSweeps();
+
+  //================================================== Print solution info
+  {
+    size_t num_unknowns = 0;
+    for (size_t gs=first_gs; gs<=last_gs; ++gs)
+      num_unknowns += glob_node_count *
+                      group_sets[gs].quadrature->abscissae.size() *
+                      group_sets[gs].groups.size();
+
+    double sweep_time = sweep_schedulers.front()->GetAverageSweepTime();
+
+    chi_log.Log(LOG_0)
+      << "\n\n"
+      << "        Average pipelined sweep time (s): " << sweep_time << "\n"
+      << "        Number of unknowns per sweep:     " << num_unknowns
+      << "\n\n";
+  }
+
+  if (options.write_restart_data)
+    WriteRestartData(options.write_restart_folder_name,
+                     options.write_restart_file_base);
+
+  chi_log.Log(LOG_0)
+    << "Pipelined groupset solve complete.        Process memory = "
+    << std::setprecision(3)
+    << chi_console.GetMemoryUsageInMB() << " MB";
+}
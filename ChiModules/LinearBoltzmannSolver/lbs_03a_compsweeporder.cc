@@ -48,7 +48,8 @@ void LinearBoltzmann::Solver::ComputeSweepOrderings(LBSGroupset& groupset) const
   {
     chi_log.Log(LOG_ALLERROR)
       << "When using PARMETIS type partitioning then groupset iterative method"
-         " must be NPT_CLASSICRICHARDSON_CYCLES or NPT_GMRES_CYCLES";
+         " must be NPT_CLASSICRICHARDSON_CYCLES, NPT_GMRES_CYCLES or"
+         " NPT_ANDERSON_CYCLES";
     exit(EXIT_FAILURE);
   }
 
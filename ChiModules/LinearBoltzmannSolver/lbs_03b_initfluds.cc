@@ -25,6 +25,17 @@ void LinearBoltzmann::Solver::InitFluxDataStructures(LBSGroupset& groupset)
   chi_mesh::MeshHandler* handler = chi_mesh::GetCurrentHandler();
   chi_mesh::VolumeMesher& mesher = *handler->volume_mesher;
 
+  if (chi_mpi.num_replicas > 1 and options.angle_domain_decomposition and
+      (options.geometry_type == GeometryType::ONED_SPHERICAL or
+       options.geometry_type == GeometryType::TWOD_CYLINDRICAL))
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Angle domain decomposition over replicated domains is not "
+      << "supported for curvilinear geometries since the angular "
+      << "derivative couples the directions.";
+    exit(EXIT_FAILURE);
+  }
+
   if ( options.geometry_type == GeometryType::ONED_SLAB or
        options.geometry_type == GeometryType::TWOD_CARTESIAN or
        (typeid(mesher) == typeid(chi_mesh::VolumeMesherExtruder)))
@@ -64,6 +75,22 @@ void LinearBoltzmann::Solver::InitFluxDataStructures(LBSGroupset& groupset)
     << std::setprecision(3) << chi_console.GetMemoryUsageInMB()
     << " MB.";
 
+  //================================================== Check replica work
+  if (chi_mpi.num_replicas > 1 and chi_mpi.location_id == 0)
+  {
+    size_t num_angle_sets = 0;
+    for (const auto& angle_set_group : groupset.angle_agg.angle_set_groups)
+      num_angle_sets += angle_set_group.angle_sets.size();
+
+    if (num_angle_sets == 0)
+      chi_log.Log(LOG_ALLWARNING)
+        << "Replica " << chi_mpi.replica_id << " has no angle sets for the "
+        << "groupset with groups " << groupset.groups.front().id << "-"
+        << groupset.groups.back().id << " and will be idle during its "
+        << "sweeps. Increase the number of group subsets or angle set "
+        << "groups.";
+  }
+
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 }
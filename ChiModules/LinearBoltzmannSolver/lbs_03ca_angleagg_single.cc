@@ -48,7 +48,7 @@ void LinearBoltzmann::Solver::InitAngleAggSingle(LBSGroupset& groupset)
     //=========================================== Passing the sweep boundaries
     //                                            to the angle aggregation
     groupset.angle_agg.Setup(sweep_boundaries,
-                             groupset.groups.size(),
+                             groupset.groups.size()*groupset.num_rhs,
                              groupset.grp_subsets.size(),
                              groupset.quadrature,
                              grid);
@@ -56,6 +56,8 @@ void LinearBoltzmann::Solver::InitAngleAggSingle(LBSGroupset& groupset)
     //=========================================== Set angle aggregation
     for (int q=0; q<num_angset_grps; q++)  //%%%%%%%%% for each top hemisphere quadrant
     {
+      if (not IsAngularSubsetLocal(q)) continue;
+
       TAngleSetGroup angle_set_group;
 
       for (int azi=0; azi<num_azi/num_angset_grps; azi++)
@@ -67,6 +69,8 @@ void LinearBoltzmann::Solver::InitAngleAggSingle(LBSGroupset& groupset)
 
           for (int gs_ss=0; gs_ss<groupset.grp_subsets.size(); gs_ss++)
           {
+            if (not IsGroupSubsetLocal(gs_ss)) continue;
+
             std::vector<int> angle_indices;
 
             //============================================= Each quadrant gets 1/4 of azi angles
@@ -81,7 +85,7 @@ void LinearBoltzmann::Solver::InitAngleAggSingle(LBSGroupset& groupset)
             {
               make_primary = false;
               primary_fluds = new chi_mesh::sweep_management::
-              PRIMARY_FLUDS(groupset.grp_subset_sizes[gs_ss],
+              PRIMARY_FLUDS(groupset.grp_subset_sizes[gs_ss]*groupset.num_rhs,
                             grid_nodal_mappings);
 
               chi_log.Log(LOG_0VERBOSE_1)
@@ -99,11 +103,11 @@ void LinearBoltzmann::Solver::InitAngleAggSingle(LBSGroupset& groupset)
             else
             {
               fluds = new chi_mesh::sweep_management::
-              AUX_FLUDS(*primary_fluds,groupset.grp_subset_sizes[gs_ss]);
+              AUX_FLUDS(*primary_fluds,groupset.grp_subset_sizes[gs_ss]*groupset.num_rhs);
             }
 
             auto angleSet = std::make_shared<TAngleSet>(
-              groupset.grp_subset_sizes[gs_ss],
+              groupset.grp_subset_sizes[gs_ss]*groupset.num_rhs,
               gs_ss,
               groupset.sweep_orderings[angle_num],
               fluds,
@@ -123,6 +127,8 @@ void LinearBoltzmann::Solver::InitAngleAggSingle(LBSGroupset& groupset)
 
     for (int q=0; q<num_angset_grps; q++)  //%%%%%%%%% for each bot hemisphere quadrant
     {
+      if (not IsAngularSubsetLocal(num_angset_grps + q)) continue;
+
       TAngleSetGroup angle_set_group;
 
       for (int azi=0; azi<num_azi/num_angset_grps; azi++)
@@ -134,6 +140,8 @@ void LinearBoltzmann::Solver::InitAngleAggSingle(LBSGroupset& groupset)
 
           for (int gs_ss=0; gs_ss<groupset.grp_subsets.size(); gs_ss++)
           {
+            if (not IsGroupSubsetLocal(gs_ss)) continue;
+
             std::vector<int> angle_indices;
 
             //============================================= Each quadrant gets 1/4 of azi angles
@@ -147,7 +155,7 @@ void LinearBoltzmann::Solver::InitAngleAggSingle(LBSGroupset& groupset)
             {
               make_primary = false;
               primary_fluds = new chi_mesh::sweep_management::
-              PRIMARY_FLUDS(groupset.grp_subset_sizes[gs_ss],
+              PRIMARY_FLUDS(groupset.grp_subset_sizes[gs_ss]*groupset.num_rhs,
                             grid_nodal_mappings);
 
               chi_log.Log(LOG_0VERBOSE_1)
@@ -165,11 +173,11 @@ void LinearBoltzmann::Solver::InitAngleAggSingle(LBSGroupset& groupset)
             else
             {
               fluds = new chi_mesh::sweep_management::
-              AUX_FLUDS(*primary_fluds,groupset.grp_subset_sizes[gs_ss]);
+              AUX_FLUDS(*primary_fluds,groupset.grp_subset_sizes[gs_ss]*groupset.num_rhs);
             }
 
             auto angleSet = std::make_shared<TAngleSet>(
-              groupset.grp_subset_sizes[gs_ss],
+              groupset.grp_subset_sizes[gs_ss]*groupset.num_rhs,
               gs_ss,
               groupset.sweep_orderings[angle_num],
               fluds,
@@ -193,7 +201,7 @@ void LinearBoltzmann::Solver::InitAngleAggSingle(LBSGroupset& groupset)
     //=========================================== Passing the sweep boundaries
     //                                            to the angle aggregation
     groupset.angle_agg.Setup(sweep_boundaries,
-                             groupset.groups.size(),
+                             groupset.groups.size()*groupset.num_rhs,
                              groupset.grp_subsets.size(),
                              groupset.quadrature,
                              grid);
@@ -205,11 +213,15 @@ void LinearBoltzmann::Solver::InitAngleAggSingle(LBSGroupset& groupset)
 
       for (int n=0; n<groupset.quadrature->abscissae.size(); ++n)
       {
+        if (not IsAngularSubsetLocal(n)) continue;
+
         bool make_primary = true;
         chi_mesh::sweep_management::PRIMARY_FLUDS* primary_fluds;
 
         for (int gs_ss=0; gs_ss<groupset.grp_subsets.size(); gs_ss++)
         {
+          if (not IsGroupSubsetLocal(gs_ss)) continue;
+
           std::vector<int> angle_indices;
 
           angle_indices.push_back(n);
@@ -219,7 +231,7 @@ void LinearBoltzmann::Solver::InitAngleAggSingle(LBSGroupset& groupset)
           {
             make_primary = false;
             primary_fluds = new chi_mesh::sweep_management::
-            PRIMARY_FLUDS(groupset.grp_subset_sizes[gs_ss],
+            PRIMARY_FLUDS(groupset.grp_subset_sizes[gs_ss]*groupset.num_rhs,
                           grid_nodal_mappings);
 
             chi_log.Log(LOG_0VERBOSE_1)
@@ -251,11 +263,11 @@ void LinearBoltzmann::Solver::InitAngleAggSingle(LBSGroupset& groupset)
           else
           {
             fluds = new chi_mesh::sweep_management::
-            AUX_FLUDS(*primary_fluds,groupset.grp_subset_sizes[gs_ss]);
+            AUX_FLUDS(*primary_fluds,groupset.grp_subset_sizes[gs_ss]*groupset.num_rhs);
           }
 
           auto angleSet = std::make_shared<TAngleSet>(
-            groupset.grp_subset_sizes[gs_ss],
+            groupset.grp_subset_sizes[gs_ss]*groupset.num_rhs,
             gs_ss,
             groupset.sweep_orderings[n],
             fluds,
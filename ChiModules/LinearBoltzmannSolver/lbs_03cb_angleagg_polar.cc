@@ -54,7 +54,7 @@ void LinearBoltzmann::Solver::InitAngleAggPolar(LBSGroupset& groupset)
   //=========================================== Passing the sweep boundaries
   //                                            to the angle aggregation
   groupset.angle_agg.Setup(sweep_boundaries,
-                            groupset.groups.size(),
+                            groupset.groups.size()*groupset.num_rhs,
                             groupset.grp_subsets.size(),
                             groupset.quadrature,
                             grid);
@@ -62,6 +62,8 @@ void LinearBoltzmann::Solver::InitAngleAggPolar(LBSGroupset& groupset)
   //=========================================== Set angle aggregation
   for (int q=0; q<num_angset_grps; q++)  //%%%%%%%%% for each top hemisphere quadrant
   {
+    if (not IsAngularSubsetLocal(q)) continue;
+
     TAngleSetGroup angle_set_group;
 
     for (int azi=0; azi<num_azi/num_angset_grps; azi++)
@@ -71,6 +73,8 @@ void LinearBoltzmann::Solver::InitAngleAggPolar(LBSGroupset& groupset)
 
       for (int gs_ss=0; gs_ss<groupset.grp_subsets.size(); gs_ss++)
       {
+        if (not IsGroupSubsetLocal(gs_ss)) continue;
+
         for (int an_ss=0; an_ss<groupset.ang_subsets_top.size(); an_ss++)
         {
           std::vector<int> angle_indices;
@@ -89,7 +93,7 @@ void LinearBoltzmann::Solver::InitAngleAggPolar(LBSGroupset& groupset)
           {
             make_primary = false;
             primary_fluds = new chi_mesh::sweep_management::
-                  PRIMARY_FLUDS(groupset.grp_subset_sizes[gs_ss],
+                  PRIMARY_FLUDS(groupset.grp_subset_sizes[gs_ss]*groupset.num_rhs,
                                 grid_nodal_mappings);
 
             chi_log.Log(LOG_0VERBOSE_1)
@@ -106,11 +110,11 @@ void LinearBoltzmann::Solver::InitAngleAggPolar(LBSGroupset& groupset)
           } else
           {
             fluds = new chi_mesh::sweep_management::
-              AUX_FLUDS(*primary_fluds,groupset.grp_subset_sizes[gs_ss]);
+              AUX_FLUDS(*primary_fluds,groupset.grp_subset_sizes[gs_ss]*groupset.num_rhs);
           }
 
           auto angleSet = std::make_shared<TAngleSet>(
-                          groupset.grp_subset_sizes[gs_ss],
+                          groupset.grp_subset_sizes[gs_ss]*groupset.num_rhs,
                           gs_ss,
                           groupset.sweep_orderings[a],
                           fluds,
@@ -128,6 +132,8 @@ void LinearBoltzmann::Solver::InitAngleAggPolar(LBSGroupset& groupset)
   }//for q top
   for (int q=0; q<num_angset_grps; q++)  //%%%%%%%%% for each bot hemisphere quadrant
   {
+    if (not IsAngularSubsetLocal(num_angset_grps + q)) continue;
+
     TAngleSetGroup angle_set_group;
 
     for (int azi=0; azi<num_azi/num_angset_grps; azi++)
@@ -137,6 +143,8 @@ void LinearBoltzmann::Solver::InitAngleAggPolar(LBSGroupset& groupset)
 
       for (int gs_ss=0; gs_ss<groupset.grp_subsets.size(); gs_ss++)
       {
+        if (not IsGroupSubsetLocal(gs_ss)) continue;
+
         for (int an_ss=0; an_ss<groupset.ang_subsets_bot.size(); an_ss++)
         {
           std::vector<int> angle_indices;
@@ -155,7 +163,7 @@ void LinearBoltzmann::Solver::InitAngleAggPolar(LBSGroupset& groupset)
           {
             make_primary = false;
             primary_fluds = new chi_mesh::sweep_management::
-            PRIMARY_FLUDS(groupset.grp_subset_sizes[gs_ss],
+            PRIMARY_FLUDS(groupset.grp_subset_sizes[gs_ss]*groupset.num_rhs,
                           grid_nodal_mappings);
 
             chi_log.Log(LOG_0VERBOSE_1)
@@ -172,11 +180,11 @@ void LinearBoltzmann::Solver::InitAngleAggPolar(LBSGroupset& groupset)
           } else
           {
             fluds = new chi_mesh::sweep_management::
-            AUX_FLUDS(*primary_fluds,groupset.grp_subset_sizes[gs_ss]);
+            AUX_FLUDS(*primary_fluds,groupset.grp_subset_sizes[gs_ss]*groupset.num_rhs);
           }
 
           auto angleSet = std::make_shared<TAngleSet>(
-                          groupset.grp_subset_sizes[gs_ss],
+                          groupset.grp_subset_sizes[gs_ss]*groupset.num_rhs,
                           gs_ss,
                           groupset.sweep_orderings[a+num_azi],
                           fluds,
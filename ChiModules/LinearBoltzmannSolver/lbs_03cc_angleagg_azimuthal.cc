@@ -45,7 +45,7 @@ void LinearBoltzmann::Solver::InitAngleAggAzimuthal(LBSGroupset& groupset)
   //=========================================== Passing the sweep boundaries
   //                                            to the angle aggregation
   groupset.angle_agg.Setup(sweep_boundaries,
-                           groupset.groups.size(),
+                           groupset.groups.size()*groupset.num_rhs,
                            groupset.grp_subsets.size(),
                            groupset.quadrature,
                            grid);
@@ -70,12 +70,14 @@ void LinearBoltzmann::Solver::InitAngleAggAzimuthal(LBSGroupset& groupset)
 
       for (size_t gs_ss = 0; gs_ss < groupset.grp_subsets.size(); ++gs_ss)
       {
+        if (not IsGroupSubsetLocal(gs_ss)) continue;
+
         chi_mesh::sweep_management::FLUDS* fluds;
         if (make_primary)
         {
           make_primary = false;
           primary_fluds = new chi_mesh::sweep_management::
-            PRIMARY_FLUDS(groupset.grp_subset_sizes[gs_ss],
+            PRIMARY_FLUDS(groupset.grp_subset_sizes[gs_ss]*groupset.num_rhs,
                           grid_nodal_mappings);
 
           chi_log.Log(LOG_0VERBOSE_1)
@@ -93,11 +95,11 @@ void LinearBoltzmann::Solver::InitAngleAggAzimuthal(LBSGroupset& groupset)
         else
         {
           fluds = new chi_mesh::sweep_management::
-          AUX_FLUDS(*primary_fluds,groupset.grp_subset_sizes[gs_ss]);
+          AUX_FLUDS(*primary_fluds,groupset.grp_subset_sizes[gs_ss]*groupset.num_rhs);
         }
 
         auto angleSet = std::make_shared<TAngleSet>(
-                        groupset.grp_subset_sizes[gs_ss],
+                        groupset.grp_subset_sizes[gs_ss]*groupset.num_rhs,
                         gs_ss,
                         groupset.sweep_orderings[angle_num],
                         fluds,
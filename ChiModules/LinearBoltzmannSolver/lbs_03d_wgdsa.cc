@@ -14,6 +14,22 @@ void LinearBoltzmann::Solver::InitWGDSA(LBSGroupset& groupset)
 {
   if (groupset.apply_wgdsa)
   {
+    //================================= Use a shared solver if one with
+    //                                  the same operator exists
+    if (options.share_dsa_solvers)
+    {
+      auto shared_solver = FindSharedDSASolver(groupset, false);
+      if (shared_solver)
+      {
+        groupset.wgdsa_solver = shared_solver;
+        chi_log.Log(LOG_0)
+          << "WGDSA: Groupset groups " << groupset.groups.front().id
+          << "-" << groupset.groups.back().id << " uses the diffusion "
+          << "solver of another groupset.";
+        return;
+      }
+    }
+
     //================================= Initialize unknowns
     chi_math::UnknownManager scalar_uk_man;
     scalar_uk_man.AddUnknown(chi_math::UnknownType::VECTOR_N, groupset.groups.size());
@@ -47,6 +63,7 @@ void LinearBoltzmann::Solver::InitWGDSA(LBSGroupset& groupset)
     dsolver->residual_tolerance = groupset.wgdsa_tol;
     dsolver->max_iters          = groupset.wgdsa_max_iters;
     dsolver->options_string     = groupset.wgdsa_string;
+    dsolver->matrix_free        = groupset.dsa_matrix_free;
     dsolver->material_mode = DIFFUSION_MATERIALS_FROM_TRANSPORTXS_TTF;
     dsolver->q_field = deltaphi_ff;
 
@@ -87,6 +104,9 @@ void LinearBoltzmann::Solver::InitWGDSA(LBSGroupset& groupset)
     dsolver->Initialize(verbose);
     dsolver->ExecuteS(supress_assembly,supress_solver);
 
+    if (options.share_dsa_solvers)
+      shared_dsa_solvers.push_back({dsolver, &groupset, false});
+
     delta_phi_local.resize(0);
     delta_phi_local.shrink_to_fit();
   }//if wgdsa
@@ -96,8 +116,10 @@ void LinearBoltzmann::Solver::InitWGDSA(LBSGroupset& groupset)
 /**Cleans up memory consuming items. */
 void LinearBoltzmann::Solver::CleanUpWGDSA(LBSGroupset& groupset)
 {
-  if (groupset.apply_wgdsa)
+  if (groupset.apply_wgdsa and
+      not IsSharedDSASolver(groupset.wgdsa_solver))
     delete groupset.wgdsa_solver;
+  groupset.wgdsa_solver = nullptr;
 }
 
 //###################################################################
@@ -14,6 +14,22 @@ void LinearBoltzmann::Solver::InitTGDSA(LBSGroupset& groupset)
 {
   if (groupset.apply_tgdsa)
   {
+    //================================= Use a shared solver if one with
+    //                                  the same operator exists
+    if (options.share_dsa_solvers)
+    {
+      auto shared_solver = FindSharedDSASolver(groupset, true);
+      if (shared_solver)
+      {
+        groupset.tgdsa_solver = shared_solver;
+        chi_log.Log(LOG_0)
+          << "TGDSA: Groupset groups " << groupset.groups.front().id
+          << "-" << groupset.groups.back().id << " uses the diffusion "
+          << "solver of another groupset.";
+        return;
+      }
+    }
+
     chi_math::UnknownManager scalar_uk_man;
     scalar_uk_man.AddUnknown(chi_math::UnknownType::SCALAR);
 
@@ -50,6 +66,7 @@ void LinearBoltzmann::Solver::InitTGDSA(LBSGroupset& groupset)
     dsolver->residual_tolerance = groupset.tgdsa_tol;
     dsolver->max_iters          = groupset.tgdsa_max_iters;
     dsolver->options_string     = groupset.tgdsa_string;
+    dsolver->matrix_free        = groupset.dsa_matrix_free;
     if (groupset.apply_wgdsa)
       dsolver->material_mode = DIFFUSION_MATERIALS_FROM_TRANSPORTXS_TTF_JFULL;
     else
@@ -83,6 +100,9 @@ void LinearBoltzmann::Solver::InitTGDSA(LBSGroupset& groupset)
     dsolver->Initialize(verbose);
     dsolver->ExecuteS(supress_assembly,supress_solver);
 
+    if (options.share_dsa_solvers)
+      shared_dsa_solvers.push_back({dsolver, &groupset, true});
+
     delta_phi_local.resize(0);
     delta_phi_local.shrink_to_fit();
   }//if wgdsa
@@ -92,8 +112,10 @@ void LinearBoltzmann::Solver::InitTGDSA(LBSGroupset& groupset)
 /**Cleans up memory consuming items. */
 void LinearBoltzmann::Solver::CleanUpTGDSA(LBSGroupset& groupset)
 {
-  if (groupset.apply_tgdsa)
+  if (groupset.apply_tgdsa and
+      not IsSharedDSASolver(groupset.tgdsa_solver))
     delete groupset.tgdsa_solver;
+  groupset.tgdsa_solver = nullptr;
 }
 
 //###################################################################
@@ -0,0 +1,200 @@
+#include "lbs_linear_boltzmann_solver.h"
+
+#include "ChiMesh/SweepUtilities/SweepBoundary/sweep_boundaries.h"
+
+#include "chi_log.h"
+extern ChiLog& chi_log;
+
+#include "chi_mpi.h"
+extern ChiMPI& chi_mpi;
+
+//###################################################################
+/**Initializes the coarse angular levels of the angular multigrid
+ * preconditioner. Each level gets its own groupset, with the groups of
+ * the fine groupset and the level's quadrature, along with sweep
+ * orderings, flux data structures and a sweep scheduler.
+ *
+ * The reflecting boundaries of the solver hold angular flux storage for
+ * the groupset being solved and can therefore not be shared with the
+ * coarse levels. Reflecting boundaries are treated as vacuum on the
+ * coarse levels instead, which only affects the effectiveness of the
+ * preconditioner, not the converged solution.*/
+void LinearBoltzmann::Solver::InitAngularMultigrid(LBSGroupset& groupset)
+{
+  if (groupset.angular_multigrid_levels.empty()) return;
+
+  typedef chi_mesh::sweep_management::BoundaryVacuum SweepVacuumBndry;
+
+  chi_log.Log(LOG_0)
+    << "Initializing " << groupset.angular_multigrid_levels.size()
+    << " angular multigrid level(s).";
+
+  //================================= Coarse level boundaries
+  std::vector<std::shared_ptr<SweepBndry>> level_boundaries;
+  for (auto& bndry : sweep_boundaries)
+  {
+    if (bndry->IsReflecting())
+      level_boundaries.push_back(
+        std::make_shared<SweepVacuumBndry>(zero_boundary));
+    else
+      level_boundaries.push_back(bndry);
+  }
+  std::swap(sweep_boundaries, level_boundaries);
+
+  //================================= Initialize levels
+  for (auto& level : groupset.angular_multigrid_levels)
+  {
+    auto level_groupset = std::make_shared<LBSGroupset>();
+
+    level_groupset->groups                 = groupset.groups;
+    level_groupset->quadrature             = level.quadrature;
+    level_groupset->angleagg_method        = groupset.angleagg_method;
+    level_groupset->master_num_grp_subsets = groupset.master_num_grp_subsets;
+    level_groupset->master_num_ang_subsets = groupset.master_num_ang_subsets;
+    level_groupset->allow_cycles           = groupset.allow_cycles;
+
+    if (level.quadrature->type !=
+        chi_math::AngularQuadratureType::ProductQuadrature)
+      level_groupset->angleagg_method = AngleAggregationType::SINGLE;
+
+    level_groupset->BuildDiscMomOperator(options.scattering_order,
+                                         options.geometry_type);
+    level_groupset->BuildMomDiscOperator(options.scattering_order,
+                                         options.geometry_type);
+    level_groupset->BuildSubsets();
+
+    ComputeSweepOrderings(*level_groupset);
+    InitFluxDataStructures(*level_groupset);
+
+    level.groupset    = level_groupset;
+    level.sweep_chunk = SetSweepChunk(*level_groupset);
+    level.sweep_scheduler = std::make_shared<MainSweepScheduler>(
+      SchedulingAlgorithm::DEPTH_OF_GRAPH,
+      level_groupset->angle_agg,
+      *level.sweep_chunk);
+    level.sweep_scheduler->sweep_chunk.SetSurfaceSourceActiveFlag(false);
+
+    chi_log.Log(LOG_0)
+      << "Angular multigrid level with "
+      << level.quadrature->abscissae.size() << " angles, scattering order "
+      << level.scattering_order << " and " << level.num_sweeps
+      << " sweep(s).";
+  }
+
+  std::swap(sweep_boundaries, level_boundaries);
+}
+
+//###################################################################
+/**Applies the angular multigrid correction to a flux iterate.
+ *
+ * The error of the iterate, \f$ e = \phi - \phi^{new} \f$, satisfies
+ * \f$ (L - S)e = S(\phi^{new} - \phi^{old}) \f$. This equation is
+ * solved approximately with a sawtooth cycle over the coarse levels,
+ * from fine to coarse. On each level a few source iterations are
+ * performed with the level's quadrature, where the scattering source and
+ * the resulting error moments are truncated to the level's scattering
+ * order. Moments above this order keep the values of the previous level.
+ * Finally the error is added to ref_phi_new.
+ *
+ * Only the within-groupset scattering source is used and the incident
+ * boundary fluxes are zero. q_moments_local and phi_old_local are
+ * restored afterwards.*/
+void LinearBoltzmann::Solver::
+  ApplyAngularMultigrid(LBSGroupset& groupset,
+                        const std::vector<double>& ref_phi_old,
+                        std::vector<double>& ref_phi_new)
+{
+  if (groupset.angular_multigrid_levels.empty()) return;
+
+  const int gsi = groupset.groups.front().id;
+  const size_t gss = groupset.groups.size();
+  const auto& m_to_ell_em_map =
+    groupset.quadrature->GetMomentToHarmonicsIndexMap();
+
+  //================================= Copies moments up to an order
+  auto CopyMomentsUpToOrder = [this,gsi,gss,&m_to_ell_em_map]
+    (const std::vector<double>& x_src, std::vector<double>& y,
+     unsigned int max_order)
+  {
+    for (const auto& cell : grid->local_cells)
+    {
+      auto& transport_view = cell_transport_views[cell.local_id];
+
+      for (int i=0; i < cell.vertex_ids.size(); i++)
+        for (int m=0; m<num_moments; m++)
+        {
+          if (m_to_ell_em_map[m].ell > max_order) continue;
+
+          size_t mapping = transport_view.MapDOF(i,m,gsi);
+          for (size_t g=0; g<gss; g++)
+            y[mapping+g] = x_src[mapping+g];
+        }//for moment
+    }//for cell
+  };
+
+  //================================= Update and error vectors
+  std::vector<double> delta_phi(ref_phi_new.size(), 0.0);
+  for (size_t i=0; i<delta_phi.size(); ++i)
+    delta_phi[i] = ref_phi_new[i] - ref_phi_old[i];
+
+  std::vector<double> error(ref_phi_new.size(), 0.0);
+  std::vector<double> scatter_phi(ref_phi_new.size(), 0.0);
+  std::vector<double> level_phi(ref_phi_new.size(), 0.0);
+  std::vector<double> level_q(q_moments_local.size(), 0.0);
+
+  const std::vector<double> saved_q_moments_local = q_moments_local;
+
+  //================================= Sawtooth cycle
+  for (auto& level : groupset.angular_multigrid_levels)
+  {
+    auto& level_groupset = *level.groupset;
+    level.sweep_scheduler->sweep_chunk.SetDestinationPhi(level_phi);
+
+    for (int s=0; s<level.num_sweeps; ++s)
+    {
+      //========================== Scattering source of update + error
+      for (size_t i=0; i<scatter_phi.size(); ++i)
+        scatter_phi[i] = delta_phi[i] + error[i];
+
+      q_moments_local.assign(q_moments_local.size(), 0.0);
+      std::swap(phi_old_local, scatter_phi);
+      SetSource(groupset, q_moments_local, APPLY_WGS_SCATTER_SOURCE);
+      std::swap(phi_old_local, scatter_phi);
+
+      level_q.assign(level_q.size(), 0.0);
+      CopyMomentsUpToOrder(q_moments_local, level_q, level.scattering_order);
+      std::swap(q_moments_local, level_q);
+
+      //========================== Coarse sweep
+      level_groupset.angle_agg.ZeroIncomingDelayedPsi();
+      level_groupset.ZeroAngularFluxDataStructures();
+      level_phi.assign(level_phi.size(), 0.0);
+      level.sweep_scheduler->Sweep();
+      AllreduceReplicaFluxMoments(level_groupset, level_phi);
+
+      CopyMomentsUpToOrder(level_phi, error, level.scattering_order);
+    }
+  }//for level
+
+  q_moments_local = saved_q_moments_local;
+
+  //================================= Add correction
+  for (size_t i=0; i<ref_phi_new.size(); ++i)
+    ref_phi_new[i] += error[i];
+}
+
+//###################################################################
+/**Destroys the coarse angular levels of the angular multigrid
+ * preconditioner.*/
+void LinearBoltzmann::Solver::CleanUpAngularMultigrid(LBSGroupset& groupset)
+{
+  for (auto& level : groupset.angular_multigrid_levels)
+  {
+    if (level.groupset == nullptr) continue;
+
+    level.sweep_scheduler = nullptr;
+    level.sweep_chunk     = nullptr;
+    ResetSweepOrderings(*level.groupset);
+    level.groupset        = nullptr;
+  }
+}
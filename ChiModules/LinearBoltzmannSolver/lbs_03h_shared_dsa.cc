@@ -0,0 +1,132 @@
+#include "lbs_linear_boltzmann_solver.h"
+
+#include "../DiffusionSolver/Solver/diffusion_solver.h"
+
+#include "chi_log.h"
+extern ChiLog& chi_log;
+
+//###################################################################
+/**Determines whether the DSA diffusion operators of two groupsets are
+ * identical, in which case they can share a single diffusion solver.
+ * Both groupsets must use the same DSA settings. For TGDSA the
+ * coefficients are collapsed over all groups and therefore only depend on
+ * whether WGDSA is also applied. For WGDSA the groupsets must have the
+ * same number of groups and identical per-group diffusion coefficients
+ * and removal cross sections.*/
+bool LinearBoltzmann::Solver::
+  DSAOperatorsMatch(const LBSGroupset& groupset_a,
+                    const LBSGroupset& groupset_b,
+                    bool two_grid) const
+{
+  if (groupset_a.dsa_matrix_free != groupset_b.dsa_matrix_free)
+    return false;
+
+  if (two_grid)
+  {
+    return groupset_a.apply_tgdsa     and groupset_b.apply_tgdsa     and
+           groupset_a.apply_wgdsa     == groupset_b.apply_wgdsa     and
+           groupset_a.tgdsa_tol       == groupset_b.tgdsa_tol       and
+           groupset_a.tgdsa_max_iters == groupset_b.tgdsa_max_iters and
+           groupset_a.tgdsa_verbose   == groupset_b.tgdsa_verbose   and
+           groupset_a.tgdsa_string    == groupset_b.tgdsa_string;
+  }
+
+  if (not (groupset_a.apply_wgdsa     and groupset_b.apply_wgdsa     and
+           groupset_a.wgdsa_tol       == groupset_b.wgdsa_tol       and
+           groupset_a.wgdsa_max_iters == groupset_b.wgdsa_max_iters and
+           groupset_a.wgdsa_verbose   == groupset_b.wgdsa_verbose   and
+           groupset_a.wgdsa_string    == groupset_b.wgdsa_string))
+    return false;
+
+  const size_t num_groups = groupset_a.groups.size();
+  if (groupset_b.groups.size() != num_groups)
+    return false;
+
+  const int gi_a = groupset_a.groups.front().id;
+  const int gi_b = groupset_b.groups.front().id;
+  for (const auto& xs : material_xs)
+    for (size_t g=0; g<num_groups; ++g)
+    {
+      if (xs->diffusion_coeff[gi_a + g] != xs->diffusion_coeff[gi_b + g])
+        return false;
+      if (xs->sigma_removal[gi_a + g] != xs->sigma_removal[gi_b + g])
+        return false;
+    }
+
+  return true;
+}
+
+//###################################################################
+/**Returns a shared DSA diffusion solver, previously built for another
+ * groupset, whose operator is identical to that of the given groupset.
+ * Returns nullptr if there is none.*/
+chi_physics::Solver* LinearBoltzmann::Solver::
+  FindSharedDSASolver(const LBSGroupset& groupset, bool two_grid) const
+{
+  for (const auto& shared : shared_dsa_solvers)
+    if (shared.two_grid == two_grid and
+        DSAOperatorsMatch(groupset, *shared.groupset, two_grid))
+      return shared.solver;
+
+  return nullptr;
+}
+
+//###################################################################
+/**Checks whether a DSA diffusion solver is owned by the list of shared
+ * DSA solvers, in which case it must not be deleted by a groupset.*/
+bool LinearBoltzmann::Solver::
+  IsSharedDSASolver(const chi_physics::Solver* dsa_solver) const
+{
+  for (const auto& shared : shared_dsa_solvers)
+    if (shared.solver == dsa_solver)
+      return true;
+
+  return false;
+}
+
+//###################################################################
+/**Destroys the DSA diffusion solvers shared between groupsets. The
+ * groupsets referring to them are reset.*/
+void LinearBoltzmann::Solver::DestroySharedDSASolvers()
+{
+  for (auto& groupset : group_sets)
+  {
+    if (IsSharedDSASolver(groupset.wgdsa_solver))
+      groupset.wgdsa_solver = nullptr;
+    if (IsSharedDSASolver(groupset.tgdsa_solver))
+      groupset.tgdsa_solver = nullptr;
+  }
+
+  for (auto& shared : shared_dsa_solvers)
+    delete shared.solver;
+
+  shared_dsa_solvers.clear();
+}
+
+//###################################################################
+/**Turns off the sharing of DSA diffusion solvers. The shared solvers are
+ * destroyed and the groupsets with retained setups that used them get
+ * their own solvers. All other retained setup is kept.*/
+void LinearBoltzmann::Solver::StopSharingDSASolvers()
+{
+  options.share_dsa_solvers = false;
+
+  std::vector<LBSGroupset*> wgdsa_groupsets;
+  std::vector<LBSGroupset*> tgdsa_groupsets;
+  for (auto& groupset : group_sets)
+  {
+    if (not groupset.setup_retained) continue;
+
+    if (IsSharedDSASolver(groupset.wgdsa_solver))
+      wgdsa_groupsets.push_back(&groupset);
+    if (IsSharedDSASolver(groupset.tgdsa_solver))
+      tgdsa_groupsets.push_back(&groupset);
+  }
+
+  DestroySharedDSASolvers();
+
+  for (auto groupset : wgdsa_groupsets)
+    InitWGDSA(*groupset);
+  for (auto groupset : tgdsa_groupsets)
+    InitTGDSA(*groupset);
+}
@@ -19,6 +19,9 @@ void LinearBoltzmann::Solver::WriteRestartData(std::string folder_name,
   typedef struct stat Stat;
   Stat st;
 
+  //Replicated domains hold identical data, only the first one writes
+  if (chi_mpi.replica_id != 0) return;
+
   //======================================== Make sure folder exists
   if (chi_mpi.location_id == 0)
   {
@@ -32,7 +35,7 @@ void LinearBoltzmann::Solver::WriteRestartData(std::string folder_name,
       }
   }
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //======================================== Create files
   //This step might fail for specific locations and
@@ -68,14 +71,14 @@ void LinearBoltzmann::Solver::WriteRestartData(std::string folder_name,
 
   //======================================== Wait for all processes
   //                                         then check success status
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
   bool global_succeeded = true;
   MPI_Allreduce(&location_succeeded,   //Send buffer
                 &global_succeeded,     //Recv buffer
                 1,                     //count
                 MPI_CXX_BOOL,          //Data type
                 MPI_LAND,              //Operation - Logical and
-                MPI_COMM_WORLD);       //Communicator
+                chi_mpi.comm);       //Communicator
 
   //======================================== Write status message
   if (global_succeeded)
@@ -95,7 +98,7 @@ void LinearBoltzmann::Solver::WriteRestartData(std::string folder_name,
 void LinearBoltzmann::Solver::ReadRestartData(std::string folder_name,
                                               std::string file_base)
 {
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //======================================== Open files
   //This step might fail for specific locations and
@@ -152,14 +155,14 @@ void LinearBoltzmann::Solver::ReadRestartData(std::string folder_name,
 
   //======================================== Wait for all processes
   //                                         then check success status
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
   bool global_succeeded = true;
   MPI_Allreduce(&location_succeeded,   //Send buffer
                 &global_succeeded,     //Recv buffer
                 1,                     //count
                 MPI_CXX_BOOL,          //Data type
                 MPI_LAND,              //Operation - Logical and
-                MPI_COMM_WORLD);       //Communicator
+                chi_mpi.comm);       //Communicator
 
   //======================================== Write status message
   if (global_succeeded)
@@ -16,6 +16,9 @@ void LinearBoltzmann::Solver::
   WriteGroupsetAngularFluxes(const LBSGroupset& groupset,
                              const std::string& file_base)
 {
+  //Replicated domains hold identical data, only the first one writes
+  if (chi_mpi.replica_id != 0) return;
+
   std::string file_name =
     file_base + std::to_string(chi_mpi.location_id) + ".data";
 
@@ -0,0 +1,234 @@
+#include "lbs_linear_boltzmann_solver.h"
+
+#include "ChiGraph/chi_directed_graph.h"
+
+#include <ChiPhysics/chi_physics.h>
+#include <ChiPhysics/PhysicsMaterial/chi_physicsmaterial.h>
+
+extern ChiPhysics&  chi_physics_handler;
+
+#include <chi_log.h>
+#include <chi_mpi.h>
+
+extern ChiLog& chi_log;
+extern ChiMPI& chi_mpi;
+
+//###################################################################
+/**Analyzes the combined transfer matrices of the materials, with
+ * transport cross-sections, of the cells of the solver's region and
+ * partitions the solver's groups into contiguous coupling blocks.
+ *
+ * A directed graph is built with an edge g'->g for every nonzero transfer
+ * from g' to g (any Legendre moment). The strongly connected components of
+ * this graph are the upscatter ranges. Because groupsets are contiguous
+ * and executed in ascending order, each strongly connected component is
+ * expanded to the group range it spans, and any remaining upscatter edge
+ * is merged into a single range so that no upscatter is lagged across
+ * groupsets. All other groups are downscatter-only and form single-group
+ * blocks.
+ *
+ * The blocks are returned in ascending group order, which is also the
+ * Gauss-Seidel order in which they should be solved.*/
+std::vector<LinearBoltzmann::GroupCouplingBlock>
+  LinearBoltzmann::Solver::ComputeGroupCouplingBlocks() const
+{
+  const int num_groups = static_cast<int>(groups.size());
+  if (num_groups == 0)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "LBS-ComputeGroupCouplingBlocks: The solver has no groups. "
+      << "Groups must be created before the coupling can be analyzed.";
+    exit(EXIT_FAILURE);
+  }
+
+  //================================================== Materials of the
+  //                                                   solver's cells
+  if (regions.empty())
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "LBS-ComputeGroupCouplingBlocks: The solver has no regions. "
+      << "A region must be added before the coupling can be analyzed.";
+    exit(EXIT_FAILURE);
+  }
+  auto region_grid = regions.back()->GetGrid();
+  if (region_grid == nullptr)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "LBS-ComputeGroupCouplingBlocks: No grid available from region.";
+    exit(EXIT_FAILURE);
+  }
+
+  const auto& material_stack = chi_physics_handler.material_stack;
+  const int num_materials = static_cast<int>(material_stack.size());
+
+  // All locations must analyze the same materials to agree on the blocks
+  std::vector<int> local_material_used(num_materials, 0);
+  for (const auto& cell : region_grid->local_cells)
+    if (cell.material_id >= 0 and cell.material_id < num_materials)
+      local_material_used[cell.material_id] = 1;
+
+  std::vector<int> material_used(num_materials, 0);
+  MPI_Allreduce(local_material_used.data(), material_used.data(),
+                num_materials, MPI_INT, MPI_MAX, chi_mpi.comm);
+
+  //================================================== Build coupling graph
+  chi_graph::DirectedGraph coupling_graph;
+  for (int g=0; g<num_groups; ++g)
+    coupling_graph.AddVertex();
+
+  std::vector<bool> self_scatter(num_groups, false);
+  std::vector<int>  span_end(num_groups, 0);
+  for (int g=0; g<num_groups; ++g) span_end[g] = g;
+
+  using MatProperty = chi_physics::PropertyType;
+  size_t num_xs_analyzed = 0;
+  for (int m=0; m<num_materials; ++m)
+  {
+    if (not material_used[m]) continue;
+
+    for (const auto& property : material_stack[m]->properties)
+    {
+      if (property->Type() != MatProperty::TRANSPORT_XSECTIONS) continue;
+
+      auto xs =
+        std::static_pointer_cast<chi_physics::TransportCrossSections>(property);
+      ++num_xs_analyzed;
+
+      for (const auto& transfer_matrix : xs->transfer_matrices)
+      {
+        const int num_rows = std::min(num_groups,
+                                      (int)transfer_matrix.rowI_indices.size());
+        for (int g=0; g<num_rows; ++g)
+        {
+          const auto& row_indices = transfer_matrix.rowI_indices[g];
+          const auto& row_values  = transfer_matrix.rowI_values[g];
+          for (size_t t=0; t<row_indices.size(); ++t)
+          {
+            const int gprime = static_cast<int>(row_indices[t]);
+            if (gprime >= num_groups) continue;
+            if (row_values[t] == 0.0) continue;
+
+            if (gprime == g)
+              self_scatter[g] = true;
+            else
+              coupling_graph.AddEdge(gprime, g);
+
+            //============================ Upscatter spans
+            if (gprime > g)
+              span_end[g] = std::max(span_end[g], gprime);
+          }//for t
+        }//for g
+      }//for transfer matrix
+    }//for property
+  }//for material
+
+  if (num_xs_analyzed == 0)
+    chi_log.Log(LOG_0WARNING)
+      << "LBS-ComputeGroupCouplingBlocks: No transport cross-sections found. "
+      << "All groups will be treated as uncoupled.";
+
+  //================================================== Upscatter SCCs
+  std::vector<bool> in_scc(num_groups, false);
+  auto SCCs = coupling_graph.FindStronglyConnectedComponents();
+  for (const auto& scc : SCCs)
+  {
+    int scc_first = *std::min_element(scc.begin(), scc.end());
+    int scc_last  = *std::max_element(scc.begin(), scc.end());
+    span_end[scc_first] = std::max(span_end[scc_first], scc_last);
+    for (int g : scc) in_scc[g] = true;
+  }
+
+  //================================================== Merge spans into blocks
+  std::vector<GroupCouplingBlock> blocks;
+  int g = 0;
+  while (g < num_groups)
+  {
+    GroupCouplingBlock block;
+    block.first_group = g;
+    int last = span_end[g];
+    for (int gg=g; gg<=last; ++gg)
+      last = std::max(last, span_end[gg]);
+    block.last_group = last;
+
+    for (int gg=block.first_group; gg<=block.last_group; ++gg)
+    {
+      if (in_scc[gg] or span_end[gg] > gg) block.has_upscatter = true;
+      if (self_scatter[gg]) block.has_inblock_scatter = true;
+    }
+    if (block.last_group > block.first_group)
+      block.has_inblock_scatter = true;
+
+    blocks.push_back(block);
+    g = last + 1;
+  }
+
+  //================================================== Print the partitioning
+  std::stringstream outstr;
+  outstr << "LBS group coupling analysis: " << num_groups << " groups, "
+         << SCCs.size() << " upscatter SCC(s), "
+         << blocks.size() << " block(s).\n";
+  for (const auto& block : blocks)
+  {
+    outstr << "  Groups [" << block.first_group << "-" << block.last_group
+           << "]";
+    if (block.has_upscatter)
+      outstr << " upscatter";
+    else if (block.has_inblock_scatter)
+      outstr << " downscatter-only";
+    else
+      outstr << " downscatter-only, no within-group scattering";
+    outstr << "\n";
+  }
+  chi_log.Log(LOG_0) << outstr.str();
+
+  return blocks;
+}
+
+//###################################################################
+/**Replaces the solver's groupsets with one groupset per coupling block.
+ * All settings (quadrature, iterative method, tolerances, acceleration,
+ * etc.) are copied from the groupset with the given index. Blocks without
+ * any within-block scattering are limited to a single iteration, unless
+ * reflecting boundaries are present, since one sweep is then an exact
+ * solve.*/
+void LinearBoltzmann::Solver::CreateGroupsetsFromCouplingBlocks(
+  const std::vector<GroupCouplingBlock>& blocks,
+  size_t template_groupset_index)
+{
+  if (template_groupset_index >= group_sets.size())
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "LBS-CreateGroupsetsFromCouplingBlocks: Invalid template groupset "
+      << "index " << template_groupset_index << ". A template groupset "
+      << "must be created before groupsets can be partitioned.";
+    exit(EXIT_FAILURE);
+  }
+
+  bool has_reflecting_bndry = false;
+  for (const auto& bndry : boundary_types)
+    if (bndry.first == BoundaryType::REFLECTING)
+      has_reflecting_bndry = true;
+
+  const LBSGroupset template_groupset = group_sets[template_groupset_index];
+
+  std::vector<LBSGroupset> new_group_sets;
+  new_group_sets.reserve(blocks.size());
+  for (const auto& block : blocks)
+  {
+    new_group_sets.push_back(template_groupset);
+    auto& groupset = new_group_sets.back();
+
+    groupset.groups.clear();
+    for (int g=block.first_group; g<=block.last_group; ++g)
+      groupset.groups.push_back(groups.at(g));
+
+    if (not block.has_inblock_scatter and not has_reflecting_bndry)
+      groupset.max_iterations = 1;
+  }
+
+  group_sets = std::move(new_group_sets);
+
+  chi_log.Log(LOG_0)
+    << "LBS: Created " << group_sets.size()
+    << " groupset(s) from group coupling blocks.";
+}
@@ -0,0 +1,93 @@
+#include "lbs_linear_boltzmann_solver.h"
+
+#include "chi_log.h"
+extern ChiLog&     chi_log;
+
+#include "chi_mpi.h"
+extern ChiMPI&      chi_mpi;
+
+//###################################################################
+/**Swaps a groupset's quadrature for its continuation quadrature. The
+ * angular operators and angle subsets are rebuilt for the coarse
+ * quadrature, whereas those of the groupset's own quadrature are kept
+ * intact for when EndAngularContinuation swaps it back. Angular fluxes
+ * are not saved while the continuation quadrature is active.*/
+void LinearBoltzmann::Solver::BeginAngularContinuation(LBSGroupset& groupset)
+{
+  if (groupset.continuation_active or
+      groupset.continuation_quadrature == nullptr) return;
+
+  std::swap(groupset.quadrature, groupset.continuation_quadrature);
+  groupset.continuation_active = true;
+  groupset.psi_to_be_saved = false;
+
+  groupset.BuildDiscMomOperator(options.scattering_order,
+                                options.geometry_type);
+  groupset.BuildMomDiscOperator(options.scattering_order,
+                                options.geometry_type);
+  groupset.BuildSubsets();
+
+  //============================================= Moments must be compatible
+  const size_t num_coarse_moments =
+    groupset.quadrature->GetMomentToHarmonicsIndexMap().size();
+  if (num_coarse_moments != static_cast<size_t>(num_moments))
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Angular continuation: The continuation quadrature supports "
+      << num_coarse_moments << " moments whereas the solver uses "
+      << num_moments << " moments.";
+    exit(EXIT_FAILURE);
+  }
+}
+
+//###################################################################
+/**Restores the groupset's own quadrature after angular continuation.*/
+void LinearBoltzmann::Solver::EndAngularContinuation(LBSGroupset& groupset)
+{
+  if (not groupset.continuation_active) return;
+
+  std::swap(groupset.quadrature, groupset.continuation_quadrature);
+  groupset.continuation_active = false;
+  groupset.psi_to_be_saved = options.save_angular_flux;
+
+  groupset.BuildSubsets();
+}
+
+//###################################################################
+/**Solves a groupset with its continuation quadrature, to the groupset's
+ * continuation tolerance, so that phi_old_local holds an initial guess
+ * for the solve with the groupset's own quadrature. Restart data is not
+ * written for the coarse solve.*/
+void LinearBoltzmann::Solver::
+  SolveGroupsetAngularContinuation(LBSGroupset& groupset, int group_set_num)
+{
+  if (groupset.continuation_quadrature == nullptr) return;
+
+  chi_log.Log(LOG_0)
+    << "\n********* Angular continuation of Groupset " << group_set_num
+    << " with " << groupset.continuation_quadrature->abscissae.size()
+    << " angles\n" << std::endl;
+
+  const double residual_tolerance = groupset.residual_tolerance;
+  const bool   write_restart_data = options.write_restart_data;
+
+  groupset.residual_tolerance = std::max(residual_tolerance,
+                                         groupset.continuation_tolerance);
+  options.write_restart_data = false;
+
+  BeginAngularContinuation(groupset);
+
+  ComputeSweepOrderings(groupset);
+  InitFluxDataStructures(groupset);
+
+  SolveGroupset(groupset, group_set_num);
+
+  ResetSweepOrderings(groupset);
+
+  EndAngularContinuation(groupset);
+
+  groupset.residual_tolerance = residual_tolerance;
+  options.write_restart_data = write_restart_data;
+
+  MPI_Barrier(chi_mpi.comm);
+}
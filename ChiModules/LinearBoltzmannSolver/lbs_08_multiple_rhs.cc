@@ -0,0 +1,259 @@
+#include "lbs_linear_boltzmann_solver.h"
+#include "SweepChunks/lbs_sweepchunk_pwl_multirhs.h"
+
+#include "DiffusionSolver/Solver/diffusion_solver.h"
+
+#include "chi_log.h"
+extern ChiLog&     chi_log;
+
+#include "chi_mpi.h"
+extern ChiMPI&      chi_mpi;
+
+#include "ChiTimer/chi_timer.h"
+extern ChiTimer chi_program_timer;
+
+#include <iomanip>
+
+//###################################################################
+/**Sets the source of a right-hand side of a multiple right-hand side
+ * solve. The material sources and the flux moments of the right-hand side
+ * are swapped into the solver's material sources and phi_old_local for
+ * the duration of the SetSource call.*/
+void LinearBoltzmann::Solver::SetRHSSource(LBSGroupset& groupset,
+                                           size_t rhs,
+                                           std::vector<double>& destination_q,
+                                           SourceFlags source_flags)
+{
+  auto& rhs_source = rhs_sources[rhs];
+
+  if (rhs_source.matid_to_src_map.size() < matid_to_src_map.size())
+    rhs_source.matid_to_src_map.resize(matid_to_src_map.size(), -1);
+
+  std::swap(material_srcs, rhs_source.material_srcs);
+  std::swap(matid_to_src_map, rhs_source.matid_to_src_map);
+  std::swap(phi_old_local, rhs_phi_local[rhs]);
+
+  SetSource(groupset, destination_q, source_flags);
+
+  std::swap(phi_old_local, rhs_phi_local[rhs]);
+  std::swap(matid_to_src_map, rhs_source.matid_to_src_map);
+  std::swap(material_srcs, rhs_source.material_srcs);
+}
+
+//###################################################################
+/**Solves a groupset for all the right-hand sides in rhs_sources with
+ * batched source iterations. Each iteration sweeps all right-hand sides
+ * at once with a SweepChunkPWLMultiRHS, after which the within-groupset
+ * DSA corrections are applied to each right-hand side individually.
+ *
+ * Convergence is checked per right-hand side, with the same point-wise
+ * change criterion as ClassicRichardson, and the iterations stop once all
+ * right-hand sides have converged. The groupset's FLUDS and angle sets
+ * must have been initialized with groupset.num_rhs equal to the number of
+ * right-hand sides. The solutions are placed in rhs_phi_local.*/
+bool LinearBoltzmann::Solver::SolveGroupsetMultiRHS(LBSGroupset& groupset,
+                                                    int group_set_num)
+{
+  const size_t num_rhs = rhs_sources.size();
+
+  chi_log.Log(LOG_0) << "\n\n";
+  chi_log.Log(LOG_0) << "********** Solving groupset" << group_set_num
+                     << " for " << num_rhs << " right-hand sides"
+                     << " with batched source iterations.\n\n";
+  chi_log.Log(LOG_0)
+    << "Quadrature number of angles: "
+    << groupset.quadrature->abscissae.size() << "\n"
+    << "Groups " << groupset.groups.front().id << " "
+    << groupset.groups.back().id << "\n\n";
+
+  if (static_cast<size_t>(groupset.num_rhs) != num_rhs)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "SolveGroupsetMultiRHS: Groupset " << group_set_num
+      << " was initialized for " << groupset.num_rhs
+      << " right-hand sides but the solver has " << num_rhs << ".";
+    exit(EXIT_FAILURE);
+  }
+
+  auto pwl_sdm =
+    std::dynamic_pointer_cast<SpatialDiscretization_PWLD>(discretization);
+  if (not pwl_sdm or
+      options.geometry_type == GeometryType::ONED_SPHERICAL or
+      options.geometry_type == GeometryType::TWOD_CYLINDRICAL)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "SolveGroupsetMultiRHS: Multiple right-hand side solves require "
+      << "the cartesian PWLD spatial discretization.";
+    exit(EXIT_FAILURE);
+  }
+
+  source_event_tag = chi_log.GetRepeatingEventTag("Set Source");
+
+  if (rhs_phi_local.size() != num_rhs)
+    rhs_phi_local.assign(num_rhs, std::vector<double>(phi_old_local.size(), 0.0));
+
+  std::vector<std::vector<double>> rhs_q(num_rhs,
+    std::vector<double>(q_moments_local.size(), 0.0));
+  std::vector<std::vector<double>> rhs_phi_new(num_rhs,
+    std::vector<double>(phi_new_local.size(), 0.0));
+
+  //================================================== Setting up the
+  //                                                   batched sweep chunk
+  auto sweep_chunk = std::make_shared<SweepChunkPWLMultiRHS>(
+        grid,                                    //Spatial grid of cells
+        *pwl_sdm,                                //Spatial discretization
+        cell_transport_views,                    //Cell transport views
+        rhs_phi_new,                             //Destination phis
+        rhs_q,                                   //Source moments
+        groupset,                                //Reference groupset
+        material_xs,                             //Material cross-sections
+        num_moments,
+        max_cell_dof_count);
+  MainSweepScheduler sweep_scheduler(SchedulingAlgorithm::DEPTH_OF_GRAPH,
+                                     groupset.angle_agg,
+                                     *sweep_chunk);
+  sweep_scheduler.sweep_chunk.SetSurfaceSourceActiveFlag(true);
+
+  groupset.angle_agg.ZeroIncomingDelayedPsi();
+
+  const auto source_flags = APPLY_MATERIAL_SOURCE |
+                            APPLY_AGS_SCATTER_SOURCE |
+                            APPLY_WGS_SCATTER_SOURCE |
+                            APPLY_AGS_FISSION_SOURCE |
+                            APPLY_WGS_FISSION_SOURCE;
+
+  //================================================== Now start iterating
+  std::vector<double> pw_change_prev(num_rhs, 1.0);
+  std::vector<int>    num_its_rhs(num_rhs, groupset.max_iterations);
+  std::vector<bool>   rhs_converged(num_rhs, false);
+  size_t num_converged = 0;
+  for (int it = 0; it < groupset.max_iterations; ++it)
+  {
+    for (size_t r=0; r<num_rhs; ++r)
+    {
+      rhs_q[r].assign(rhs_q[r].size(), 0.0);
+      SetRHSSource(groupset, r, rhs_q[r], source_flags);
+      rhs_phi_new[r].assign(rhs_phi_new[r].size(), 0.0);
+    }
+
+    groupset.ZeroAngularFluxDataStructures();
+    sweep_scheduler.Sweep();
+
+    double max_pw_change = 0.0;
+    for (size_t r=0; r<num_rhs; ++r)
+    {
+      auto& phi_old_r = rhs_phi_local[r];
+      auto& phi_new_r = rhs_phi_new[r];
+
+      AllreduceReplicaFluxMoments(groupset, phi_new_r);
+
+      if (groupset.apply_wgdsa)
+      {
+        AssembleWGDSADeltaPhiVector(groupset, phi_old_r.data(), phi_new_r.data());
+        ((chi_diffusion::Solver*)groupset.wgdsa_solver)->ExecuteS(true,false);
+        DisAssembleWGDSADeltaPhiVector(groupset, phi_new_r.data());
+      }
+      if (groupset.apply_tgdsa)
+      {
+        AssembleTGDSADeltaPhiVector(groupset, phi_old_r.data(), phi_new_r.data());
+        ((chi_diffusion::Solver*)groupset.tgdsa_solver)->ExecuteS(true,false);
+        DisAssembleTGDSADeltaPhiVector(groupset, phi_new_r.data());
+      }
+
+      std::swap(phi_old_local, phi_old_r);
+      std::swap(phi_new_local, phi_new_r);
+      double pw_change = ComputePiecewiseChange(groupset);
+      std::swap(phi_new_local, phi_new_r);
+      std::swap(phi_old_local, phi_old_r);
+
+      ScopedCopySTLvectors(groupset, phi_new_r, phi_old_r);
+
+      double rho = (it == 0) ? 0.0 : sqrt(pw_change / pw_change_prev[r]);
+      pw_change_prev[r] = pw_change;
+      max_pw_change = std::max(max_pw_change, pw_change);
+
+      if (not rhs_converged[r] and
+          pw_change<std::max(groupset.residual_tolerance*(1.0-rho),1.0e-10))
+      {
+        rhs_converged[r] = true;
+        num_its_rhs[r] = it + 1;
+        ++num_converged;
+      }
+    }//for rhs
+
+    //======================================== Print iteration information
+    {
+      std::stringstream iter_info;
+      iter_info
+        << chi_program_timer.GetTimeString() << " "
+        << "WGS groups ["
+        << groupset.groups.front().id
+        << "-"
+        << groupset.groups.back().id
+        << "]"
+        << " Iteration " << std::setw(5) << it
+        << " Max point-wise change " << std::setw(14) << max_pw_change
+        << " RHS converged " << std::setw(5) << num_converged
+        << "/" << num_rhs;
+
+      if (num_converged == num_rhs)
+        iter_info << " CONVERGED\n";
+
+      if (options.verbose_inner_iterations)
+        chi_log.Log(LOG_0) << iter_info.str();
+    }
+
+    if (num_converged == num_rhs) break;
+  }
+
+  num_sweeps += sweep_scheduler.GetNumberOfSweeps();
+
+  //============================================= Print solution info
+  {
+    double sweep_time = sweep_scheduler.GetAverageSweepTime();
+    size_t num_angles = groupset.quadrature->abscissae.size();
+    size_t num_unknowns = glob_node_count *
+                          num_angles *
+                          groupset.groups.size() *
+                          num_rhs;
+
+    chi_log.Log(LOG_0)
+      << "\n\n";
+    for (size_t r=0; r<num_rhs; ++r)
+      chi_log.Log(LOG_0)
+        << "        RHS " << std::setw(4) << r << " iterations:       "
+        << num_its_rhs[r] << (rhs_converged[r] ? "" : " NOT CONVERGED");
+    chi_log.Log(LOG_0)
+      << "        Average sweep time (s):        "
+      << sweep_time;
+    chi_log.Log(LOG_0)
+      << "        Sweep Time/Unknown (ns):       "
+      << sweep_time*1.0e9*chi_mpi.process_count/
+         static_cast<double>(num_unknowns);
+    chi_log.Log(LOG_0)
+      << "        Number of unknowns per sweep:  " << num_unknowns;
+    chi_log.Log(LOG_0)
+      << "\n\n";
+  }
+
+  return num_converged == num_rhs;
+}
+
+//###################################################################
+/**Copies the flux moments of a right-hand side of a multiple right-hand
+ * side solve to phi_old_local and phi_new_local, so that the solver's
+ * field functions reflect the given right-hand side.*/
+void LinearBoltzmann::Solver::CopyRHSSolution(size_t rhs)
+{
+  if (rhs >= rhs_phi_local.size())
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "CopyRHSSolution: Invalid right-hand side index " << rhs
+      << ". The solver holds " << rhs_phi_local.size()
+      << " right-hand side solutions.";
+    exit(EXIT_FAILURE);
+  }
+
+  phi_old_local = rhs_phi_local[rhs];
+  phi_new_local = rhs_phi_local[rhs];
+}
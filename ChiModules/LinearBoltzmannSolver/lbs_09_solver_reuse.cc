@@ -0,0 +1,123 @@
+#include "lbs_linear_boltzmann_solver.h"
+#include "Tools/ksp_data_context.h"
+
+#include "chi_log.h"
+extern ChiLog&     chi_log;
+
+#include "chi_mpi.h"
+extern ChiMPI&      chi_mpi;
+
+//###################################################################
+/**Destroys the sweep orderings, FLUDS, sweep chunk, DSA solvers and
+ * angular multigrid levels of a groupset.*/
+void LinearBoltzmann::Solver::ReleaseGroupsetSetup(LBSGroupset& groupset)
+{
+  if (gmres_krylov_objects and
+      gmres_krylov_objects->groupset == &groupset)
+    DestroyGMRESKrylovObjects();
+
+  groupset.retained_sweep_scheduler = nullptr;
+  groupset.retained_sweep_chunk     = nullptr;
+
+  CleanUpWGDSA(groupset);
+  CleanUpTGDSA(groupset);
+  CleanUpAngularMultigrid(groupset);
+
+  ResetSweepOrderings(groupset);
+  groupset.num_rhs = 1;
+  groupset.setup_retained = false;
+}
+
+//###################################################################
+/**Destroys the setup of all groupsets that was retained between calls to
+ * Execute with the retain_setup option, as well as the DSA solvers shared
+ * between groupsets.*/
+void LinearBoltzmann::Solver::ReleaseSetup()
+{
+  for (auto& groupset : group_sets)
+    if (groupset.setup_retained)
+      ReleaseGroupsetSetup(groupset);
+
+  DestroyGMRESKrylovObjects();
+  DestroySharedDSASolvers();
+}
+
+//###################################################################
+/**Re-reads the cross sections and sources of the physics materials,
+ * after they have been altered in place, without re-initializing the
+ * solver. The spatial discretization, flux moment arrays and any retained
+ * sweep structures are kept, and the flux moments are used as the initial
+ * guess of the next Execute. Only the DSA solvers of retained groupsets,
+ * which depend on the cross sections, are rebuilt.
+ *
+ * Cells must keep their material ids, since the cell transport views
+ * hold the cross section mappings.*/
+void LinearBoltzmann::Solver::UpdateMaterials()
+{
+  chi_log.Log(LOG_0) << "Updating LBS materials.";
+
+  //================================================== Unique material ids
+  std::set<int> unique_material_ids;
+  for (auto& cell : grid->local_cells)
+    unique_material_ids.insert(cell.material_id);
+
+  const std::vector<int> old_matid_to_xs_map = matid_to_xs_map;
+
+  InitMaterials(unique_material_ids);
+
+  //================================================== Check compatibility
+  if (matid_to_xs_map != old_matid_to_xs_map)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "LBS-UpdateMaterials: The material to cross section mapping "
+      << "changed. The solver must be re-initialized.";
+    exit(EXIT_FAILURE);
+  }
+
+  //The cell moment counts were truncated to the materials' orders
+  if (options.use_material_scattering_order)
+  {
+    const auto& m_to_ell_em_map =
+      group_sets.front().quadrature->GetMomentToHarmonicsIndexMap();
+
+    for (const auto& cell : grid->local_cells)
+    {
+      const auto& transport_view = cell_transport_views[cell.local_id];
+      const auto& xs = material_xs[transport_view.XSMapping()];
+      size_t num_ell = std::max<size_t>(xs->transfer_matrices.size(), 1);
+
+      int num_xs_moms = 0;
+      for (const auto& ell_em : m_to_ell_em_map)
+        if (ell_em.ell < num_ell) ++num_xs_moms;
+
+      if (num_xs_moms != transport_view.NumMoments())
+      {
+        chi_log.Log(LOG_ALLERROR)
+          << "LBS-UpdateMaterials: The scattering order of a material "
+          << "changed while use_material_scattering_order is set. The "
+          << "solver must be re-initialized.";
+        exit(EXIT_FAILURE);
+      }
+    }
+  }
+
+  //================================================== Rebuild DSA solvers
+  DestroyGMRESKrylovObjects();
+  for (auto& groupset : group_sets)
+  {
+    if (not groupset.setup_retained) continue;
+
+    CleanUpWGDSA(groupset);
+    CleanUpTGDSA(groupset);
+  }
+  DestroySharedDSASolvers();
+  for (auto& groupset : group_sets)
+  {
+    if (not groupset.setup_retained) continue;
+
+    InitWGDSA(groupset);
+    InitTGDSA(groupset);
+  }
+
+  MPI_Barrier(chi_mpi.comm);
+}
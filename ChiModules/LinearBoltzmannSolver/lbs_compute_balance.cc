@@ -5,6 +5,9 @@
 #include "chi_log.h"
 extern ChiLog& chi_log;
 
+#include "chi_mpi.h"
+extern ChiMPI& chi_mpi;
+
 #include <iomanip>
 
 //###################################################################
@@ -21,7 +24,7 @@ void LinearBoltzmann::Solver::ZeroOutflowBalanceVars(LBSGroupset& groupset)
 /**Compute balance.*/
 void LinearBoltzmann::Solver::ComputeBalance()
 {
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
   chi_log.Log() << "\n********** Computing balance\n";
 
   auto pwld =
@@ -126,6 +129,12 @@ void LinearBoltzmann::Solver::ComputeBalance()
       }//for g
   }//for cell
 
+  //======================================== Consolidate replica outflows
+  // Each replica only tallied the outflow of the groups it swept
+  if (chi_mpi.num_replicas > 1)
+    MPI_Allreduce(MPI_IN_PLACE, &local_out_flow, 1, MPI_DOUBLE, MPI_SUM,
+                  chi_mpi.replica_comm);
+
   //======================================== Consolidate local balances
   double local_balance = local_production + local_in_flow
                        - local_absorption - local_out_flow;
@@ -145,7 +154,7 @@ void LinearBoltzmann::Solver::ComputeBalance()
                 globl_balance_table.data(),      //recvbuf
                 table_size,MPI_DOUBLE,           //count + datatype
                 MPI_SUM,                         //operation
-                MPI_COMM_WORLD);                 //communicator
+                chi_mpi.comm);                 //communicator
 
   double globl_absorption = globl_balance_table.at(0);
   double globl_production = globl_balance_table.at(1);
@@ -166,5 +175,5 @@ void LinearBoltzmann::Solver::ComputeBalance()
 
   chi_log.Log() << "\n********** Done computing balance\n";
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 }
\ No newline at end of file
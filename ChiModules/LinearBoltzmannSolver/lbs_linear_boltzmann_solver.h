@@ -22,6 +22,8 @@ typedef sweep_namespace::SchedulingAlgorithm SchedulingAlgorithm;
 
 namespace LinearBoltzmann
 {
+struct GMRESKrylovObjects;
+
 enum class BoundaryType
 {
   VACUUM = 1,
@@ -45,7 +47,22 @@ enum class BoundaryType
                                     static_cast<int>(f2));
   }
 
+/**A DSA diffusion solver shared by groupsets with identical diffusion
+ * operators. The groupset is the one for which the solver was built.*/
+struct SharedDSASolver
+{
+  chi_physics::Solver* solver   = nullptr;
+  const LBSGroupset*   groupset = nullptr;
+  bool                 two_grid = false;
+};
 
+/**Material sources of one right-hand side of a multiple right-hand side
+ * solve. Same layout as the solver's material_srcs and matid_to_src_map.*/
+struct RHSSource
+{
+  std::vector<std::shared_ptr<chi_physics::IsotropicMultiGrpSource>> material_srcs;
+  std::vector<int> matid_to_src_map;
+};
 
 
 
@@ -63,12 +80,17 @@ public:
 
   int num_moments;
 
+  size_t num_sweeps = 0; ///< Transport sweeps of the last execution
+  size_t num_inner_iterations = 0; ///< Source or Krylov iterations of the
+                                   ///< last execution
+
   std::vector<LBSGroup> groups;
   std::vector<LBSGroupset> group_sets;
   std::vector<std::shared_ptr<chi_physics::TransportCrossSections>> material_xs;
   std::vector<std::shared_ptr<chi_physics::IsotropicMultiGrpSource>> material_srcs;
   std::vector<int> matid_to_xs_map;
   std::vector<int> matid_to_src_map;
+  std::vector<RHSSource> rhs_sources;
 
   std::shared_ptr<SpatialDiscretization> discretization;
   chi_mesh::MeshContinuumPtr grid;
@@ -90,9 +112,12 @@ public:
   unsigned long long glob_node_count;
 
   Vec phi_new, phi_old, q_fixed;
+  std::shared_ptr<GMRESKrylovObjects> gmres_krylov_objects;
+  std::vector<SharedDSASolver> shared_dsa_solvers;
   std::vector<double> q_moments_local;
   std::vector<double> phi_new_local, phi_old_local;
   std::vector<double> delta_phi_local;
+  std::vector<std::vector<double>> rhs_phi_local;
 
  public:
   //00
@@ -118,6 +143,9 @@ public:
   void Execute() override;
   void SolveGroupset(LBSGroupset& groupset,
                      int group_set_num);
+  //02a
+  size_t FindPipelinedGroupsetChainEnd(size_t first_gs) const;
+  void SolveGroupsetsPipelined(size_t first_gs, size_t last_gs);
 
   //03a
   void ComputeSweepOrderings(LBSGroupset& groupset) const;
@@ -144,9 +172,24 @@ public:
   void DisAssembleTGDSADeltaPhiVector(LBSGroupset& groupset,
                                       double *ref_phi_new);
   void CleanUpTGDSA(LBSGroupset& groupset);
+  //03g
+  void InitAngularMultigrid(LBSGroupset& groupset);
+  void ApplyAngularMultigrid(LBSGroupset& groupset,
+                             const std::vector<double>& ref_phi_old,
+                             std::vector<double>& ref_phi_new);
+  void CleanUpAngularMultigrid(LBSGroupset& groupset);
 
   //03f
   void ResetSweepOrderings(LBSGroupset& groupset);
+  //03h
+  bool DSAOperatorsMatch(const LBSGroupset& groupset_a,
+                         const LBSGroupset& groupset_b,
+                         bool two_grid) const;
+  chi_physics::Solver* FindSharedDSASolver(const LBSGroupset& groupset,
+                                           bool two_grid) const;
+  bool IsSharedDSASolver(const chi_physics::Solver* dsa_solver) const;
+  void DestroySharedDSASolvers();
+  void StopSharingDSASolvers();
 
   //04
   void WriteRestartData(std::string folder_name, std::string file_base);
@@ -156,23 +199,68 @@ public:
   void ReadGroupsetAngularFluxes(LBSGroupset& groupset,
                                  const std::string& file_base);
 
+  //06
+  std::vector<GroupCouplingBlock> ComputeGroupCouplingBlocks() const;
+  void CreateGroupsetsFromCouplingBlocks(
+    const std::vector<GroupCouplingBlock>& blocks,
+    size_t template_groupset_index);
+  //07
+  void BeginAngularContinuation(LBSGroupset& groupset);
+  void EndAngularContinuation(LBSGroupset& groupset);
+  void SolveGroupsetAngularContinuation(LBSGroupset& groupset,
+                                        int group_set_num);
+  //08
+  void SetRHSSource(LBSGroupset& groupset, size_t rhs,
+                    std::vector<double>& destination_q,
+                    SourceFlags source_flags);
+  bool SolveGroupsetMultiRHS(LBSGroupset& groupset, int group_set_num);
+  void CopyRHSSolution(size_t rhs);
+  //09
+  void ReleaseGroupsetSetup(LBSGroupset& groupset);
+  void ReleaseSetup();
+  void UpdateMaterials();
+
   //IterativeMethods
   virtual void SetSource(LBSGroupset& groupset,
                          std::vector<double>&  destination_q,
                          SourceFlags source_flags);
   double ComputePiecewiseChange(LBSGroupset& groupset);
+  double ComputeLocalPiecewiseChange(LBSGroupset& groupset);
+  bool IsGroupSubsetLocal(size_t subset) const;
+  bool IsAngularSubsetLocal(size_t angular_subset) const;
+  void AllreduceReplicaFluxMoments(LBSGroupset& groupset,
+                                   std::vector<double>& phi);
+  void AllreduceReplicaAngularFluxes(LBSGroupset& groupset);
   virtual std::shared_ptr<SweepChunk> SetSweepChunk(LBSGroupset& groupset);
   bool ClassicRichardson(LBSGroupset& groupset,
                          int group_set_num,
                          MainSweepScheduler& sweep_scheduler,
                          SourceFlags source_flags,
                          bool log_info = true);
+  bool RichardsonIteration(LBSGroupset& groupset,
+                           MainSweepScheduler& sweep_scheduler,
+                           const std::vector<double>& init_q_moments_local,
+                           SourceFlags source_flags,
+                           int k,
+                           double& pw_change_prev,
+                           bool log_info,
+                           const std::string& info_suffix = "");
+  void LogRichardsonSolveInfo(LBSGroupset& groupset,
+                              int group_set_num,
+                              MainSweepScheduler& sweep_scheduler);
+  bool Anderson(LBSGroupset& groupset,
+                int group_set_num,
+                MainSweepScheduler& sweep_scheduler,
+                SourceFlags source_flags,
+                bool log_info = true);
   bool GMRES(LBSGroupset& groupset,
              int group_set_num,
              MainSweepScheduler& sweep_scheduler,
              SourceFlags lhs_src_scope,
              SourceFlags rhs_src_scope,
-             bool log_info = true);
+             bool log_info = true,
+             bool reuse_krylov_objects = false);
+  void DestroyGMRESKrylovObjects();
 
   //Vector assembly
   void SetPETScVecFromSTLvector(LBSGroupset& groupset, Vec x,
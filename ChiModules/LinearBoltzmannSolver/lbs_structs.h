@@ -49,11 +49,42 @@ struct Options
   bool verbose_inner_iterations = true;
   bool verbose_outer_iterations = true;
 
+  bool use_material_scattering_order = false;
+
+  bool pipeline_downscatter_groupsets = false;
+
+  bool angle_domain_decomposition = false;
+
+  bool use_cmfd = false;
+
+  bool retain_setup = false; ///< Keep sweep and DSA structures between executes
+
+  bool share_dsa_solvers = false; ///< Groupsets with equal DSA operators share
+
   Options() = default;
 };
 
 
-/**Transport view of a cell*/
+/**A contiguous range of energy groups that is coupled by upscattering.
+ * Blocks without upscatter are single groups that only receive
+ * downscatter from preceding blocks and can therefore be solved once, in
+ * ascending order, Gauss-Seidel style.*/
+struct GroupCouplingBlock
+{
+  int  first_group = 0;
+  int  last_group  = 0;
+  bool has_upscatter = false;       ///< Block contains upscatter cycles
+  bool has_inblock_scatter = false; ///< Any scattering within the block
+};
+
+/**Transport view of a cell.
+ *
+ * The flux-moment storage of every cell is strided by the global number of
+ * moments so that unknown managers and field functions remain valid. The
+ * number of moments actually sourced and accumulated on the cell can however
+ * be smaller than the global number when the cell's material has a lower
+ * scattering order (see NumMoments()). Moments beyond this number are
+ * never written to and remain zero.*/
 class CellLBSView
 {
 private:
@@ -61,15 +92,18 @@ private:
   int num_nodes;
   int num_grps;
   int num_grps_moms;
+  int num_cell_moms;
   int xs_mapping;
   std::vector<bool> face_local_flags = {};
   std::vector<double> outflow;
+  std::vector<double> face_currents;
 
 public:
   CellLBSView(size_t in_phi_address,
               int in_num_nodes,
               int in_num_grps,
               int in_num_moms,
+              int in_num_cell_moms,
               int in_xs_mapping,
               const std::vector<bool>& in_face_local_flags,
               bool cell_on_boundary) :
@@ -77,6 +111,7 @@ public:
     num_nodes(in_num_nodes),
     num_grps(in_num_grps),
     num_grps_moms(in_num_grps*in_num_moms),
+    num_cell_moms(in_num_cell_moms),
     xs_mapping(in_xs_mapping),
     face_local_flags(in_face_local_flags)
   {
@@ -95,6 +130,10 @@ public:
 
   int NumNodes() const {return num_nodes;}
 
+  /**Number of moments active on this cell. Always less than or equal to
+   * the global number of moments.*/
+  int NumMoments() const {return num_cell_moms;}
+
   void ZeroOutflow(     ) {outflow.assign(outflow.size(),0.0);}
   void ZeroOutflow(int g) {if (g<outflow.size()) outflow[g]=0.0;}
   void AddOutflow(int g, double intS_mu_psi)
@@ -106,6 +145,21 @@ public:
     if (g<outflow.size()) return outflow[g];
     else return 0.0;
   }
+
+  /**Enables the tallying of the net outward current through each face.*/
+  void EnableFaceCurrents(size_t num_faces)
+  {face_currents.assign(num_faces*num_grps,0.0);}
+  bool TalliesFaceCurrents() const {return not face_currents.empty();}
+  void ZeroFaceCurrents() {face_currents.assign(face_currents.size(),0.0);}
+  void AddFaceCurrent(int f, int g, double intS_mu_psi)
+  {
+    face_currents[f*num_grps + g] += intS_mu_psi;
+  }
+  double GetFaceCurrent(int f, int g) const
+  {
+    return face_currents[f*num_grps + g];
+  }
+  std::vector<double>& FaceCurrents() {return face_currents;}
 };
 
 }
@@ -41,3 +41,111 @@ int chiLBSExecute(lua_State *L)
 
   return 0;
 }
+
+//###################################################################
+/**Re-reads the cross sections and sources of the solver's materials
+ * without re-initializing the solver. This allows a script to alter
+ * material properties in place, e.g. with chiPhysicsMaterialSetProperty,
+ * and execute again, starting from the previous flux moments. Combined
+ * with the RETAIN_SETUP option of chiLBSSetProperty the sweep orderings,
+ * FLUDS and sweep chunks are also reused and only the DSA solvers are
+ * rebuilt. Cells must keep their material ids.
+\param SolverIndex int Handle to the solver.
+
+\code
+chiLBSSetProperty(phys1, RETAIN_SETUP, true)
+chiLBSExecute(phys1)
+chiPhysicsMaterialSetProperty(materials[1], TRANSPORT_XSECTIONS,
+                              SIMPLEXS1, num_groups, 1.1, 0.5)
+chiLBSUpdateMaterials(phys1)
+chiLBSExecute(phys1)
+\endcode
+ \ingroup LuaNPT
+ */
+int chiLBSUpdateMaterials(lua_State *L)
+{
+  int num_args = lua_gettop(L);
+
+  if (num_args != 1)
+    LuaPostArgAmountError(__FUNCTION__, 1, num_args);
+
+  LuaCheckNilValue(__FUNCTION__, L, 1);
+
+  int solver_index = lua_tonumber(L,1);
+
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzmann::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<LinearBoltzmann::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR) << "chiLBSUpdateMaterials: Incorrect solver-type."
+                                   " Cannot cast to LinearBoltzmann::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR) << "chiLBSUpdateMaterials: Invalid handle to solver\n";
+    exit(EXIT_FAILURE);
+  }
+
+  solver->UpdateMaterials();
+
+  return 0;
+}
+
+//###################################################################
+/**Returns the number of transport sweeps of the last execution of the
+ * solver, summed over all groupsets. Sweeps on angular multigrid levels
+ * and coarse continuation quadratures are not included.
+\param SolverIndex int Handle to the solver.
+
+\return Number of sweeps.
+
+\code
+chiLBSExecute(phys1)
+num_sweeps = chiLBSGetNumberOfSweeps(phys1)
+\endcode
+ \ingroup LuaNPT
+ */
+int chiLBSGetNumberOfSweeps(lua_State *L)
+{
+  int num_args = lua_gettop(L);
+
+  if (num_args != 1)
+    LuaPostArgAmountError(__FUNCTION__, 1, num_args);
+
+  LuaCheckNilValue(__FUNCTION__, L, 1);
+
+  int solver_index = lua_tonumber(L,1);
+
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzmann::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<LinearBoltzmann::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR) << "chiLBSGetNumberOfSweeps: Incorrect solver-type."
+                                   " Cannot cast to LinearBoltzmann::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR) << "chiLBSGetNumberOfSweeps: Invalid handle to solver\n";
+    exit(EXIT_FAILURE);
+  }
+
+  lua_pushnumber(L, static_cast<lua_Number>(solver->num_sweeps));
+
+  return 1;
+}
@@ -374,6 +374,126 @@ int chiLBSGroupsetSetQuadrature(lua_State *L)
   return 0;
 }
 
+//###################################################################
+/**Sets a coarse quadrature with which the groupset is solved first, i.e.
+ * angular continuation. The converged flux moments of the coarse
+ * quadrature solve serve as the initial guess of the solve with the
+ * groupset's own quadrature. Since the flux moments only depend on the
+ * scattering order, both quadratures must support the same moments.
+
+\param SolverIndex int Handle to the solver for which the group
+is to be created.
+\param GroupsetIndex int Handle to the groupset to which the group is
+ to be added.
+\param QuadratureIndex int Handle to the coarse quadrature.
+\param Tolerance double Optional. Residual tolerance of the coarse
+                        quadrature solve. The groupset's own tolerance is
+                        used when it is looser. Default 1.0e-4.
+
+##_
+
+Example:
+\code
+pquad_S16 = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,8, 8)
+pquad_S4  = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 2)
+
+chiLBSGroupsetSetQuadrature(phys1,cur_gs,pquad_S16)
+chiLBSGroupsetSetContinuationQuadrature(phys1,cur_gs,pquad_S4,1.0e-3)
+\endcode
+
+\ingroup LuaLBSGroupsets
+*/
+int chiLBSGroupsetSetContinuationQuadrature(lua_State *L)
+{
+  //============================================= Get arguments
+  int num_args = lua_gettop(L);
+  if (num_args < 3)
+    LuaPostArgAmountError(__FUNCTION__,3,num_args);
+
+  LuaCheckNilValue(__FUNCTION__,L,1);
+  LuaCheckNilValue(__FUNCTION__,L,2);
+  LuaCheckNilValue(__FUNCTION__,L,3);
+
+  int solver_index = lua_tonumber(L,1);
+  int grpset_index = lua_tonumber(L,2);
+  int quad_index   = lua_tonumber(L,3);
+
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzmann::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<LinearBoltzmann::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR) << "chiLBSGroupsetSetContinuationQuadrature: "
+                                   "Incorrect solver-type."
+                                   " Cannot cast to LinearBoltzmann::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to solver "
+      << "in call to chiLBSGroupsetSetContinuationQuadrature";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Obtain pointer to groupset
+  LBSGroupset* groupset;
+  try{
+    groupset = &solver->group_sets.at(grpset_index);
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to groupset "
+      << "in call to chiLBSGroupsetSetContinuationQuadrature";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Obtain pointer to quadrature
+  std::shared_ptr<chi_math::AngularQuadrature> ang_quad;
+  try{
+    ang_quad = chi_math_handler.angular_quadratures.at(quad_index);
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to quadrature "
+      << "in call to chiLBSGroupsetSetContinuationQuadrature. "
+      << "Handle provided: " << quad_index;
+    exit(EXIT_FAILURE);
+  }
+
+  if (num_args >= 4)
+  {
+    double tolerance = lua_tonumber(L,4);
+    if (tolerance <= 0.0)
+    {
+      chi_log.Log(LOG_ALLERROR)
+        << "Invalid tolerance specified "
+        << "in call to chiLBSGroupsetSetContinuationQuadrature. "
+        << "Tolerance must be > 0.0.";
+      exit(EXIT_FAILURE);
+    }
+    groupset->continuation_tolerance = tolerance;
+  }
+
+  groupset->continuation_quadrature = ang_quad;
+
+  chi_log.Log(LOG_0)
+    << "Groupset " << grpset_index
+    << " continuation quadrature set to quadrature with "
+    << ang_quad->abscissae.size()
+    << " number of angles.";
+
+  return 0;
+}
+
 //###################################################################
 /**Sets the the type of angle aggregation to use for this groupset.
 \param SolverIndex int Handle to the solver for which the group
@@ -679,6 +799,13 @@ NPT_GMRES_CYCLES\n
 Generalized Minimal Residual formulation for iterations with cyclic dependency
 convergence.\n\n
 
+NPT_ANDERSON\n
+Source iteration with Anderson acceleration. The depth of the Anderson
+history can be set with chiLBSGroupsetSetAndersonDepth.\n\n
+
+NPT_ANDERSON_CYCLES\n
+Anderson accelerated source iteration with cyclic dependency convergence.\n\n
+
 Example:
 \code
 chiLBSGroupsetSetIterativeMethod(phys1,cur_gs,NPT_CLASSICRICHARDSON)
@@ -758,6 +885,15 @@ int chiLBSGroupsetSetIterativeMethod(lua_State *L)
       groupset->allow_cycles = true;
       groupset->iterative_method = IterativeMethod::GMRES;
     }
+    else if (iter_method == static_cast<int>(IterativeMethod::ANDERSON))
+    {
+      groupset->iterative_method = IterativeMethod::ANDERSON;
+    }
+    else if (iter_method == static_cast<int>(IterativeMethod::ANDERSON_CYCLES))
+    {
+      groupset->allow_cycles = true;
+      groupset->iterative_method = IterativeMethod::ANDERSON;
+    }
     else
     {
       chi_log.Log(LOG_ALLERROR)
@@ -1033,6 +1169,94 @@ int chiLBSGroupsetSetGMRESRestartIntvl(lua_State *L)
   return 0;
 }
 
+//###################################################################
+/**Sets the depth of the Anderson history if Anderson acceleration is
+ * applied to the groupset. Each level of depth stores two copies of the
+ * groupset's flux moments.
+\param SolverIndex int Handle to the solver for which the group
+is to be created.
+
+\param GroupsetIndex int Index to the groupset to which this function should
+                         apply
+\param Depth int Number of previous iterates to mix. Default 5.
+
+##_
+
+Example:
+\code
+chiLBSGroupsetSetIterativeMethod(phys1,cur_gs,NPT_ANDERSON)
+chiLBSGroupsetSetAndersonDepth(phys1,cur_gs,3)
+\endcode
+
+\ingroup LuaLBSGroupsets
+*/
+int chiLBSGroupsetSetAndersonDepth(lua_State *L)
+{
+  //============================================= Get arguments
+  int num_args = lua_gettop(L);
+  if (num_args != 3)
+    LuaPostArgAmountError(__FUNCTION__,3,num_args);
+
+  LuaCheckNilValue(__FUNCTION__,L,1);
+  LuaCheckNilValue(__FUNCTION__,L,2);
+  LuaCheckNilValue(__FUNCTION__,L,3);
+  int solver_index = lua_tonumber(L,1);
+  int grpset_index = lua_tonumber(L,2);
+  int depth        = lua_tonumber(L,3);
+
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzmann::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<LinearBoltzmann::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR) << "chiLBSGroupsetSetAndersonDepth: Incorrect solver-type."
+                                   " Cannot cast to LinearBoltzmann::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to solver "
+      << "in call to chiLBSGroupsetSetAndersonDepth";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Obtain pointer to groupset
+  LBSGroupset* groupset;
+  try{
+    groupset = &solver->group_sets.at(grpset_index);
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to groupset "
+      << "in call to chiLBSGroupsetSetAndersonDepth";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Bounds checking
+  if (depth < 1)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid Anderson depth specified "
+      << "in call to chiLBSGroupsetSetAndersonDepth. Must be >= 1.";
+    exit(EXIT_FAILURE);
+  }
+
+  groupset->anderson_depth = depth;
+
+  chi_log.Log(LOG_0)
+    << "Groupset " << grpset_index << " Anderson depth set to " << depth;
+
+  return 0;
+}
+
 
 //###################################################################
 /**Enables or disables the printing of a sweep log.
@@ -1324,3 +1548,334 @@ int chiLBSGroupsetSetTGDSA(lua_State *L)
 
   return 0;
 }
+
+//###################################################################
+/**Sets how the diffusion synthetic acceleration (WGDSA and/or TGDSA) of
+ * a GMRES groupset is applied. By default the DSA correction is applied
+ * inside the Krylov operator (left preconditioning). When right
+ * preconditioning is enabled the Krylov operator only contains the
+ * transport sweep and the DSA correction is applied as a PETSc shell
+ * preconditioner. With the flexible option FGMRES is used, which
+ * tolerates a preconditioner that changes between iterations. This
+ * allows the WGDSA/TGDSA tolerances to be loosened considerably.
+ *
+\param SolverIndex int Handle to the solver for which the group
+is to be created.
+
+\param GroupsetIndex int Index to the groupset to which this function should
+                         apply
+\param RightPreconditioning bool Flag to apply DSA as a right
+                                 preconditioner. Default false.
+\param Flexible bool Optional. Flag to use FGMRES. Default false.
+
+##_
+
+Example:
+\code
+chiLBSGroupsetSetIterativeMethod(phys1,cur_gs,NPT_GMRES)
+chiLBSGroupsetSetWGDSA(phys1,cur_gs,30,1.0e-2,false," ")
+chiLBSGroupsetSetDSAPreconditioning(phys1,cur_gs,true,true)
+\endcode
+
+\ingroup LuaLBSGroupsets
+*/
+int chiLBSGroupsetSetDSAPreconditioning(lua_State *L)
+{
+  //============================================= Get arguments
+  int num_args = lua_gettop(L);
+  if (num_args < 3)
+    LuaPostArgAmountError(__FUNCTION__,3,num_args);
+
+  LuaCheckNilValue(__FUNCTION__,L,1);
+  LuaCheckNilValue(__FUNCTION__,L,2);
+  LuaCheckNilValue(__FUNCTION__,L,3);
+  int  solver_index = lua_tonumber(L,1);
+  int  grpset_index = lua_tonumber(L,2);
+  bool right_precon = lua_toboolean(L,3);
+  bool flexible     = false;
+
+  if (num_args >= 4)
+    flexible = lua_toboolean(L,4);
+
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzmann::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<LinearBoltzmann::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR) << "chiLBSGroupsetSetDSAPreconditioning: Incorrect solver-type."
+                                   " Cannot cast to LinearBoltzmann::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to solver "
+      << "in call to chiLBSGroupsetSetDSAPreconditioning";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Obtain pointer to groupset
+  LBSGroupset* groupset;
+  try{
+    groupset = &solver->group_sets.at(grpset_index);
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to groupset "
+      << "in call to chiLBSGroupsetSetDSAPreconditioning";
+    exit(EXIT_FAILURE);
+  }
+
+  if (flexible and not right_precon)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "FGMRES requires right preconditioning "
+      << "in call to chiLBSGroupsetSetDSAPreconditioning";
+    exit(EXIT_FAILURE);
+  }
+
+  groupset->dsa_right_preconditioning = right_precon;
+  groupset->dsa_flexible_gmres        = flexible;
+
+  chi_log.Log(LOG_0)
+    << "Groupset " << grpset_index << " DSA right preconditioning "
+    << "set to " << right_precon << " (flexible " << flexible << ")";
+
+  return 0;
+}
+
+//###################################################################
+/**Sets whether the WGDSA and TGDSA diffusion solvers of a groupset use a
+ * matrix-free MIP operator. Instead of assembling the diffusion matrix,
+ * the operator is applied cell by cell from the unit integrals and only
+ * the material coefficients are stored. It is preconditioned with the
+ * inverses of its diagonal cell blocks (cell block-Jacobi), which makes
+ * the diffusion solves take more iterations than with the default
+ * BoomerAMG preconditioner of the assembled matrix, but with a small
+ * fraction of its memory. The PETSc options strings of the DSA solvers
+ * are ignored.
+ *
+ * Only homogeneous Dirichlet (vacuum) and reflecting boundaries are
+ * supported, which are the only ones used by the DSA solvers.
+ *
+\param SolverIndex int Handle to the solver for which the group
+is to be created.
+
+\param GroupsetIndex int Index to the groupset to which this function should
+                         apply
+\param MatrixFree bool Flag to use the matrix-free operator. Default false.
+
+##_
+
+Example:
+\code
+chiLBSGroupsetSetWGDSA(phys1,cur_gs,100,1.0e-4,false," ")
+chiLBSGroupsetSetDSAMatrixFree(phys1,cur_gs,true)
+\endcode
+
+\ingroup LuaLBSGroupsets
+*/
+int chiLBSGroupsetSetDSAMatrixFree(lua_State *L)
+{
+  //============================================= Get arguments
+  int num_args = lua_gettop(L);
+  if (num_args != 3)
+    LuaPostArgAmountError(__FUNCTION__,3,num_args);
+
+  LuaCheckNilValue(__FUNCTION__,L,1);
+  LuaCheckNilValue(__FUNCTION__,L,2);
+  LuaCheckNilValue(__FUNCTION__,L,3);
+  int  solver_index = lua_tonumber(L,1);
+  int  grpset_index = lua_tonumber(L,2);
+  bool matrix_free  = lua_toboolean(L,3);
+
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzmann::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<LinearBoltzmann::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR) << "chiLBSGroupsetSetDSAMatrixFree: Incorrect solver-type."
+                                   " Cannot cast to LinearBoltzmann::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to solver "
+      << "in call to chiLBSGroupsetSetDSAMatrixFree";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Obtain pointer to groupset
+  LBSGroupset* groupset;
+  try{
+    groupset = &solver->group_sets.at(grpset_index);
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to groupset "
+      << "in call to chiLBSGroupsetSetDSAMatrixFree";
+    exit(EXIT_FAILURE);
+  }
+
+  groupset->dsa_matrix_free = matrix_free;
+
+  chi_log.Log(LOG_0)
+    << "Groupset " << grpset_index << " DSA matrix-free operator "
+    << "set to " << matrix_free;
+
+  return 0;
+}
+
+//###################################################################
+/**Adds a coarse angular level to the angular multigrid preconditioner of
+ * a groupset. Levels must be added from fine to coarse.
+ *
+ * After each transport sweep the error equation is solved approximately
+ * with a few source iterations on each coarse level, in the order in
+ * which the levels were added. On a level only the flux moments up to
+ * the level's scattering order are corrected, typically the order that
+ * the level's quadrature integrates accurately. The preconditioner is
+ * applied after each sweep of Classic-Richardson and Anderson, and as a
+ * right preconditioner of GMRES, in which case DSA (if any) is also
+ * applied as part of the right preconditioner.
+ *
+ * Reflecting boundaries are treated as vacuum on the coarse levels.
+
+\param SolverIndex int Handle to the solver for which the group
+is to be created.
+
+\param GroupsetIndex int Index to the groupset to which this function should
+                         apply
+\param QuadratureIndex int Handle to the coarse quadrature, e.g. a lower
+                           order product quadrature or an SLDFESQ
+                           quadrature initialized with InitializeWithGLC at
+                           a lower order.
+\param ScatteringOrder int The highest moment order corrected on this
+                           level.
+\param NumSweeps int Optional. Number of source iterations on this level.
+                     Default 2.
+
+##_
+
+Example:
+\code
+pquad_S32 = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,16,16)
+pquad_S16 = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,8,8)
+pquad_S8  = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,4,4)
+
+chiLBSGroupsetSetQuadrature(phys1,cur_gs,pquad_S32)
+chiLBSGroupsetAddAngularMultigridLevel(phys1,cur_gs,pquad_S16,7)
+chiLBSGroupsetAddAngularMultigridLevel(phys1,cur_gs,pquad_S8,3)
+\endcode
+
+\ingroup LuaLBSGroupsets
+*/
+int chiLBSGroupsetAddAngularMultigridLevel(lua_State *L)
+{
+  //============================================= Get arguments
+  int num_args = lua_gettop(L);
+  if (num_args < 4)
+    LuaPostArgAmountError(__FUNCTION__,4,num_args);
+
+  LuaCheckNilValue(__FUNCTION__,L,1);
+  LuaCheckNilValue(__FUNCTION__,L,2);
+  LuaCheckNilValue(__FUNCTION__,L,3);
+  LuaCheckNilValue(__FUNCTION__,L,4);
+  int solver_index     = lua_tonumber(L,1);
+  int grpset_index     = lua_tonumber(L,2);
+  int quad_index       = lua_tonumber(L,3);
+  int scattering_order = lua_tonumber(L,4);
+  int num_sweeps       = 2;
+
+  if (num_args >= 5)
+    num_sweeps = lua_tonumber(L,5);
+
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzmann::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<LinearBoltzmann::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR) << "chiLBSGroupsetAddAngularMultigridLevel: "
+                                   "Incorrect solver-type."
+                                   " Cannot cast to LinearBoltzmann::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to solver "
+      << "in call to chiLBSGroupsetAddAngularMultigridLevel";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Obtain pointer to groupset
+  LBSGroupset* groupset;
+  try{
+    groupset = &solver->group_sets.at(grpset_index);
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to groupset "
+      << "in call to chiLBSGroupsetAddAngularMultigridLevel";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Obtain pointer to quadrature
+  std::shared_ptr<chi_math::AngularQuadrature> ang_quad;
+  try{
+    ang_quad = chi_math_handler.angular_quadratures.at(quad_index);
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to quadrature "
+      << "in call to chiLBSGroupsetAddAngularMultigridLevel. "
+      << "Handle provided: " << quad_index;
+    exit(EXIT_FAILURE);
+  }
+
+  if (scattering_order < 0 or num_sweeps < 1)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "The scattering order must be >= 0 and the number of sweeps >= 1 "
+      << "in call to chiLBSGroupsetAddAngularMultigridLevel";
+    exit(EXIT_FAILURE);
+  }
+
+  LinearBoltzmann::AngularMultigridLevel level;
+  level.quadrature       = ang_quad;
+  level.scattering_order = static_cast<unsigned int>(scattering_order);
+  level.num_sweeps       = num_sweeps;
+
+  groupset->angular_multigrid_levels.push_back(level);
+
+  chi_log.Log(LOG_0)
+    << "Groupset " << grpset_index << " angular multigrid level "
+    << groupset->angular_multigrid_levels.size() << " added with "
+    << ang_quad->abscissae.size() << " angles and scattering order "
+    << scattering_order << ".";
+
+  return 0;
+}
@@ -0,0 +1,141 @@
+#include "ChiLua/chi_lua.h"
+
+#include "../lbs_linear_boltzmann_solver.h"
+
+#include "ChiPhysics/chi_physics.h"
+extern ChiPhysics&  chi_physics_handler;
+
+#include <chi_log.h>
+extern ChiLog& chi_log;
+
+//###################################################################
+/**Analyzes the transfer matrices of the materials of the solver's region
+and partitions the groups into contiguous blocks coupled by upscattering.
+Optionally replaces the solver's groupsets with one groupset per block.
+Must be called before chiLBSInitialize.
+
+\param SolverIndex int Handle to the solver.
+\param CreateGroupsets bool Optional. If true, the existing groupsets are
+       replaced with one groupset per block. Default false.
+\param TemplateGroupsetIndex int Optional. Handle to the groupset from which
+       all settings (quadrature, iterative method, tolerances, DSA, etc.)
+       are copied when groupsets are created. Default 0.
+
+\return table,count Returns an array of blocks (indexed from 1), each block
+        being a table with fields `first_group`, `last_group`,
+        `has_upscatter` and `has_inblock_scatter`, and the number of blocks.
+
+##_
+
+Groups in an upscatter range are grouped into a single groupset. Groups
+that only receive downscatter each become their own groupset so that they
+are solved once in ascending order (Gauss-Seidel). Groupsets that have
+no scattering within them are limited to a single iteration unless
+reflecting boundaries are present.
+
+Example:
+\code
+gs0 = chiLBSCreateGroupset(phys1)
+chiLBSGroupsetSetQuadrature(phys1,gs0,pquad)
+chiLBSGroupsetSetIterativeMethod(phys1,gs0,NPT_GMRES)
+
+blocks,num_blocks = chiLBSComputeGroupsetPartitioning(phys1,true,gs0)
+\endcode
+
+\ingroup LuaLBSGroupsets
+*/
+int chiLBSComputeGroupsetPartitioning(lua_State *L)
+{
+  int num_args = lua_gettop(L);
+  if (num_args < 1)
+    LuaPostArgAmountError(__FUNCTION__,1,num_args);
+
+  LuaCheckNilValue(__FUNCTION__,L,1);
+  int solver_index = lua_tonumber(L,1);
+
+  bool create_groupsets = false;
+  if (num_args >= 2)
+    create_groupsets = lua_toboolean(L,2);
+
+  int template_gs_index = 0;
+  if (num_args >= 3)
+  {
+    LuaCheckNilValue(__FUNCTION__,L,3);
+    template_gs_index = lua_tonumber(L,3);
+  }
+
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzmann::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<LinearBoltzmann::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR)
+        << "chiLBSComputeGroupsetPartitioning: Incorrect solver-type."
+           " Cannot cast to LinearBoltzmann::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "chiLBSComputeGroupsetPartitioning: Invalid handle to solver\n";
+    exit(EXIT_FAILURE);
+  }
+
+  if (template_gs_index < 0)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "chiLBSComputeGroupsetPartitioning: Invalid handle to groupset\n";
+    exit(EXIT_FAILURE);
+  }
+
+  if (solver->discretization != nullptr)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "chiLBSComputeGroupsetPartitioning: The solver is already "
+         "initialized. Groupsets must be partitioned before "
+         "chiLBSInitialize.\n";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Compute the blocks
+  auto blocks = solver->ComputeGroupCouplingBlocks();
+
+  if (create_groupsets)
+    solver->CreateGroupsetsFromCouplingBlocks(blocks, template_gs_index);
+
+  //============================================= Push up new table
+  lua_newtable(L);
+  for (size_t b=0; b<blocks.size(); ++b)
+  {
+    lua_pushnumber(L,b+1);
+    lua_newtable(L);
+
+    lua_pushstring(L,"first_group");
+    lua_pushinteger(L,blocks[b].first_group);
+    lua_settable(L,-3);
+
+    lua_pushstring(L,"last_group");
+    lua_pushinteger(L,blocks[b].last_group);
+    lua_settable(L,-3);
+
+    lua_pushstring(L,"has_upscatter");
+    lua_pushboolean(L,blocks[b].has_upscatter);
+    lua_settable(L,-3);
+
+    lua_pushstring(L,"has_inblock_scatter");
+    lua_pushboolean(L,blocks[b].has_inblock_scatter);
+    lua_settable(L,-3);
+
+    lua_settable(L,-3);
+  }
+
+  lua_pushnumber(L,blocks.size());
+
+  return 2;
+}
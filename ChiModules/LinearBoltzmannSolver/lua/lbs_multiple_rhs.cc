@@ -0,0 +1,166 @@
+#include "ChiLua/chi_lua.h"
+
+#include "../lbs_linear_boltzmann_solver.h"
+
+#include "ChiPhysics/chi_physics.h"
+extern ChiPhysics&  chi_physics_handler;
+
+#include "chi_log.h"
+extern ChiLog& chi_log;
+
+namespace
+{
+//###################################################################
+/**Obtains a LinearBoltzmann::Solver from the solver stack.*/
+LinearBoltzmann::Solver* GetLBSSolver(int solver_index,
+                                      const std::string& fname)
+{
+  chi_physics::Solver* psolver;
+  LinearBoltzmann::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<LinearBoltzmann::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR) << fname << ": Incorrect solver-type."
+                                   " Cannot cast to LinearBoltzmann::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      <<"Invalid handle to solver in " << fname << "\n";
+    exit(EXIT_FAILURE);
+  }
+
+  return solver;
+}
+}
+
+//###################################################################
+/**Adds a right-hand side to a batched multiple right-hand side solve.
+ * Once a solver has one or more right-hand sides, chiLBSExecute sweeps
+ * all of them at once with batched source iterations, instead of solving
+ * the problem defined by the materials' isotropic multigroup sources.
+ * The right-hand sides share the mesh, cross sections, quadrature and
+ * boundary conditions and differ only in their volumetric sources.
+ * Convergence is checked per right-hand side.
+ *
+\param SolverIndex int Handle to the solver.
+\param SourceTable table A table, indexed by material id, of tables with
+                         the isotropic multigroup source strength of each
+                         group. Materials not in the table have no source.
+
+\return Index of the right-hand side.
+
+\code
+rhs0 = chiLBSAddRightHandSide(phys1, {[0] = src_a})
+rhs1 = chiLBSAddRightHandSide(phys1, {[0] = src_b, [1] = src_a})
+chiLBSExecute(phys1)
+chiLBSSetActiveRightHandSide(phys1, rhs1)
+\endcode
+
+\ingroup LuaNPT*/
+int chiLBSAddRightHandSide(lua_State *L)
+{
+  int num_args = lua_gettop(L);
+
+  if (num_args != 2)
+    LuaPostArgAmountError(__FUNCTION__, 2, num_args);
+
+  LuaCheckNilValue(__FUNCTION__, L, 1);
+  LuaCheckTableValue(__FUNCTION__, L, 2);
+
+  int solver_index = lua_tonumber(L,1);
+  auto solver = GetLBSSolver(solver_index, __FUNCTION__);
+
+  LinearBoltzmann::RHSSource rhs_source;
+
+  //============================================= Material sources
+  lua_pushnil(L);
+  while (lua_next(L,2) != 0)
+  {
+    int mat_id = lua_tonumber(L,-2);
+    if (mat_id < 0 or not lua_istable(L,-1))
+    {
+      chi_log.Log(LOG_ALLERROR)
+        << __FUNCTION__ << ": The source table must be indexed by "
+        << "non-negative material ids and contain tables of group values.";
+      exit(EXIT_FAILURE);
+    }
+
+    auto mg_source = std::make_shared<chi_physics::IsotropicMultiGrpSource>();
+
+    size_t table_len = lua_rawlen(L,-1);
+    mg_source->source_value_g.assign(table_len, 0.0);
+    for (size_t g=0; g<table_len; ++g)
+    {
+      lua_pushnumber(L,g+1);
+      lua_gettable(L,-2);
+      mg_source->source_value_g[g] = lua_tonumber(L,-1);
+      lua_pop(L,1);
+    }
+
+    if (table_len != solver->groups.size())
+    {
+      chi_log.Log(LOG_ALLERROR)
+        << __FUNCTION__ << ": Number of groups in the source of material "
+        << mat_id << " is " << table_len << " but the solver has a total of "
+        << solver->groups.size() << " groups. These two must be equal.";
+      exit(EXIT_FAILURE);
+    }
+
+    if (rhs_source.matid_to_src_map.size() <= static_cast<size_t>(mat_id))
+      rhs_source.matid_to_src_map.resize(mat_id + 1, -1);
+
+    rhs_source.material_srcs.push_back(mg_source);
+    rhs_source.matid_to_src_map[mat_id] =
+      static_cast<int>(rhs_source.material_srcs.size()) - 1;
+
+    lua_pop(L,1);
+  }
+
+  solver->rhs_sources.push_back(rhs_source);
+
+  lua_pushnumber(L, static_cast<lua_Number>(solver->rhs_sources.size()) - 1);
+  return 1;
+}
+
+//###################################################################
+/**Copies the solution of a right-hand side of a multiple right-hand side
+ * solve to the solver's flux moments, so that the solver's field
+ * functions show this right-hand side. After chiLBSExecute the first
+ * right-hand side is active.
+ *
+\param SolverIndex int Handle to the solver.
+\param RHSIndex int Index of the right-hand side.
+
+\ingroup LuaNPT*/
+int chiLBSSetActiveRightHandSide(lua_State *L)
+{
+  int num_args = lua_gettop(L);
+
+  if (num_args != 2)
+    LuaPostArgAmountError(__FUNCTION__, 2, num_args);
+
+  LuaCheckNilValue(__FUNCTION__, L, 1);
+  LuaCheckNilValue(__FUNCTION__, L, 2);
+
+  int solver_index = lua_tonumber(L,1);
+  int rhs_index    = lua_tonumber(L,2);
+  auto solver = GetLBSSolver(solver_index, __FUNCTION__);
+
+  if (rhs_index < 0)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << __FUNCTION__ << ": Invalid right-hand side index " << rhs_index;
+    exit(EXIT_FAILURE);
+  }
+
+  solver->CopyRHSSolution(static_cast<size_t>(rhs_index));
+
+  return 0;
+}
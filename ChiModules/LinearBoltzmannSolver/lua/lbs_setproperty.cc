@@ -33,6 +33,11 @@ extern ChiMath&     chi_math_handler;
 
 #define VERBOSE_INNER_ITERATIONS 10
 #define VERBOSE_OUTER_ITERATIONS 11
+#define USE_MATERIAL_SCATTERING_ORDER 12
+#define PIPELINE_DOWNSCATTER_GROUPSETS 13
+#define ANGLE_DOMAIN_DECOMPOSITION 14
+#define RETAIN_SETUP 15
+#define SHARE_DSA_SOLVERS 16
 
 #include "chi_log.h"
 extern ChiLog& chi_log;
@@ -86,6 +91,44 @@ WRITE_RESTART_DATA\n
 chiLBSSetProperty(phys1,WRITE_RESTART_DATA,"YRestart1","restart",1)
 \endcode
 
+USE_MATERIAL_SCATTERING_ORDER\n
+ Flag indicating whether each cell should only source and accumulate the
+ flux moments up to the scattering order of its material. Moments above a
+ material's scattering order are left at zero in those cells. Expects to be
+ followed by a boolean. Default false.\n\n
+\code
+chiLBSSetProperty(phys1,USE_MATERIAL_SCATTERING_ORDER,true)
+\endcode
+PIPELINE_DOWNSCATTER_GROUPSETS\n
+ Flag indicating whether chains of consecutive downscatter-only groupsets
+ should be swept in a single pipelined pass per iteration. Only groupsets
+ using NPT_CLASSICRICHARDSON, without DSA and without reflecting boundaries
+ or fissile materials, are chained. Expects to be followed by a boolean.
+ Default false.\n\n
+ANGLE_DOMAIN_DECOMPOSITION\n
+ Flag indicating how the work is divided when ChiTech is run with
+ replicated spatial domains (command line option `-num_replicas`). When
+ true each replica sweeps a subset of the angle set groups (quadrants or
+ octants) instead of a subset of each groupset's group subsets. Not
+ supported with reflecting boundaries or curvilinear geometries. Expects to
+ be followed by a boolean. Default false.\n\n
+RETAIN_SETUP\n
+ Flag indicating whether the sweep orderings, FLUDS, sweep chunks, DSA
+ solvers and GMRES Krylov objects of the groupsets should be kept after
+ chiLBSExecute, so that subsequent executes, e.g. after
+ chiLBSUpdateMaterials, reuse them. Setting the flag to false releases
+ retained structures. Expects to be followed by a boolean. Default false.\n\n
+SHARE_DSA_SOLVERS\n
+ Flag indicating whether groupsets with identical DSA diffusion operators
+ should share a single WGDSA or TGDSA diffusion solver, and with it the
+ matrix and preconditioner setup. TGDSA operators are collapsed over all
+ groups and are identical for all groupsets with the same TGDSA settings.
+ WGDSA operators are identical when the groupsets have the same number of
+ groups with equal diffusion coefficients and removal cross sections.
+ Shared solvers are kept until the end of chiLBSExecute or, with
+ RETAIN_SETUP, until the setup is released. Setting the flag to false
+ destroys the shared solvers, retained groupsets that used them get their
+ own. Expects to be followed by a boolean. Default false.\n\n
 ###Discretization methods
  PWLD2D = Piecewise Linear Finite Element 2D.\n
  PWLD3D = Piecewise Linear Finite Element 3D.
@@ -406,6 +449,64 @@ int chiLBSSetProperty(lua_State *L)
 
     chi_log.Log() << "LBS option: verbose_outer_iterations set to " << flag;
   }
+  else if (property == USE_MATERIAL_SCATTERING_ORDER)
+  {
+    LuaCheckNilValue(__FUNCTION__, L, 3);
+
+    bool flag = lua_toboolean(L, 3);
+
+    solver->options.use_material_scattering_order = flag;
+
+    chi_log.Log() << "LBS option: use_material_scattering_order set to "
+                  << flag;
+  }
+  else if (property == PIPELINE_DOWNSCATTER_GROUPSETS)
+  {
+    LuaCheckNilValue(__FUNCTION__, L, 3);
+
+    bool flag = lua_toboolean(L, 3);
+
+    solver->options.pipeline_downscatter_groupsets = flag;
+
+    chi_log.Log() << "LBS option: pipeline_downscatter_groupsets set to "
+                  << flag;
+  }
+  else if (property == ANGLE_DOMAIN_DECOMPOSITION)
+  {
+    LuaCheckNilValue(__FUNCTION__, L, 3);
+
+    bool flag = lua_toboolean(L, 3);
+
+    solver->options.angle_domain_decomposition = flag;
+
+    chi_log.Log() << "LBS option: angle_domain_decomposition set to "
+                  << flag;
+  }
+  else if (property == RETAIN_SETUP)
+  {
+    LuaCheckNilValue(__FUNCTION__, L, 3);
+
+    bool flag = lua_toboolean(L, 3);
+
+    solver->options.retain_setup = flag;
+    if (not flag)
+      solver->ReleaseSetup();
+
+    chi_log.Log() << "LBS option: retain_setup set to " << flag;
+  }
+  else if (property == SHARE_DSA_SOLVERS)
+  {
+    LuaCheckNilValue(__FUNCTION__, L, 3);
+
+    bool flag = lua_toboolean(L, 3);
+
+    if (flag)
+      solver->options.share_dsa_solvers = true;
+    else
+      solver->StopSharingDSASolvers();
+
+    chi_log.Log() << "LBS option: share_dsa_solvers set to " << flag;
+  }
   else
   {
     std::cerr << "Invalid property in chiLBSSetProperty.\n";
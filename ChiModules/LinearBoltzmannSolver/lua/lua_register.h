@@ -24,6 +24,11 @@ RegisterConstant(WRITE_RESTART_DATA,  7);
 RegisterConstant(SAVE_ANGULAR_FLUX,8)
 RegisterConstant(VERBOSE_INNER_ITERATIONS, 10);
 RegisterConstant(VERBOSE_OUTER_ITERATIONS, 11);
+RegisterConstant(USE_MATERIAL_SCATTERING_ORDER, 12);
+RegisterConstant(PIPELINE_DOWNSCATTER_GROUPSETS, 13);
+RegisterConstant(ANGLE_DOMAIN_DECOMPOSITION, 14);
+RegisterConstant(RETAIN_SETUP, 15);
+RegisterConstant(SHARE_DSA_SOLVERS, 16);
 
 
 RegisterNamespace(LBSProperty);
@@ -34,6 +39,11 @@ AddNamedConstantToNamespace(SWEEP_EAGER_LIMIT,     5, LBSProperty);
 AddNamedConstantToNamespace(READ_RESTART_DATA,     6, LBSProperty);
 AddNamedConstantToNamespace(WRITE_RESTART_DATA,    7, LBSProperty);
 AddNamedConstantToNamespace(SAVE_ANGULAR_FLUX,     8, LBSProperty);
+AddNamedConstantToNamespace(USE_MATERIAL_SCATTERING_ORDER, 12, LBSProperty);
+AddNamedConstantToNamespace(PIPELINE_DOWNSCATTER_GROUPSETS, 13, LBSProperty);
+AddNamedConstantToNamespace(ANGLE_DOMAIN_DECOMPOSITION, 14, LBSProperty);
+AddNamedConstantToNamespace(RETAIN_SETUP, 15, LBSProperty);
+AddNamedConstantToNamespace(SHARE_DSA_SOLVERS, 16, LBSProperty);
 
 RegisterNamespace(LBSSpatialDiscretizations)
 AddNamedConstantToNamespace(PWLD, 3, LBSSpatialDiscretizations)
@@ -59,6 +69,8 @@ RegisterConstant(NPT_CLASSICRICHARDSON,          1);
 RegisterConstant(NPT_CLASSICRICHARDSON_CYCLES,   2);
 RegisterConstant(NPT_GMRES,                      3);
 RegisterConstant(NPT_GMRES_CYCLES,               4);
+RegisterConstant(NPT_ANDERSON,                   5);
+RegisterConstant(NPT_ANDERSON_CYCLES,            6);
 RegisterConstant(GROUPSET_TOLERANCE,   102);
 RegisterConstant(GROUPSET_MAXITERATIONS,   103);
 RegisterConstant(GROUPSET_GMRESRESTART_INTVL,   104);
@@ -72,11 +84,15 @@ RegisterConstant(GROUPSET_TGDSA_TOLERANCE,111);
 
 RegisterFunction(chiLBSInitialize)
 RegisterFunction(chiLBSExecute)
+RegisterFunction(chiLBSUpdateMaterials)
+RegisterFunction(chiLBSGetNumberOfSweeps)
 RegisterFunction(chiLBSGetFieldFunctionList)
 RegisterFunction(chiLBSGetScalarFieldFunctionList)
 RegisterFunction(chiLBSWriteGroupsetAngularFlux)
 RegisterFunction(chiLBSReadGroupsetAngularFlux)
 RegisterFunction(chiLBSComputeBalance)
+RegisterFunction(chiLBSAddRightHandSide)
+RegisterFunction(chiLBSSetActiveRightHandSide)
 
 //module:Linear Boltzmann Solver - Groupset manipulation
 //\ref LuaLBSGroupsets Main page
@@ -85,6 +101,7 @@ RegisterFunction(chiLBSCreateGroup)
 RegisterFunction(chiLBSCreateGroupset)
 RegisterFunction(chiLBSGroupsetAddGroups)
 RegisterFunction(chiLBSGroupsetSetQuadrature)
+RegisterFunction(chiLBSGroupsetSetContinuationQuadrature)
 RegisterFunction(chiLBSGroupsetSetAngleAggregationType)
 AddNamedConstantToNamespace(ANGLE_AGG_SINGLE,   1,LBSGroupset)
 AddNamedConstantToNamespace(ANGLE_AGG_POLAR,    2,LBSGroupset)
@@ -95,6 +112,11 @@ RegisterFunction(chiLBSGroupsetSetIterativeMethod)
 RegisterFunction(chiLBSGroupsetSetResidualTolerance)
 RegisterFunction(chiLBSGroupsetSetMaxIterations)
 RegisterFunction(chiLBSGroupsetSetGMRESRestartIntvl)
+RegisterFunction(chiLBSGroupsetSetAndersonDepth)
 RegisterFunction(chiLBSGroupsetSetEnableSweepLog)
 RegisterFunction(chiLBSGroupsetSetWGDSA)
-RegisterFunction(chiLBSGroupsetSetTGDSA)
\ No newline at end of file
+RegisterFunction(chiLBSGroupsetSetTGDSA)
+RegisterFunction(chiLBSGroupsetSetDSAPreconditioning)
+RegisterFunction(chiLBSGroupsetSetDSAMatrixFree)
+RegisterFunction(chiLBSGroupsetAddAngularMultigridLevel)
+RegisterFunction(chiLBSComputeGroupsetPartitioning)
\ No newline at end of file
@@ -31,7 +31,7 @@ LogStream ChiLog::Log(LOG_LVL level/*=LOG_0*/)
   {
     case LOG_0:
     {
-      if (chi_mpi.location_id == 0)
+      if ((chi_mpi.location_id == 0) && (chi_mpi.replica_id == 0))
       {
         std::string header = "[" + std::to_string(chi_mpi.location_id) + "]  ";
         return LogStream(&std::cout, header);
@@ -44,7 +44,7 @@ LogStream ChiLog::Log(LOG_LVL level/*=LOG_0*/)
     }
     case LOG_0WARNING:
     {
-      if (chi_mpi.location_id == 0)
+      if ((chi_mpi.location_id == 0) && (chi_mpi.replica_id == 0))
       {
         std::string header = "[" + std::to_string(chi_mpi.location_id) + "]  ";
         header += "**WARNING** ";
@@ -58,7 +58,7 @@ LogStream ChiLog::Log(LOG_LVL level/*=LOG_0*/)
     }
     case LOG_0ERROR:
     {
-      if (chi_mpi.location_id == 0)
+      if ((chi_mpi.location_id == 0) && (chi_mpi.replica_id == 0))
       {
         std::string header = "[" + std::to_string(chi_mpi.location_id) + "]  ";
         header += "**!**ERROR**!** ";
@@ -74,7 +74,8 @@ LogStream ChiLog::Log(LOG_LVL level/*=LOG_0*/)
     case LOG_0VERBOSE_1:
     case LOG_0VERBOSE_2:
     {
-      if ((chi_mpi.location_id == 0) && (verbosity >= level))
+      if ((chi_mpi.location_id == 0) && (chi_mpi.replica_id == 0) &&
+          (verbosity >= level))
       {
         std::string header = "[" + std::to_string(chi_mpi.location_id) + "]  ";
         return LogStream(&std::cout, header);
@@ -185,6 +185,9 @@ RegisterFunction(chiEdgeLoopSplitByAngle)
 //module:MPI Utilities
 RegisterFunction(chiMPIBarrier)
 
+//module:Timer Utilities
+RegisterFunction(chiProgramTime)
+
 //module:Logging Utilities
 RegisterFunction(chiLogSetVerbosity)
 RegisterFunction(chiLog)
@@ -243,6 +246,9 @@ RegisterConstant(CHI_XSFILE,             24);
 #endif
 //module:Test scripts
 RegisterFunction(chiLuaTest)
+RegisterFunction(chiPWLTestUnitIntegrals)
+RegisterFunction(chiPWLDTestUnitIntegralRecords)
+RegisterFunction(chiPWLTestFlatUnitIntegrals)
 
 
 RegisterNamespace(LuaNamespace)
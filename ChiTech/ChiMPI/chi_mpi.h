@@ -29,8 +29,14 @@ public:
 class ChiMPI
 {
 public:
-  int location_id;
-  int process_count;
+  int location_id;        ///< Rank in the spatial communicator
+  int process_count;      ///< Size of the spatial communicator
+  MPI_Comm comm;          ///< Spatial communicator
+
+  int num_replicas;       ///< Number of replicated spatial domains
+  int replica_id;         ///< Replica this location belongs to
+  MPI_Comm replica_comm;  ///< Locations owning the same spatial subdomain
+
   MPI_Datatype NODE_INFO_C;
   MPI_Datatype TRIFACE_INFO_C;
   MPI_Datatype CELL_INFO_C;
@@ -44,12 +50,18 @@ private:
   {
     location_id = 0;
     process_count = 1;
+    comm = MPI_COMM_WORLD;
+
+    num_replicas = 1;
+    replica_id = 0;
+    replica_comm = MPI_COMM_SELF;
   }
 public:
   static ChiMPI& GetInstance() noexcept
     {return instance;}
   //01
   void Initialize();
+  void SplitReplicatedDomains(int world_location_id, int world_process_count);
 
   //02
 //  void BroadcastCellSets();
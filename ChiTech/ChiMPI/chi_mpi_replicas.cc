@@ -0,0 +1,52 @@
+#include "chi_mpi.h"
+
+#include <iostream>
+
+//###################################################################
+/** Splits MPI_COMM_WORLD into replicated spatial domains.
+ *
+ * The world is divided into `num_replicas` replicas that each own a full
+ * copy of the spatial decomposition. `comm` becomes the communicator of
+ * the replica (the spatial communicator) and `replica_comm` connects the
+ * locations, one per replica, that own the same spatial subdomain.
+ * `location_id` and `process_count` are set relative to `comm` so that
+ * mesh partitioning and all spatial communication are unaware of the
+ * replication.
+ *
+ * Replica partners are assigned consecutive world ranks so that the
+ * replica reductions, which carry large flux-moment vectors, mostly stay
+ * on the same node.
+ *
+ * With a single replica `comm` is simply MPI_COMM_WORLD.*/
+void ChiMPI::SplitReplicatedDomains(int world_location_id,
+                                    int world_process_count)
+{
+  if (num_replicas < 1 or (world_process_count % num_replicas) != 0)
+  {
+    if (world_location_id == 0)
+      std::cerr << "Invalid number of replicas " << num_replicas
+                << ". The number of processes (" << world_process_count
+                << ") must be a multiple of the number of replicas."
+                << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  if (num_replicas == 1)
+  {
+    comm          = MPI_COMM_WORLD;
+    replica_comm  = MPI_COMM_SELF;
+    replica_id    = 0;
+    location_id   = world_location_id;
+    process_count = world_process_count;
+    return;
+  }
+
+  replica_id = world_location_id % num_replicas;
+  const int spatial_id = world_location_id / num_replicas;
+
+  MPI_Comm_split(MPI_COMM_WORLD, replica_id, spatial_id, &comm);
+  MPI_Comm_split(MPI_COMM_WORLD, spatial_id, replica_id, &replica_comm);
+
+  MPI_Comm_rank(comm, &location_id);
+  MPI_Comm_size(comm, &process_count);
+}
@@ -19,7 +19,7 @@ void ChiMPI::BroadcastNodes(std::vector<chi_mesh::Vertex> *nodes)
   for (int k=1;k<this->process_count; k++)
   {
     MPI_Send(node_stack,nodes->size(),
-             NODE_INFO_C, k,123,MPI_COMM_WORLD);
+             NODE_INFO_C, k,123,comm);
   }
   delete [] node_stack;
 }
@@ -34,7 +34,7 @@ void ChiMPI::ReceiveNodes(std::vector<chi_mesh::Vertex> *nodes)
   //                                                   be received
   int node_count;
   MPI_Status status;
-  MPI_Probe(0, 123, MPI_COMM_WORLD, &status);
+  MPI_Probe(0, 123, comm, &status);
 
   MPI_Get_count(&status, NODE_INFO_C, &node_count);
 
@@ -47,7 +47,7 @@ void ChiMPI::ReceiveNodes(std::vector<chi_mesh::Vertex> *nodes)
   NODE_INFO* node_stack = new NODE_INFO[node_count];
 
   MPI_Recv(node_stack,node_count,
-           NODE_INFO_C, 0,123,MPI_COMM_WORLD,&status);
+           NODE_INFO_C, 0,123,comm,&status);
 
   for (int k=0;k<node_count;k++)
   {
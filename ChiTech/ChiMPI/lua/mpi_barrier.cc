@@ -21,6 +21,6 @@ extern ChiMPI& chi_mpi;
 int chiMPIBarrier(lua_State *L)
 {
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
   return 0;
 }
\ No newline at end of file
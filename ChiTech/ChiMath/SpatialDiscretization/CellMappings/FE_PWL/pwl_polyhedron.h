@@ -90,6 +90,10 @@ public:
                           const chi_math::QuadratureTetrahedron& volume_quadrature,
                           const chi_math::QuadratureTriangle&    surface_quadrature);
 
+  //03_compunitintgls.cc
+  void ComputeUnitIntegrals(
+    chi_math::finite_element::UnitIntegralData& ui_data) const override;
+
   void InitializeVolumeQuadraturePointData(
     chi_math::finite_element::InternalQuadraturePointData& internal_data) const override;
 
@@ -113,6 +117,10 @@ private:
   //################################################## Shape functions per face-side
   //01b_sidevalues.cc
 private:
+  void FaceSideShapeCoefficients(unsigned int face_index,
+                                 unsigned int side_index,
+                                 unsigned int i,
+                                 double coefficients[4]) const;
   double FaceSideShape(unsigned int face_index,
                        unsigned int side_index,
                        unsigned int i,
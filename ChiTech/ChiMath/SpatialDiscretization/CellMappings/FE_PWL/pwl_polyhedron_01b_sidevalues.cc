@@ -1,5 +1,27 @@
 #include "pwl_polyhedron.h"
 
+/**Computes the coefficients with which shape function i is expressed
+ * in terms of the four linear shape functions of the side tetrahedron,
+ * i.e. N_i = sum_a coefficients[a]*TetShape(a). Vertex a=0 and a=2 are
+ * the edge vertices, a=1 the face centroid and a=3 the cell centroid.*/
+void PolyhedronMappingFE_PWL::
+  FaceSideShapeCoefficients(unsigned int face_index,
+                            unsigned int side_index,
+                            unsigned int i,
+                            double coefficients[4]) const
+{
+  const auto& side_map = node_side_maps[i].face_map[face_index].
+    side_map[side_index];
+
+  coefficients[0] = 0.0;
+  coefficients[1] = 0.0;
+  coefficients[2] = 0.0;
+  coefficients[3] = alphac;
+
+  if (side_map.index >= 0) coefficients[side_map.index] += 1.0;
+  if (side_map.part_of_face) coefficients[1] += face_betaf[face_index];
+}
+
 /**Precomputes the shape function values of a face-side pair
  * at a quadrature point*/
 double PolyhedronMappingFE_PWL::FaceSideShape(unsigned int face_index,
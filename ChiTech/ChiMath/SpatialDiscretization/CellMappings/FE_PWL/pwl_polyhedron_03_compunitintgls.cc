@@ -0,0 +1,117 @@
+#include "pwl_polyhedron.h"
+
+#include <array>
+
+//###################################################################
+/**Computes cell volume and surface integrals in closed form.
+ *
+ * On each side tetrahedron the shape functions are linear combinations
+ * of the tetrahedron's own linear shape functions (see
+ * FaceSideShapeCoefficients), which are integrated exactly with
+ * \f[
+ *   \int_{T} \lambda_a \lambda_b dV = \frac{\det J}{120} (1+\delta_{ab}),
+ *   \quad
+ *   \int_{T} \lambda_a dV = \frac{\det J}{24}
+ * \f]
+ * and similarly on the side triangle of the face with \f$ \det J_s/24 \f$
+ * and \f$ \det J_s/6 \f$. The gradients are constant per side. No quadrature
+ * point data is built, which is considerably cheaper than the generic
+ * quadrature based integration, while giving the same integrals
+ * to round-off.*/
+void PolyhedronMappingFE_PWL::
+  ComputeUnitIntegrals(chi_math::finite_element::UnitIntegralData& ui_data) const
+{
+  typedef std::vector<VecDbl>  MatDbl;
+  typedef std::vector<VecVec3> MatVec3;
+
+  const size_t num_faces = face_data.size();
+
+  MatDbl   IntV_gradShapeI_gradShapeJ(num_nodes, VecDbl(num_nodes, 0.0));
+  MatVec3  IntV_shapeI_gradshapeJ(num_nodes, VecVec3(num_nodes));
+  MatDbl   IntV_shapeI_shapeJ(num_nodes, VecDbl(num_nodes, 0.0));
+  VecDbl   IntV_shapeI(num_nodes, 0.0);
+  VecVec3  IntV_gradshapeI(num_nodes);
+
+  std::vector<MatDbl>  IntS_shapeI_shapeJ(num_faces);
+  std::vector<VecDbl>  IntS_shapeI(num_faces);
+  std::vector<MatVec3> IntS_shapeI_gradshapeJ(num_faces);
+
+  //Per side: tet coefficients, their sums over the volume (all four
+  //vertices) and over the face (first three vertices), and gradients
+  std::vector<std::array<double,4>> coeffs(num_nodes);
+  VecDbl  sum_V(num_nodes);
+  VecDbl  sum_S(num_nodes);
+  VecVec3 grad(num_nodes);
+
+  for (size_t f=0; f < num_faces; ++f)
+  {
+    IntS_shapeI_shapeJ[f].assign(num_nodes, VecDbl(num_nodes, 0.0));
+    IntS_shapeI[f].assign(num_nodes, 0.0);
+    IntS_shapeI_gradshapeJ[f].assign(num_nodes, VecVec3(num_nodes));
+
+    for (size_t s=0; s < face_data[f].sides.size(); ++s)
+    {
+      const auto& side = face_data[f].sides[s];
+
+      //=================================== Side values of shape functions
+      for (int i=0; i < num_nodes; ++i)
+      {
+        auto& c = coeffs[i];
+        FaceSideShapeCoefficients(f, s, i, c.data());
+
+        sum_S[i] = c[0] + c[1] + c[2];
+        sum_V[i] = sum_S[i] + c[3];
+
+        const chi_mesh::Vector3 ref_grad(c[1] - c[0],
+                                         c[2] - c[0],
+                                         c[3] - c[0]);
+        grad[i] = side.JTinv * ref_grad;
+      }
+
+      //=================================== Volume integrals
+      const double V    = side.detJ/6.0;
+      const double k_V  = side.detJ/120.0;
+      const double k_S  = side.detJ_surf/24.0;
+      const double A_3  = side.detJ_surf/6.0;
+
+      for (int i=0; i < num_nodes; ++i)
+      {
+        const auto& ci = coeffs[i];
+        const double intV_shapeI = sum_V[i]*side.detJ/24.0;
+        const double intS_shapeI = sum_S[i]*A_3;
+
+        IntV_shapeI[i]     += intV_shapeI;
+        IntV_gradshapeI[i] += grad[i]*V;
+        IntS_shapeI[f][i]  += intS_shapeI;
+
+        for (int j=0; j < num_nodes; ++j)
+        {
+          const auto& cj = coeffs[j];
+
+          const double dot_V = ci[0]*cj[0] + ci[1]*cj[1] +
+                               ci[2]*cj[2] + ci[3]*cj[3];
+          const double dot_S = dot_V - ci[3]*cj[3];
+
+          IntV_gradShapeI_gradShapeJ[i][j] += grad[i].Dot(grad[j])*V;
+          IntV_shapeI_shapeJ[i][j]   += k_V*(sum_V[i]*sum_V[j] + dot_V);
+          IntV_shapeI_gradshapeJ[i][j] += grad[j]*intV_shapeI;
+
+          //================================ Surface integrals
+          IntS_shapeI_shapeJ[f][i][j]     += k_S*(sum_S[i]*sum_S[j] + dot_S);
+          IntS_shapeI_gradshapeJ[f][i][j] += grad[j]*intS_shapeI;
+        }//for j
+      }//for i
+    }//for side
+  }//for face
+
+  ui_data.Initialize(IntV_gradShapeI_gradShapeJ,
+                     IntV_shapeI_gradshapeJ,
+                     IntV_shapeI_shapeJ    ,
+                     IntV_shapeI           ,
+                     IntV_gradshapeI       ,
+                     IntS_shapeI_shapeJ    ,
+                     IntS_shapeI           ,
+                     IntS_shapeI_gradshapeJ,
+                     face_dof_mappings,
+                     num_nodes);
+}
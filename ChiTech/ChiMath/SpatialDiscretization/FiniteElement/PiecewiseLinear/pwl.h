@@ -6,6 +6,7 @@
 #include "ChiMesh/MeshContinuum/chi_meshcontinuum.h"
 
 #include "ChiMath/SpatialDiscretization/FiniteElement/spatial_discretization_FE.h"
+#include "ChiMath/SpatialDiscretization/FiniteElement/unit_integrals_cache.h"
 #include "ChiMath/Quadratures/quadrature_line.h"
 #include "ChiMath/Quadratures/quadrature_triangle.h"
 #include "ChiMath/Quadratures/quadrature_quadrilateral.h"
@@ -45,25 +46,30 @@ public:
   unsigned int globl_base_block_size=0;
 
 private:
-  std::map<uint64_t, chi_mesh::Cell*>  neighbor_cells;
-  std::map<uint64_t, std::shared_ptr<CellMappingFE_PWL>> neighbor_cell_fe_views;
+  //Neighbor cell data is stored densely, in the order of the global ids
+  //of the neighbor cells, and indexed via neighbor_cell_index.
+  std::vector<chi_mesh::Cell*>                    neighbor_cells;
+  chi_mesh::GlobalIDIndexMap                      neighbor_cell_index;
+  std::vector<std::shared_ptr<CellMappingFE_PWL>> neighbor_cell_fe_views;
 
 private:
   typedef chi_math::finite_element::UnitIntegralData UIData;
   typedef chi_math::finite_element::InternalQuadraturePointData QPDataVol;
   typedef chi_math::finite_element::FaceQuadraturePointData QPDataFace;
 
-  std::map<uint64_t, UIData>                  nb_fe_unit_integrals;
-  std::map<uint64_t, QPDataVol>               nb_fe_vol_qp_data;
-  std::map<uint64_t, std::vector<QPDataFace>> nb_fe_srf_qp_data;
+  std::vector<UIData>                  nb_fe_unit_integrals;
+  std::vector<QPDataVol>               nb_fe_vol_qp_data;
+  std::vector<std::vector<QPDataFace>> nb_fe_srf_qp_data;
 
   bool nb_integral_data_initialized=false;
   bool nb_qp_data_initialized=false;
 
-private:
-  chi_math::finite_element::UnitIntegralData            scratch_intgl_data;
-  chi_math::finite_element::InternalQuadraturePointData scratch_vol_qp_data;
-  chi_math::finite_element::FaceQuadraturePointData     scratch_face_qp_data;
+  //Unit integrals computed on demand, see ComputeUniqueUnitIntegrals
+  bool                                         cache_unit_integrals=false;
+  std::vector<uint64_t>                        unit_integrals_record_cell_ids;
+  chi_math::finite_element::UnitIntegralsCache unit_integrals_cache;
+  //Cached integrals last returned by GetUnitIntegrals
+  std::shared_ptr<const UIData>                unit_integrals_in_use;
 
 private:
   //00
@@ -99,6 +105,9 @@ public:
   void PreComputeNeighborCellSDValues();
   std::shared_ptr<CellMappingFE_PWL> GetCellMappingFE(uint64_t cell_local_index);
   chi_mesh::Cell&  GetNeighborCell(uint64_t cell_glob_index);
+private:
+  size_t MapNeighborCell(uint64_t cell_glob_index) const;
+public:
   std::shared_ptr<CellMappingFE_PWL> GetNeighborCellMappingFE(uint64_t cell_glob_index);
 
 private:
@@ -146,14 +155,48 @@ public:
                            chi_math::UnknownManager& unknown_manager)
                            override;
 
+  //06
+private:
+  std::vector<int64_t> MakeCellShapeKey(const chi_mesh::Cell& cell,
+                                        double quantum) const;
+  void AssignUnitIntegralRecords();
+  void ComputeUniqueUnitIntegrals();
+  std::shared_ptr<const chi_math::finite_element::UnitIntegralData>
+    GetCachedUnitIntegrals(size_t record);
+
+public:
+  /**Returns the number of local unit integral records, i.e. the number of
+   * unique local cell shapes.*/
+  size_t NumUnitIntegralRecords() const
+  {return cache_unit_integrals? unit_integrals_record_cell_ids.size() :
+                                fe_unit_integrals.size();}
+  void LogUnitIntegralsCacheStatistics() const;
+  std::shared_ptr<const chi_math::finite_element::UnitIntegralData>
+    PinUnitIntegrals(const chi_mesh::Cell& cell);
+
   //FE-utils
+  /**Returns the unit integrals of a cell. If the integrals are computed
+   * on demand, i.e. not stored, the reference is only valid until the
+   * next call. Callers that hold the integrals of more than one cell at a
+   * time must use PinUnitIntegrals instead.*/
   const chi_math::finite_element::UnitIntegralData&
     GetUnitIntegrals(const chi_mesh::Cell& cell) override
   {
+    //Per thread scratch, valid until the thread's next call
+    static thread_local UIData scratch_intgl_data;
+
     if (ref_grid->IsCellLocal(cell.global_id))
     {
       if (integral_data_initialized)
-        return fe_unit_integrals.at(cell.local_id);
+      {
+        const size_t record = fe_unit_integrals_index.at(cell.local_id);
+        if (cache_unit_integrals)
+        {
+          unit_integrals_in_use = GetCachedUnitIntegrals(record);
+          return *unit_integrals_in_use;
+        }
+        return fe_unit_integrals.at(record);
+      }
       else
       {
         auto cell_fe_view = GetCellMappingFE(cell.local_id);
@@ -165,7 +208,7 @@ public:
     else
     {
       if (nb_integral_data_initialized)
-        return nb_fe_unit_integrals.at(cell.global_id);
+        return nb_fe_unit_integrals.at(MapNeighborCell(cell.global_id));
       else
       {
         auto cell_fe_view = GetNeighborCellMappingFE(cell.global_id);
@@ -178,6 +221,9 @@ public:
   const chi_math::finite_element::InternalQuadraturePointData&
     GetQPData_Volumetric(const chi_mesh::Cell& cell) override
   {
+    //Per thread scratch, valid until the thread's next call
+    static thread_local QPDataVol scratch_vol_qp_data;
+
     if (ref_grid->IsCellLocal(cell.global_id))
     {
       if (qp_data_initialized)
@@ -192,7 +238,7 @@ public:
     else
     {
       if (nb_qp_data_initialized)
-        return nb_fe_vol_qp_data.at(cell.global_id);
+        return nb_fe_vol_qp_data.at(MapNeighborCell(cell.global_id));
       else
       {
         auto cell_fe_view = GetNeighborCellMappingFE(cell.global_id);
@@ -206,6 +252,9 @@ public:
     GetQPData_Surface(const chi_mesh::Cell& cell,
                       const unsigned int face) override
   {
+    //Per thread scratch, valid until the thread's next call
+    static thread_local QPDataFace scratch_face_qp_data;
+
     if (ref_grid->IsCellLocal(cell.global_id))
     {
       if (qp_data_initialized)
@@ -225,7 +274,8 @@ public:
     {
       if (nb_qp_data_initialized)
       {
-        const auto& face_data = nb_fe_srf_qp_data.at(cell.global_id);
+        const auto& face_data =
+          nb_fe_srf_qp_data.at(MapNeighborCell(cell.global_id));
 
         return face_data.at(face);
       }
@@ -28,7 +28,17 @@ SpatialDiscretization_PWLD::
 
   chi_log.Log() << chi_program_timer.GetTimeString()
                 << " Communicating partition neighbors.";
-  ref_grid->CommunicatePartitionNeighborCells(neighbor_cells);
+  {
+    std::map<uint64_t, chi_mesh::Cell*> neighbor_cell_map;
+    ref_grid->CommunicatePartitionNeighborCells(neighbor_cell_map);
+
+    neighbor_cells.reserve(neighbor_cell_map.size());
+    for (const auto& cell_map : neighbor_cell_map)
+    {
+      neighbor_cell_index.Insert(cell_map.first, neighbor_cells.size());
+      neighbor_cells.push_back(cell_map.second);
+    }
+  }
 
   if (setup_flags == chi_math::finite_element::COMPUTE_UNIT_INTEGRALS)
   {
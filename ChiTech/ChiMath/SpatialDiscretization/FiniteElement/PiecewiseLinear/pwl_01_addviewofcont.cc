@@ -10,9 +10,15 @@
 #include "chi_log.h"
 extern ChiLog& chi_log;
 
+#include "chi_mpi.h"
+extern ChiMPI& chi_mpi;
+
 #include "ChiTimer/chi_timer.h"
 extern ChiTimer chi_program_timer;
 
+#include "ChiMath/chi_math_threads.h"
+extern ChiMath& chi_math_handler;
+
 //###################################################################
 /**Makes a shared_ptr CellPWLView for a cell based on its type.*/
 std::shared_ptr<CellMappingFE_PWL> SpatialDiscretization_PWLD::
@@ -114,10 +120,15 @@ std::shared_ptr<CellMappingFE_PWL> SpatialDiscretization_PWLD::
 }
 
 //###################################################################
-/**Adds a PWL Finite Element for each cell of the local problem.*/
+/**Adds a PWL Finite Element for each cell of the local problem. The
+ * cell mappings, unit integrals and quadrature point data are computed
+ * with chi_math_handler.num_setup_threads threads. Each cell's data is
+ * written to its own pre-allocated slot, hence the results do not depend
+ * on the number of threads.*/
 void SpatialDiscretization_PWLD::PreComputeCellSDValues()
 {
   size_t num_local_cells = ref_grid->local_cells.size();
+  const unsigned int num_threads = chi_math_handler.num_setup_threads;
 
   //================================================== Create empty view
   //                                                 for each cell
@@ -129,14 +140,16 @@ void SpatialDiscretization_PWLD::PreComputeCellSDValues()
       {
         chi_log.Log() << chi_program_timer.GetTimeString()
                       << " Computing cell views";
-        for (const auto& cell : ref_grid->local_cells)
-          cell_mappings.push_back(MakeCellMappingFE(cell));
+        cell_mappings.assign(num_local_cells, nullptr);
+        chi_math::ParallelFor(num_local_cells, num_threads,
+          [this](size_t lc)
+          {cell_mappings[lc] = MakeCellMappingFE(ref_grid->local_cells[lc]);});
 
         mapping_initialized = true;
       }
     }
   }
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //============================================= Unit integrals
   {
@@ -147,22 +160,13 @@ void SpatialDiscretization_PWLD::PreComputeCellSDValues()
       {
         chi_log.Log() << chi_program_timer.GetTimeString()
                       << " Computing unit integrals.";
-        fe_unit_integrals.reserve(num_local_cells);
-        for (size_t lc=0; lc<num_local_cells; ++lc)
-        {
-          UIData ui_data;
-
-          auto cell_fe_view = GetCellMappingFE(lc);
-          cell_fe_view->ComputeUnitIntegrals(ui_data);
-
-          fe_unit_integrals.push_back(std::move(ui_data));
-        }
+        ComputeUniqueUnitIntegrals();
 
         integral_data_initialized = true;
       }
     }//if compute unit intgrls
   }
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
 
   //============================================= Quadrature data
@@ -174,17 +178,15 @@ void SpatialDiscretization_PWLD::PreComputeCellSDValues()
       {
         chi_log.Log() << chi_program_timer.GetTimeString()
                       << " Computing quadrature data.";
-        fe_vol_qp_data.reserve(num_local_cells);
-        fe_srf_qp_data.reserve(num_local_cells);
-        for (size_t lc=0; lc<num_local_cells; ++lc)
-        {
-          fe_vol_qp_data.emplace_back();
-          fe_srf_qp_data.emplace_back();
-
-          auto cell_fe_view = GetCellMappingFE(lc);
-          cell_fe_view->InitializeAllQuadraturePointData(fe_vol_qp_data.back(),
-                                                         fe_srf_qp_data.back());
-        }
+        fe_vol_qp_data.assign(num_local_cells, QPDataVol());
+        fe_srf_qp_data.assign(num_local_cells, std::vector<QPDataFace>());
+        chi_math::ParallelFor(num_local_cells, num_threads,
+          [this](size_t lc)
+          {
+            auto cell_fe_view = GetCellMappingFE(lc);
+            cell_fe_view->InitializeAllQuadraturePointData(fe_vol_qp_data[lc],
+                                                           fe_srf_qp_data[lc]);
+          });
 
         qp_data_initialized = true;
       }
@@ -193,9 +195,14 @@ void SpatialDiscretization_PWLD::PreComputeCellSDValues()
 }//AddViewOfLocalContinuum
 
 //###################################################################
-/**Adds a PWL Finite Element for each cell of the neighboring cells.*/
+/**Adds a PWL Finite Element for each cell of the neighboring cells. As
+ * for the local cells, the data is computed by multiple threads into
+ * per-cell slots, which are in the same order as neighbor_cells.*/
 void SpatialDiscretization_PWLD::PreComputeNeighborCellSDValues()
 {
+  const unsigned int num_threads = chi_math_handler.num_setup_threads;
+  const size_t num_nb_cells = neighbor_cells.size();
+
   //================================================== Populate cell fe views
   {
     using namespace chi_math::finite_element;
@@ -205,19 +212,16 @@ void SpatialDiscretization_PWLD::PreComputeNeighborCellSDValues()
       {
         chi_log.Log() << chi_program_timer.GetTimeString()
                       << " Computing neighbor cell views.";
-        for (auto& cell_map : neighbor_cells)
-        {
-          const auto& cell = *cell_map.second;
-
-          neighbor_cell_fe_views.insert(
-            std::make_pair(cell.global_id, MakeCellMappingFE(cell)));
-        }//for num cells
+        neighbor_cell_fe_views.assign(num_nb_cells, nullptr);
+        chi_math::ParallelFor(num_nb_cells, num_threads,
+          [this](size_t c)
+          {neighbor_cell_fe_views[c] = MakeCellMappingFE(*neighbor_cells[c]);});
 
         nb_mapping_initialized = true;
       }
     }
   }
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //============================================= Unit integrals
   {
@@ -228,16 +232,13 @@ void SpatialDiscretization_PWLD::PreComputeNeighborCellSDValues()
       {
         chi_log.Log() << chi_program_timer.GetTimeString()
                       << " Computing neighbor unit integrals.";
-        for (auto& nb_cell : neighbor_cells)
-        {
-          uint64_t cell_global_id = nb_cell.first;
-          auto cell_fe_view = GetNeighborCellMappingFE(cell_global_id);
-
-          UIData ui_data;
-          cell_fe_view->ComputeUnitIntegrals(ui_data);
-
-          nb_fe_unit_integrals.insert(std::make_pair(cell_global_id,std::move(ui_data)));
-        }
+        nb_fe_unit_integrals.assign(num_nb_cells, UIData());
+        chi_math::ParallelFor(num_nb_cells, num_threads,
+          [this](size_t c)
+          {
+            auto cell_fe_view = GetNeighborCellMappingFE(neighbor_cells[c]->global_id);
+            cell_fe_view->ComputeUnitIntegrals(nb_fe_unit_integrals[c]);
+          });
 
         nb_integral_data_initialized = true;
       }
@@ -254,19 +255,15 @@ void SpatialDiscretization_PWLD::PreComputeNeighborCellSDValues()
       {
         chi_log.Log() << chi_program_timer.GetTimeString()
                       << " Computing neighbor quadrature data.";
-        for (auto& nb_cell : neighbor_cells)
-        {
-          uint64_t cell_global_id = nb_cell.first;
-          auto cell_fe_view = GetNeighborCellMappingFE(cell_global_id);
-
-          QPDataVol qp_data_vol;
-          std::vector<QPDataFace> qp_data_srf;
-          cell_fe_view->InitializeAllQuadraturePointData(qp_data_vol,
-                                                         qp_data_srf);
-
-          nb_fe_vol_qp_data.insert(std::make_pair(cell_global_id,std::move(qp_data_vol)));
-          nb_fe_srf_qp_data.insert(std::make_pair(cell_global_id,std::move(qp_data_srf)));
-        }
+        nb_fe_vol_qp_data.assign(num_nb_cells, QPDataVol());
+        nb_fe_srf_qp_data.assign(num_nb_cells, std::vector<QPDataFace>());
+        chi_math::ParallelFor(num_nb_cells, num_threads,
+          [this](size_t c)
+          {
+            auto cell_fe_view = GetNeighborCellMappingFE(neighbor_cells[c]->global_id);
+            cell_fe_view->InitializeAllQuadraturePointData(nb_fe_vol_qp_data[c],
+                                                           nb_fe_srf_qp_data[c]);
+          });
 
         nb_qp_data_initialized = true;
       }
@@ -313,13 +310,22 @@ chi_mesh::Cell& SpatialDiscretization_PWLD::
     return ref_grid->cells[cell_glob_index];
 
   //=================================== Now check neighbor cells
-  auto neighbor_location = neighbor_cells.find(cell_glob_index);
+  return *neighbor_cells[MapNeighborCell(cell_glob_index)];
+}
 
-  if (neighbor_location != neighbor_cells.end())
-    return *neighbor_cells.at(cell_glob_index);
-  else
+//###################################################################
+/**Maps the global index of a neighboring cell to the index of its data
+ * in the neighbor cell vectors.*/
+size_t SpatialDiscretization_PWLD::
+  MapNeighborCell(uint64_t cell_glob_index) const
+{
+  const uint64_t nb_index = neighbor_cell_index.Find(cell_glob_index);
+
+  if (nb_index == chi_mesh::GlobalIDIndexMap::NOT_FOUND)
     throw std::logic_error(std::string(__FUNCTION__) +
                            " Mapping of neighbor cell failed.");
+
+  return nb_index;
 }
 
 //###################################################################
@@ -336,15 +342,7 @@ std::shared_ptr<CellMappingFE_PWL> SpatialDiscretization_PWLD::
 
   //=================================== Now check neighbor cells
   if (nb_mapping_initialized)
-  {
-    auto neighbor_location = neighbor_cell_fe_views.find(cell_glob_index);
-
-    if (neighbor_location != neighbor_cell_fe_views.end())
-      return neighbor_cell_fe_views.at(cell_glob_index);
-    else
-      throw std::logic_error(std::string(__FUNCTION__) +
-                             " Mapping of neighbor cell failed.");
-  }
+    return neighbor_cell_fe_views[MapNeighborCell(cell_glob_index)];
   else
   {
     return MakeCellMappingFE(GetNeighborCell(cell_glob_index));
@@ -39,7 +39,7 @@ void SpatialDiscretization_PWLD::OrderNodes()
   int global_dof_count=0;
   MPI_Allreduce(&local_dof_count,    //Send buffer
                 &global_dof_count,   //Recv buffer
-                1,MPI_INT,MPI_SUM,MPI_COMM_WORLD);
+                1,MPI_INT,MPI_SUM,chi_mpi.comm);
 
   //================================================== Ring communicate DOF start
   local_block_address = 0;
@@ -49,7 +49,7 @@ void SpatialDiscretization_PWLD::OrderNodes()
              1,MPI_INT,              //Count and type
              chi_mpi.location_id-1,  //Source
              111,                    //Tag
-             MPI_COMM_WORLD,MPI_STATUS_IGNORE);
+             chi_mpi.comm,MPI_STATUS_IGNORE);
   }
 
   if (chi_mpi.location_id != (chi_mpi.process_count-1))
@@ -59,7 +59,7 @@ void SpatialDiscretization_PWLD::OrderNodes()
              1,MPI_INT,
              chi_mpi.location_id+1,
              111,
-             MPI_COMM_WORLD);
+             chi_mpi.comm);
   }
 
   chi_log.Log(LOG_ALLVERBOSE_2)
@@ -80,7 +80,7 @@ void SpatialDiscretization_PWLD::OrderNodes()
 //                locJ_block_address.data(),    //recv buf
 //                1,                            //recv count
 //                MPI_INT,                      //recv type
-//                MPI_COMM_WORLD);              //communicator
+//                chi_mpi.comm);              //communicator
 
   //======================================== Collect block sizes
   locJ_block_size.clear();
@@ -91,6 +91,6 @@ void SpatialDiscretization_PWLD::OrderNodes()
                 locJ_block_size.data(),       //recv buf
                 1,                            //recv count
                 MPI_INT,                      //recv type
-                MPI_COMM_WORLD);              //communicator
+                chi_mpi.comm);              //communicator
 }
 
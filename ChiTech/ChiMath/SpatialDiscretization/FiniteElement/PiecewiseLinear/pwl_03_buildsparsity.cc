@@ -190,7 +190,7 @@ BuildSparsityPattern(std::vector<int64_t> &nodal_nnz_in_diag,
   std::vector<int> recv_counts(chi_mpi.process_count,0);
 
   MPI_Alltoall(send_counts.data(), 1, MPI_INT,
-               recv_counts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+               recv_counts.data(), 1, MPI_INT, chi_mpi.comm);
 
   //============================================= Build receive displacements
   std::vector<int> recv_displs(chi_mpi.process_count,0);
@@ -213,9 +213,9 @@ BuildSparsityPattern(std::vector<int64_t> &nodal_nnz_in_diag,
                 recv_counts.data(),
                 recv_displs.data(),
                 MPI_INT,
-                MPI_COMM_WORLD);
+                chi_mpi.comm);
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //============================================= Deserialize
   {
@@ -269,7 +269,7 @@ BuildSparsityPattern(std::vector<int64_t> &nodal_nnz_in_diag,
     }//for j
   }
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
   chi_log.Log(LOG_0) << "Done building DFEM sparsity pattern";
 
 }
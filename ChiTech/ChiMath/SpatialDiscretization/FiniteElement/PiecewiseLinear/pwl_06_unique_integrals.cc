@@ -0,0 +1,267 @@
+#include "pwl.h"
+
+#include "chi_log.h"
+extern ChiLog& chi_log;
+
+#include "chi_mpi.h"
+extern ChiMPI& chi_mpi;
+
+#include "ChiMath/chi_math_threads.h"
+extern ChiMath& chi_math_handler;
+
+#include <cmath>
+#include <iomanip>
+
+//###################################################################
+/**Makes a key that identifies the shape of a cell up to a translation.
+ * The key consists of the cell type, the face-to-vertex connectivity in
+ * terms of the cell's local vertex indices and the vertex coordinates
+ * relative to the cell's first vertex, rounded to multiples of the supplied
+ * quantum. Cells with equal keys have the same unit integrals, up to
+ * round-off, since these only depend on the relative vertex positions in
+ * a Cartesian coordinate system.*/
+std::vector<int64_t> SpatialDiscretization_PWLD::
+  MakeCellShapeKey(const chi_mesh::Cell& cell, double quantum) const
+{
+  const size_t num_vertices = cell.vertex_ids.size();
+
+  std::vector<int64_t> key;
+  key.reserve(2 + 3*num_vertices + 4*cell.faces.size());
+
+  key.push_back(static_cast<int64_t>(cell.Type()));
+  key.push_back(static_cast<int64_t>(num_vertices));
+
+  //================================================== Face connectivity
+  for (const auto& face : cell.faces)
+  {
+    key.push_back(static_cast<int64_t>(face.vertex_ids.size()));
+    for (uint64_t vid : face.vertex_ids)
+    {
+      int64_t local_index = -1;
+      for (size_t v=0; v<num_vertices; ++v)
+        if (cell.vertex_ids[v] == vid) {local_index = v; break;}
+      key.push_back(local_index);
+    }
+  }
+
+  //================================================== Relative coordinates
+  const auto& v0 = ref_grid->vertices[cell.vertex_ids[0]];
+  for (uint64_t vid : cell.vertex_ids)
+  {
+    const auto dv = ref_grid->vertices[vid] - v0;
+    key.push_back(std::llround(dv.x/quantum));
+    key.push_back(std::llround(dv.y/quantum));
+    key.push_back(std::llround(dv.z/quantum));
+  }
+
+  return key;
+}
+
+//###################################################################
+/**Assigns each local cell a unit integrals record, one record per unique
+ * cell shape. On orthogonal and extruded meshes most cells are
+ * translations of each other, in which case the number of records is much
+ * smaller than the number of cells. Each local cell indexes its record via
+ * fe_unit_integrals_index, and unit_integrals_record_cell_ids holds the
+ * local id of the cell from which each record is computed.
+ *
+ * Integrals in curvilinear coordinate systems depend on the position of
+ * the cell and are therefore stored per cell.*/
+void SpatialDiscretization_PWLD::AssignUnitIntegralRecords()
+{
+  const size_t num_local_cells = ref_grid->local_cells.size();
+
+  fe_unit_integrals_index.assign(num_local_cells, 0);
+
+  auto& record_cell_ids = unit_integrals_record_cell_ids;
+  record_cell_ids.clear();
+
+  if (cs_type != chi_math::CoordinateSystemType::CARTESIAN)
+  {
+    //============================================= Per cell storage
+    record_cell_ids.reserve(num_local_cells);
+    for (size_t lc=0; lc<num_local_cells; ++lc)
+    {
+      fe_unit_integrals_index[lc] = lc;
+      record_cell_ids.push_back(lc);
+    }
+    return;
+  }
+
+  //================================================== Determine quantum
+  // The relative coordinates are rounded to a fraction of the largest
+  // cell extent, so that cells differing by round-off share a record.
+  double max_extent = 0.0;
+  for (const auto& cell : ref_grid->local_cells)
+  {
+    const auto& v0 = ref_grid->vertices[cell.vertex_ids[0]];
+    for (uint64_t vid : cell.vertex_ids)
+    {
+      const auto dv = ref_grid->vertices[vid] - v0;
+      max_extent = std::max(max_extent, std::fabs(dv.x));
+      max_extent = std::max(max_extent, std::fabs(dv.y));
+      max_extent = std::max(max_extent, std::fabs(dv.z));
+    }
+  }
+  const double quantum = (max_extent > 0.0)? 1.0e-12*max_extent : 1.0;
+
+  //================================================== Unique shapes
+  std::map<std::vector<int64_t>, size_t> shape_key_to_record;
+  for (const auto& cell : ref_grid->local_cells)
+  {
+    auto key = MakeCellShapeKey(cell, quantum);
+
+    auto shape = shape_key_to_record.find(key);
+    if (shape != shape_key_to_record.end())
+    {
+      fe_unit_integrals_index[cell.local_id] = shape->second;
+      continue;
+    }
+
+    const size_t record = record_cell_ids.size();
+    record_cell_ids.push_back(cell.local_id);
+    fe_unit_integrals_index[cell.local_id] = record;
+    shape_key_to_record.insert(std::make_pair(std::move(key), record));
+  }
+}
+
+//###################################################################
+/**Computes the unit integrals of the local cells, storing a single
+ * record per unique cell shape (see AssignUnitIntegralRecords).
+ *
+ * The records are assigned serially, in local cell order, after which
+ * the integrals of the records are computed with
+ * chi_math_handler.num_setup_threads threads.
+ *
+ * If chi_math_handler.unit_integrals_cache_mb is non-zero, the records
+ * are not computed here. Instead, GetUnitIntegrals computes them on
+ * demand and keeps them in a scan-resistant cache bounded by that
+ * memory budget (see UnitIntegralsCache).*/
+void SpatialDiscretization_PWLD::ComputeUniqueUnitIntegrals()
+{
+  const size_t num_local_cells = ref_grid->local_cells.size();
+
+  AssignUnitIntegralRecords();
+  const auto& record_cell_ids = unit_integrals_record_cell_ids;
+
+  fe_unit_integrals.clear();
+
+  //================================================== Cache records
+  if (chi_math_handler.unit_integrals_cache_mb > 0.0)
+  {
+    const double budget = chi_math_handler.unit_integrals_cache_mb*
+                          1024.0*1024.0;
+    unit_integrals_cache.Clear();
+    unit_integrals_cache.SetMemoryBudget(static_cast<size_t>(budget));
+    cache_unit_integrals = true;
+
+    chi_log.Log(LOG_0VERBOSE_1)
+      << "Unit integrals: " << record_cell_ids.size()
+      << " unique cell shapes for " << num_local_cells << " local cells, "
+      << "computed on demand.";
+    return;
+  }
+
+  //================================================== Compute records
+  fe_unit_integrals.resize(record_cell_ids.size());
+  fe_unit_integrals.shrink_to_fit();
+  chi_math::ParallelFor(record_cell_ids.size(),
+                        chi_math_handler.num_setup_threads,
+    [this,&record_cell_ids](size_t r)
+    {
+      auto cell_fe_view = GetCellMappingFE(record_cell_ids[r]);
+      cell_fe_view->ComputeUnitIntegrals(fe_unit_integrals[r]);
+    });
+
+  unit_integrals_record_cell_ids.clear();
+  unit_integrals_record_cell_ids.shrink_to_fit();
+
+  chi_log.Log(LOG_0VERBOSE_1)
+    << "Unit integrals: " << fe_unit_integrals.size()
+    << " unique cell shapes for " << num_local_cells << " local cells.";
+}
+
+//###################################################################
+/**Returns the unit integrals of a record from the cache, computing them
+ * if they are not cached. The integrals remain valid as long as the
+ * returned pointer is held, even if the record is evicted.*/
+std::shared_ptr<const chi_math::finite_element::UnitIntegralData>
+  SpatialDiscretization_PWLD::GetCachedUnitIntegrals(size_t record)
+{
+  return unit_integrals_cache.Get(record,
+    [this,record](UIData& ui_data)
+    {
+      auto cell_fe_view =
+        GetCellMappingFE(unit_integrals_record_cell_ids.at(record));
+      cell_fe_view->ComputeUnitIntegrals(ui_data);
+    });
+}
+
+//###################################################################
+/**Returns a pointer to the unit integrals of a cell that remains valid
+ * for as long as it is held, independent of other calls. Cached
+ * integrals are pinned, integrals computed on demand without the cache
+ * are copied and stored integrals are referenced without ownership.
+ * Callers that hold the integrals of several cells at the same time,
+ * e.g. of a cell and its neighbors, must use this instead of
+ * GetUnitIntegrals.*/
+std::shared_ptr<const chi_math::finite_element::UnitIntegralData>
+  SpatialDiscretization_PWLD::PinUnitIntegrals(const chi_mesh::Cell& cell)
+{
+  if (ref_grid->IsCellLocal(cell.global_id) and integral_data_initialized)
+  {
+    const size_t record = fe_unit_integrals_index.at(cell.local_id);
+    if (cache_unit_integrals)
+      return GetCachedUnitIntegrals(record);
+
+    //Aliasing constructor without an owner, i.e. a plain reference
+    return std::shared_ptr<const UIData>(std::shared_ptr<const UIData>(),
+                                         &fe_unit_integrals.at(record));
+  }
+
+  if (not ref_grid->IsCellLocal(cell.global_id) and
+      nb_integral_data_initialized)
+    return std::shared_ptr<const UIData>(std::shared_ptr<const UIData>(),
+      &nb_fe_unit_integrals.at(MapNeighborCell(cell.global_id)));
+
+  return std::make_shared<UIData>(GetUnitIntegrals(cell));
+}
+
+//###################################################################
+/**Logs the hits, misses, evictions and resident entries of the unit
+ * integrals cache, summed over all locations, together with the largest
+ * cache memory of any location and the hit rate in percent. Must be
+ * called by all locations. Does nothing if the unit integrals are not
+ * cached.*/
+void SpatialDiscretization_PWLD::LogUnitIntegralsCacheStatistics() const
+{
+  if (not cache_unit_integrals) return;
+
+  const auto& stats = unit_integrals_cache.GetStatistics();
+
+  uint64_t local_counts[] = {stats.hits, stats.misses, stats.evictions,
+                             unit_integrals_cache.NumResidentEntries()};
+  uint64_t global_counts[] = {0, 0, 0, 0};
+  MPI_Allreduce(local_counts, global_counts, 4,
+                MPI_UINT64_T, MPI_SUM, chi_mpi.comm);
+
+  double local_memory = unit_integrals_cache.MemoryInUse()/1024.0/1024.0;
+  double max_memory = 0.0;
+  MPI_Allreduce(&local_memory, &max_memory,
+                1, MPI_DOUBLE, MPI_MAX, chi_mpi.comm);
+
+  const uint64_t num_requests = global_counts[0] + global_counts[1];
+  const double hit_rate = (num_requests > 0)?
+    100.0*static_cast<double>(global_counts[0])/
+          static_cast<double>(num_requests) : 0.0;
+
+  chi_log.Log(LOG_0)
+    << "Unit integrals cache: hits " << global_counts[0]
+    << ", misses " << global_counts[1]
+    << ", evictions " << global_counts[2]
+    << ", resident entries " << global_counts[3]
+    << ", max process cache memory " << std::setprecision(3)
+    << max_memory << " MB";
+  chi_log.Log(LOG_0)
+    << "Unit integrals cache hit-rate= " << std::setprecision(4) << hit_rate;
+}
@@ -136,7 +136,7 @@ public:
   GetUnitIntegrals(const chi_mesh::Cell& cell) override
   {
     if (integral_data_initialized)
-      return fe_unit_integrals.at(cell.local_id);
+      return fe_unit_integrals.at(fe_unit_integrals_index.at(cell.local_id));
     else
     {
       auto cell_fe_view = GetCellMappingFE(cell.local_id);
@@ -10,6 +10,9 @@
 #include "chi_log.h"
 extern ChiLog& chi_log;
 
+#include "chi_mpi.h"
+extern ChiMPI& chi_mpi;
+
 #include "ChiTimer/chi_timer.h"
 extern ChiTimer chi_program_timer;
 
@@ -117,7 +120,7 @@ std::shared_ptr<CellMappingFE_PWL> SpatialDiscretization_PWLC::
 /**Adds a PWL Finite Element for each cell of the local problem.*/
 void SpatialDiscretization_PWLC::PreComputeCellSDValues()
 {
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
   chi_log.Log(LOG_0VERBOSE_1) << chi_program_timer.GetTimeString()
                               << " Add cell SD-values.";
 
@@ -140,7 +143,7 @@ void SpatialDiscretization_PWLC::PreComputeCellSDValues()
       }
     }
   }
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //============================================= Unit integrals
   {
@@ -152,6 +155,7 @@ void SpatialDiscretization_PWLC::PreComputeCellSDValues()
       if (not integral_data_initialized)
       {
         fe_unit_integrals.reserve(num_local_cells);
+        fe_unit_integrals_index.reserve(num_local_cells);
         for (size_t lc=0; lc<num_local_cells; ++lc)
         {
           UIData ui_data;
@@ -159,6 +163,7 @@ void SpatialDiscretization_PWLC::PreComputeCellSDValues()
           auto cell_fe_view = GetCellMappingFE(lc);
           cell_fe_view->ComputeUnitIntegrals(ui_data);
 
+          fe_unit_integrals_index.push_back(fe_unit_integrals.size());
           fe_unit_integrals.push_back(std::move(ui_data));
         }
 
@@ -166,7 +171,7 @@ void SpatialDiscretization_PWLC::PreComputeCellSDValues()
       }
     }//if compute unit intgrls
   }
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //============================================= Quadrature data
   {
@@ -193,7 +198,7 @@ void SpatialDiscretization_PWLC::PreComputeCellSDValues()
       }
     }//if init qp data
   }
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
   chi_log.Log(LOG_0VERBOSE_1) << chi_program_timer.GetTimeString()
                               << " Done adding cell SD-values.";
 
@@ -106,7 +106,7 @@ void SpatialDiscretization_PWLC::OrderNodes()
   {
     MPI_Send(nonexclus_nodes.data(),
              nonexclus_nodes.size(),
-             MPI_INT,1,123,MPI_COMM_WORLD);
+             MPI_INT,1,123,chi_mpi.comm);
   }
     // Location n=1..(N-1) first receives n-1
   else
@@ -114,13 +114,13 @@ void SpatialDiscretization_PWLC::OrderNodes()
     std::vector<int> upstream_nonex;
 
     MPI_Status status;
-    MPI_Probe(chi_mpi.location_id-1,123,MPI_COMM_WORLD,&status);
+    MPI_Probe(chi_mpi.location_id-1,123,chi_mpi.comm,&status);
     int num_to_recv=0;
     MPI_Get_count(&status,MPI_INT,&num_to_recv);
     upstream_nonex.resize(num_to_recv,-1);
     MPI_Recv(upstream_nonex.data(),num_to_recv,
              MPI_INT,chi_mpi.location_id-1,123,
-             MPI_COMM_WORLD,MPI_STATUS_IGNORE);
+             chi_mpi.comm,MPI_STATUS_IGNORE);
 
     // Run through location n non-exclusive nodes
     // if a non-exclusive node is not in the upstream list then
@@ -139,7 +139,7 @@ void SpatialDiscretization_PWLC::OrderNodes()
     // send the updated upstream_nonex to location n+1
     if (chi_mpi.location_id<(chi_mpi.process_count-1))
       MPI_Send(upstream_nonex.data(),upstream_nonex.size(),
-               MPI_INT,chi_mpi.location_id+1,123,MPI_COMM_WORLD);
+               MPI_INT,chi_mpi.location_id+1,123,chi_mpi.comm);
       // On the last location send the completed
       // upstream_nonex back to all other locations
     else
@@ -153,7 +153,7 @@ void SpatialDiscretization_PWLC::OrderNodes()
 
       for (int loc=0; loc<(chi_mpi.process_count-1); loc++)
         MPI_Send(global_ghost_nodes.data(),global_ghost_nodes.size(),
-                 MPI_INT,loc,124,MPI_COMM_WORLD);
+                 MPI_INT,loc,124,chi_mpi.comm);
 
     }
   }
@@ -162,18 +162,18 @@ void SpatialDiscretization_PWLC::OrderNodes()
   if (chi_mpi.location_id<(chi_mpi.process_count-1))
   {
     MPI_Status status;
-    MPI_Probe(chi_mpi.process_count-1,124,MPI_COMM_WORLD,&status);
+    MPI_Probe(chi_mpi.process_count-1,124,chi_mpi.comm,&status);
     int num_to_recv=0;
     MPI_Get_count(&status,MPI_INT,&num_to_recv);
     global_ghost_nodes.resize(num_to_recv,-1);
     MPI_Recv(global_ghost_nodes.data(),num_to_recv,
              MPI_INT,chi_mpi.process_count-1,124,
-             MPI_COMM_WORLD,MPI_STATUS_IGNORE);
+             chi_mpi.comm,MPI_STATUS_IGNORE);
   }
 
   chi_log.Log(LOG_ALLVERBOSE_1) << "Total number of ghost nodes: "
                                 << global_ghost_nodes.size() << std::endl;
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   chi_log.Log(LOG_0VERBOSE_1) << "*** Reordering stage 3 time: "
                               << t_stage[3].GetTime()/1000.0;
@@ -219,7 +219,7 @@ void SpatialDiscretization_PWLC::OrderNodes()
   chi_log.Log(LOG_ALLVERBOSE_1) << "Local ghost ownership: "
                                 << g_from << "->" << g_to
                                 << "(" << num_g_loc << ")" << std::endl;
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //================================================== Ring Compute local portion
   //The local portion of the nodes are the exclusive nodes
@@ -239,21 +239,21 @@ void SpatialDiscretization_PWLC::OrderNodes()
     local_from = 0;
     local_to = (int)exclusive_nodes.size() - 1 + num_g_loc;
     MPI_Send(&local_to,1,
-             MPI_INT,chi_mpi.location_id+1,125,MPI_COMM_WORLD);
+             MPI_INT,chi_mpi.location_id+1,125,chi_mpi.comm);
   }
   else
   {
     int upstream_loc_end = 0;
     MPI_Recv(&upstream_loc_end,1,
              MPI_INT,chi_mpi.location_id-1,125,
-             MPI_COMM_WORLD,MPI_STATUS_IGNORE);
+             chi_mpi.comm,MPI_STATUS_IGNORE);
 
     local_from = upstream_loc_end + 1;
     local_to = local_from + (int)exclusive_nodes.size() - 1 + num_g_loc;
 
     if (chi_mpi.location_id<(chi_mpi.process_count-1))
       MPI_Send(&local_to,1,
-               MPI_INT,chi_mpi.location_id+1,125,MPI_COMM_WORLD);
+               MPI_INT,chi_mpi.location_id+1,125,chi_mpi.comm);
 
   }
   int tot_local_nodes = local_to - local_from + 1;
@@ -261,10 +261,10 @@ void SpatialDiscretization_PWLC::OrderNodes()
                                 << local_from << "->" << local_to
                                 << "(" << tot_local_nodes << ")"
                                 << std::endl;
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
   chi_log.Log(LOG_0VERBOSE_1) << "*** Reordering stage 4 time: "
                               << t_stage[4].GetTime()/1000.0;
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   t_stage[5].Reset();
 
@@ -286,19 +286,19 @@ void SpatialDiscretization_PWLC::OrderNodes()
       ghost_mapping[g] = ghost_index;
     }
     MPI_Send(ghost_mapping.data(),ghost_mapping.size(),
-             MPI_INT,chi_mpi.location_id+1,126,MPI_COMM_WORLD);
+             MPI_INT,chi_mpi.location_id+1,126,chi_mpi.comm);
   }
   else
   {
     std::vector<int> upstream_ghost_mapping;
     MPI_Status status;
-    MPI_Probe(chi_mpi.location_id-1,126,MPI_COMM_WORLD,&status);
+    MPI_Probe(chi_mpi.location_id-1,126,chi_mpi.comm,&status);
     int num_to_recv=0;
     MPI_Get_count(&status,MPI_INT,&num_to_recv);
     upstream_ghost_mapping.resize(num_to_recv,-1);
     MPI_Recv(upstream_ghost_mapping.data(),num_to_recv,
              MPI_INT,chi_mpi.location_id-1,126,
-             MPI_COMM_WORLD,MPI_STATUS_IGNORE);
+             chi_mpi.comm,MPI_STATUS_IGNORE);
 
     std::copy(upstream_ghost_mapping.begin(),
               upstream_ghost_mapping.end(),
@@ -311,11 +311,11 @@ void SpatialDiscretization_PWLC::OrderNodes()
 
     if (chi_mpi.location_id<(chi_mpi.process_count-1))
       MPI_Send(ghost_mapping.data(),ghost_mapping.size(),
-               MPI_INT,chi_mpi.location_id+1,126,MPI_COMM_WORLD);
+               MPI_INT,chi_mpi.location_id+1,126,chi_mpi.comm);
     else
       for (int loc=0; loc<(chi_mpi.process_count-1); loc++)
         MPI_Send(ghost_mapping.data(),ghost_mapping.size(),
-                 MPI_INT,loc,127,MPI_COMM_WORLD);
+                 MPI_INT,loc,127,chi_mpi.comm);
   }
 
   //================================================== Collect ghost mapping
@@ -323,13 +323,13 @@ void SpatialDiscretization_PWLC::OrderNodes()
   if (chi_mpi.location_id<(chi_mpi.process_count-1))
   {
     MPI_Status status;
-    MPI_Probe(chi_mpi.process_count-1,127,MPI_COMM_WORLD,&status);
+    MPI_Probe(chi_mpi.process_count-1,127,chi_mpi.comm,&status);
     int num_to_recv=0;
     MPI_Get_count(&status,MPI_INT,&num_to_recv);
     ghost_mapping.resize(num_to_recv,-1);
     MPI_Recv(ghost_mapping.data(),num_to_recv,
              MPI_INT,chi_mpi.process_count-1,127,
-             MPI_COMM_WORLD,MPI_STATUS_IGNORE);
+             chi_mpi.comm,MPI_STATUS_IGNORE);
   }
 
 
@@ -358,12 +358,12 @@ void SpatialDiscretization_PWLC::OrderNodes()
 
   chi_log.Log(LOG_0VERBOSE_1) << "*** Reordering stage 5 time: "
                               << t_stage[5].GetTime()/1000.0;
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //================================================== Compute block addresses
   chi_log.Log(LOG_0VERBOSE_1) << "*** Reordering stages complete time: "
                               << t_stage[5].GetTime()/1000.0;
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   local_block_address = local_from;
 
@@ -379,7 +379,7 @@ void SpatialDiscretization_PWLC::OrderNodes()
                 locJ_block_address.data(),    //recv buf
                 1,                            //recv count
                 MPI_INT,                      //recv type
-                MPI_COMM_WORLD);              //communicator
+                chi_mpi.comm);              //communicator
 
   //======================================== Collect block sizes
   locJ_block_size.clear();
@@ -390,5 +390,5 @@ void SpatialDiscretization_PWLC::OrderNodes()
                 locJ_block_size.data(),       //recv buf
                 1,                            //recv count
                 MPI_INT,                      //recv type
-                MPI_COMM_WORLD);              //communicator
+                chi_mpi.comm);              //communicator
 }
\ No newline at end of file
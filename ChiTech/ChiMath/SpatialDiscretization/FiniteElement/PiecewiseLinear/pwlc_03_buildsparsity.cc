@@ -19,12 +19,12 @@ BuildSparsityPattern(std::vector<int64_t> &nodal_nnz_in_diag,
   std::vector<int> locI_block_addr(chi_mpi.process_count, 0);
   MPI_Allgather(&local_block_address, 1, MPI_INT,
                 locI_block_addr.data()   , 1, MPI_INT,
-                MPI_COMM_WORLD);
+                chi_mpi.comm);
 
   if (chi_mpi.location_id == 0)
     for (auto locI : locI_block_addr)
       chi_log.Log(LOG_ALLVERBOSE_1) << "Block address = " << locI;
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //**************************************** DEFINE UTILITIES
 
@@ -220,7 +220,7 @@ BuildSparsityPattern(std::vector<int64_t> &nodal_nnz_in_diag,
 
   MPI_Alltoall(sendcount.data(), 1, MPI_INT,
                recvcount.data(), 1, MPI_INT,
-               MPI_COMM_WORLD);
+               chi_mpi.comm);
 
   //=================================== Step 3
   // We now establish send displacements and
@@ -267,7 +267,7 @@ BuildSparsityPattern(std::vector<int64_t> &nodal_nnz_in_diag,
                 recvcount.data(),
                 recv_displs.data(),
                 MPI_INT,
-                MPI_COMM_WORLD);
+                chi_mpi.comm);
 
   //======================================== Deserialze data
   chi_log.Log(LOG_0VERBOSE_1) << "Deserialize data.";
@@ -310,7 +310,7 @@ BuildSparsityPattern(std::vector<int64_t> &nodal_nnz_in_diag,
     }
   }
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //======================================== Spacing according to unknown
   //                                         manager
@@ -27,7 +27,72 @@ namespace finite_element
   }
 
   //#############################################
-  /**Storage structure for unit integrals.*/
+  /**Read-only view of a contiguous row of values.*/
+  template<typename T>
+  class ConstRowView
+  {
+  private:
+    const T* m_data;
+    size_t   m_size;
+
+  public:
+    ConstRowView(const T* data, size_t size) : m_data(data), m_size(size) {}
+
+    const T& operator[](size_t j) const {return m_data[j];}
+    size_t   size()               const {return m_size;}
+    const T* data()               const {return m_data;}
+    const T* begin()              const {return m_data;}
+    const T* end()                const {return m_data + m_size;}
+  };
+
+  //#############################################
+  /**Read-only view of a dense row-major matrix, or of a set of matrices
+   * stacked one after the other (with an extra leading index).*/
+  template<typename T>
+  class ConstMatrixView
+  {
+  private:
+    const T* m_data;
+    size_t   m_num_rows;
+    size_t   m_num_cols;
+
+  public:
+    ConstMatrixView(const T* data, size_t num_rows, size_t num_cols) :
+      m_data(data), m_num_rows(num_rows), m_num_cols(num_cols) {}
+
+    ConstRowView<T> operator[](size_t i) const
+    {return {m_data + i*m_num_cols, m_num_cols};}
+    size_t   size()  const {return m_num_rows;}
+    const T* data()  const {return m_data;}
+  };
+
+  //#############################################
+  /**Read-only view of one dense row-major matrix per face, stored one
+   * after the other.*/
+  template<typename T>
+  class ConstFaceMatricesView
+  {
+  private:
+    const T* m_data;
+    size_t   m_num_faces;
+    size_t   m_num_nodes;
+
+  public:
+    ConstFaceMatricesView(const T* data, size_t num_faces, size_t num_nodes) :
+      m_data(data), m_num_faces(num_faces), m_num_nodes(num_nodes) {}
+
+    ConstMatrixView<T> operator[](size_t f) const
+    {return {m_data + f*m_num_nodes*m_num_nodes, m_num_nodes, m_num_nodes};}
+    size_t size() const {return m_num_faces;}
+  };
+
+  //#############################################
+  /**Storage structure for unit integrals. The integrals of a cell are
+   * stored flat in two contiguous arrays, one for the scalar integrals and
+   * one for the vector integrals, as dense row-major blocks. The surface
+   * integrals are stored per face, each face having a full
+   * num_nodes-by-num_nodes block (or num_nodes row). The matrices can be
+   * obtained as views, which index the flat storage with unit stride.*/
   class UnitIntegralData
   {
   public:
@@ -37,18 +102,30 @@ namespace finite_element
     typedef std::vector<VecVec3> MatVec3;
 
   private:
-    MatDbl   m_IntV_gradShapeI_gradShapeJ;
-    MatVec3  m_IntV_shapeI_gradshapeJ    ;
-    MatDbl   m_IntV_shapeI_shapeJ        ;
-    VecDbl   m_IntV_shapeI               ;
-    VecVec3  m_IntV_gradshapeI           ;
-
-    std::vector<MatDbl>  m_IntS_shapeI_shapeJ    ;
-    std::vector<VecDbl>  m_IntS_shapeI           ;
-    std::vector<MatVec3> m_IntS_shapeI_gradshapeJ;
+    VecDbl   m_dbl_data;  ///< Flat scalar integrals
+    VecVec3  m_vec3_data; ///< Flat vector integrals
 
-    std::vector<std::vector<int>> m_face_dof_mappings;
+    std::vector<int>    m_face_dof_mappings;        ///< Flat, face then fi
+    std::vector<size_t> m_face_dof_mapping_offsets; ///< Per face, plus end
     size_t m_num_nodes=0;
+    size_t m_num_faces=0;
+
+    //Offsets of the blocks in the flat arrays
+    size_t DblOffsetIntV_gradShapeI_gradShapeJ() const {return 0;}
+    size_t DblOffsetIntV_shapeI_shapeJ() const
+    {return m_num_nodes*m_num_nodes;}
+    size_t DblOffsetIntV_shapeI() const
+    {return 2*m_num_nodes*m_num_nodes;}
+    size_t DblOffsetIntS_shapeI_shapeJ() const
+    {return 2*m_num_nodes*m_num_nodes + m_num_nodes;}
+    size_t DblOffsetIntS_shapeI() const
+    {return (2 + m_num_faces)*m_num_nodes*m_num_nodes + m_num_nodes;}
+
+    size_t Vec3OffsetIntV_shapeI_gradshapeJ() const {return 0;}
+    size_t Vec3OffsetIntV_gradshapeI() const
+    {return m_num_nodes*m_num_nodes;}
+    size_t Vec3OffsetIntS_shapeI_gradshapeJ() const
+    {return m_num_nodes*m_num_nodes + m_num_nodes;}
 
   public:
     void Initialize(MatDbl   in_IntV_gradShapeI_gradShapeJ,
@@ -63,42 +140,82 @@ namespace finite_element
                     size_t in_num_nodes);
 
     void Reset();
+    size_t MemoryUsage() const;
 
     double IntV_gradShapeI_gradShapeJ(unsigned int i,
-                                      unsigned int j) const;
+                                      unsigned int j) const
+    {return m_dbl_data[DblOffsetIntV_gradShapeI_gradShapeJ() +
+                       i*m_num_nodes + j];}
     chi_mesh::Vector3 IntV_shapeI_gradshapeJ(unsigned int i,
-                                             unsigned int j) const;
+                                             unsigned int j) const
+    {return m_vec3_data[Vec3OffsetIntV_shapeI_gradshapeJ() +
+                        i*m_num_nodes + j];}
     double IntV_shapeI_shapeJ(unsigned int i,
-                              unsigned int j) const;
-    double IntV_shapeI(unsigned int i) const;
-    chi_mesh::Vector3 IntV_gradshapeI(unsigned int i) const;
+                              unsigned int j) const
+    {return m_dbl_data[DblOffsetIntV_shapeI_shapeJ() + i*m_num_nodes + j];}
+    double IntV_shapeI(unsigned int i) const
+    {return m_dbl_data[DblOffsetIntV_shapeI() + i];}
+    chi_mesh::Vector3 IntV_gradshapeI(unsigned int i) const
+    {return m_vec3_data[Vec3OffsetIntV_gradshapeI() + i];}
 
-    double IntS_shapeI_shapeJ(unsigned int face, unsigned int i, unsigned int j) const;
+    double IntS_shapeI_shapeJ(unsigned int face, unsigned int i, unsigned int j) const
+    {return m_dbl_data[DblOffsetIntS_shapeI_shapeJ() +
+                       (face*m_num_nodes + i)*m_num_nodes + j];}
 
-    double IntS_shapeI(unsigned int face, unsigned int i) const;
+    double IntS_shapeI(unsigned int face, unsigned int i) const
+    {return m_dbl_data[DblOffsetIntS_shapeI() + face*m_num_nodes + i];}
 
     chi_mesh::Vector3 IntS_shapeI_gradshapeJ(unsigned int face,
                                              unsigned int i,
-                                             unsigned int j) const;
+                                             unsigned int j) const
+    {return m_vec3_data[Vec3OffsetIntS_shapeI_gradshapeJ() +
+                        (face*m_num_nodes + i)*m_num_nodes + j];}
+
     int FaceDofMapping(size_t face, size_t face_node_index) const
     {
-      auto& face_data = m_face_dof_mappings.at(face);
-      return face_data.at(face_node_index);
+      return m_face_dof_mappings[m_face_dof_mapping_offsets[face] +
+                                 face_node_index];
     }
     size_t NumNodes() const
     {
       return m_num_nodes;
     }
+    size_t NumFaces() const
+    {
+      return m_num_faces;
+    }
 
-    const MatDbl  & GetIntV_gradShapeI_gradShapeJ() const {return m_IntV_gradShapeI_gradShapeJ;}
-    const MatVec3 & GetIntV_shapeI_gradshapeJ()     const {return m_IntV_shapeI_gradshapeJ    ;}
-    const MatDbl  & GetIntV_shapeI_shapeJ()         const {return m_IntV_shapeI_shapeJ        ;}
-    const VecDbl  & GetIntV_shapeI()                const {return m_IntV_shapeI               ;}
-    const VecVec3 & GetIntV_gradshapeI()            const {return m_IntV_gradshapeI           ;}
+    ConstMatrixView<double>
+      GetIntV_gradShapeI_gradShapeJ() const
+    {return {m_dbl_data.data() + DblOffsetIntV_gradShapeI_gradShapeJ(),
+             m_num_nodes, m_num_nodes};}
+    ConstMatrixView<chi_mesh::Vector3>
+      GetIntV_shapeI_gradshapeJ() const
+    {return {m_vec3_data.data() + Vec3OffsetIntV_shapeI_gradshapeJ(),
+             m_num_nodes, m_num_nodes};}
+    ConstMatrixView<double>
+      GetIntV_shapeI_shapeJ() const
+    {return {m_dbl_data.data() + DblOffsetIntV_shapeI_shapeJ(),
+             m_num_nodes, m_num_nodes};}
+    ConstRowView<double>
+      GetIntV_shapeI() const
+    {return {m_dbl_data.data() + DblOffsetIntV_shapeI(), m_num_nodes};}
+    ConstRowView<chi_mesh::Vector3>
+      GetIntV_gradshapeI() const
+    {return {m_vec3_data.data() + Vec3OffsetIntV_gradshapeI(), m_num_nodes};}
 
-    const std::vector<MatDbl>&  GetIntS_shapeI_shapeJ()    const  {return m_IntS_shapeI_shapeJ    ;}
-    const std::vector<VecDbl>&  GetIntS_shapeI()           const  {return m_IntS_shapeI           ;}
-    const std::vector<MatVec3>& GetIntS_shapeI_gradshapeJ()const  {return m_IntS_shapeI_gradshapeJ;}
+    ConstFaceMatricesView<double>
+      GetIntS_shapeI_shapeJ() const
+    {return {m_dbl_data.data() + DblOffsetIntS_shapeI_shapeJ(),
+             m_num_faces, m_num_nodes};}
+    ConstMatrixView<double>
+      GetIntS_shapeI() const
+    {return {m_dbl_data.data() + DblOffsetIntS_shapeI(),
+             m_num_faces, m_num_nodes};}
+    ConstFaceMatricesView<chi_mesh::Vector3>
+      GetIntS_shapeI_gradshapeJ() const
+    {return {m_vec3_data.data() + Vec3OffsetIntS_shapeI_gradshapeJ(),
+             m_num_faces, m_num_nodes};}
   };
 
   //#############################################
@@ -4,6 +4,9 @@ namespace chi_math
 {
 namespace finite_element
 {
+  //###################################################################
+  /**Copies the nested integral matrices into the flat storage. Missing
+   * entries, e.g. of faces for which a row was not computed, are zero.*/
   void UnitIntegralData::Initialize(
     MatDbl in_IntV_gradShapeI_gradShapeJ,
     MatVec3 in_IntV_shapeI_gradshapeJ,
@@ -16,104 +19,93 @@ namespace finite_element
     std::vector<std::vector<int>> in_face_dof_mappings,
     size_t in_num_nodes)
   {
-    m_IntV_gradShapeI_gradShapeJ = std::move(in_IntV_gradShapeI_gradShapeJ);
-    m_IntV_shapeI_gradshapeJ     = std::move(in_IntV_shapeI_gradshapeJ    );
-    m_IntV_shapeI_shapeJ         = std::move(in_IntV_shapeI_shapeJ        );
-    m_IntV_shapeI                = std::move(in_IntV_shapeI               );
-    m_IntV_gradshapeI            = std::move(in_IntV_gradshapeI           );
-    m_IntS_shapeI_shapeJ         = std::move(in_IntS_shapeI_shapeJ    );
-    m_IntS_shapeI                = std::move(in_IntS_shapeI           );
-    m_IntS_shapeI_gradshapeJ     = std::move(in_IntS_shapeI_gradshapeJ);
-    m_face_dof_mappings          = std::move(in_face_dof_mappings);
-    m_num_nodes                  = in_num_nodes;
-  }
+    const size_t n = in_num_nodes;
+    m_num_nodes = n;
+    m_num_faces = in_face_dof_mappings.size();
 
-  void UnitIntegralData::Reset()
-  {
-    m_IntV_gradShapeI_gradShapeJ.clear();
-    m_IntV_shapeI_gradshapeJ.clear();
-    m_IntV_shapeI_shapeJ.clear();
-    m_IntV_shapeI.clear();
-    m_IntV_gradshapeI.clear();
+    m_dbl_data.assign(DblOffsetIntS_shapeI() + m_num_faces*n, 0.0);
+    m_vec3_data.assign(Vec3OffsetIntS_shapeI_gradshapeJ() + m_num_faces*n*n,
+                       chi_mesh::Vector3());
 
-    m_IntS_shapeI_shapeJ.clear();
-    m_IntS_shapeI.clear();
-    m_IntS_shapeI_gradshapeJ.clear();
+    //============================================= Copy helpers
+    auto CopyMatrix = [n](const auto& in_matrix, auto* out_block)
+    {
+      for (size_t i=0; i<std::min(n, in_matrix.size()); ++i)
+        for (size_t j=0; j<std::min(n, in_matrix[i].size()); ++j)
+          out_block[i*n + j] = in_matrix[i][j];
+    };
+    auto CopyVector = [n](const auto& in_vector, auto* out_row)
+    {
+      for (size_t i=0; i<std::min(n, in_vector.size()); ++i)
+        out_row[i] = in_vector[i];
+    };
 
+    //============================================= Volume integrals
+    CopyMatrix(in_IntV_gradShapeI_gradShapeJ,
+               &m_dbl_data[DblOffsetIntV_gradShapeI_gradShapeJ()]);
+    CopyMatrix(in_IntV_shapeI_shapeJ,
+               &m_dbl_data[DblOffsetIntV_shapeI_shapeJ()]);
+    CopyVector(in_IntV_shapeI,
+               &m_dbl_data[DblOffsetIntV_shapeI()]);
+    CopyMatrix(in_IntV_shapeI_gradshapeJ,
+               &m_vec3_data[Vec3OffsetIntV_shapeI_gradshapeJ()]);
+    CopyVector(in_IntV_gradshapeI,
+               &m_vec3_data[Vec3OffsetIntV_gradshapeI()]);
+
+    //============================================= Surface integrals
+    for (size_t f=0; f<m_num_faces; ++f)
+    {
+      if (f < in_IntS_shapeI_shapeJ.size())
+        CopyMatrix(in_IntS_shapeI_shapeJ[f],
+                   &m_dbl_data[DblOffsetIntS_shapeI_shapeJ() + f*n*n]);
+      if (f < in_IntS_shapeI.size())
+        CopyVector(in_IntS_shapeI[f],
+                   &m_dbl_data[DblOffsetIntS_shapeI() + f*n]);
+      if (f < in_IntS_shapeI_gradshapeJ.size())
+        CopyMatrix(in_IntS_shapeI_gradshapeJ[f],
+                   &m_vec3_data[Vec3OffsetIntS_shapeI_gradshapeJ() + f*n*n]);
+    }
+
+    //============================================= Face dof mappings
     m_face_dof_mappings.clear();
-    m_num_nodes=0;
-  }
+    m_face_dof_mapping_offsets.clear();
+    m_face_dof_mapping_offsets.reserve(m_num_faces + 1);
+    for (const auto& face_mapping : in_face_dof_mappings)
+    {
+      m_face_dof_mapping_offsets.push_back(m_face_dof_mappings.size());
+      for (int i : face_mapping)
+        m_face_dof_mappings.push_back(i);
+    }
+    m_face_dof_mapping_offsets.push_back(m_face_dof_mappings.size());
 
-  double UnitIntegralData::
-    IntV_gradShapeI_gradShapeJ(unsigned int i,
-                               unsigned int j) const
-  {
-    double value;
-    auto& row_I = m_IntV_gradShapeI_gradShapeJ.at(i);
-    value = row_I.at(j);
-    return value;
-  }
-  chi_mesh::Vector3 UnitIntegralData::
-    IntV_shapeI_gradshapeJ(unsigned int i,
-                           unsigned int j) const
-  {
-    chi_mesh::Vector3 value;
-    auto & row_I = m_IntV_shapeI_gradshapeJ.at(i);
-    value = row_I.at(j);
-    return value;
-  }
-  double UnitIntegralData::
-    IntV_shapeI_shapeJ(unsigned int i,
-                       unsigned int j) const
-  {
-    double value;
-    auto& row_I = m_IntV_shapeI_shapeJ.at(i);
-    value = row_I.at(j);
-    return value;
-  }
-  double UnitIntegralData::
-    IntV_shapeI(unsigned int i) const
-  {
-    double value = m_IntV_shapeI.at(i);
-    return value;
-  }
-  chi_mesh::Vector3 UnitIntegralData::
-    IntV_gradshapeI(unsigned int i) const
-  {
-    chi_mesh::Vector3 value;
-    value = m_IntV_gradshapeI.at(i);
-    return value;
-  }
-  double UnitIntegralData::
-    IntS_shapeI_shapeJ(unsigned int face, unsigned int i, unsigned int j) const
-  {
-    double value;
-    auto& face_data = m_IntS_shapeI_shapeJ.at(face);
-    auto& rowI      = face_data.at(i);
-    value = rowI.at(j);
-    return value;
+    m_dbl_data.shrink_to_fit();
+    m_vec3_data.shrink_to_fit();
+    m_face_dof_mappings.shrink_to_fit();
   }
 
-  double UnitIntegralData::
-    IntS_shapeI(unsigned int face, unsigned int i) const
+  //###################################################################
+  /**Clears the integrals.*/
+  void UnitIntegralData::Reset()
   {
-    double value;
-    auto& face_data = m_IntS_shapeI.at(face);
-    value = face_data.at(i);
-    return value;
+    m_dbl_data.clear();
+    m_vec3_data.clear();
+
+    m_face_dof_mappings.clear();
+    m_face_dof_mapping_offsets.clear();
+    m_num_nodes=0;
+    m_num_faces=0;
   }
 
-  chi_mesh::Vector3 UnitIntegralData::
-    IntS_shapeI_gradshapeJ(unsigned int face,
-                           unsigned int i,
-                           unsigned int j) const
+  //###################################################################
+  /**Returns the number of bytes allocated for the integrals and the face
+   * dof mappings.*/
+  size_t UnitIntegralData::MemoryUsage() const
   {
-    chi_mesh::Vector3 value;
-    auto& face_data = m_IntS_shapeI_gradshapeJ.at(face);
-    auto& rowI      = face_data.at(i);
-    value = rowI.at(j);
-    return value;
+    return sizeof(UnitIntegralData) +
+           m_dbl_data.capacity()*sizeof(double) +
+           m_vec3_data.capacity()*sizeof(chi_mesh::Vector3) +
+           m_face_dof_mappings.capacity()*sizeof(int) +
+           m_face_dof_mapping_offsets.capacity()*sizeof(size_t);
   }
 }
 }
-
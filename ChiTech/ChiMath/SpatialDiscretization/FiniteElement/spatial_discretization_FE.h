@@ -16,6 +16,7 @@ protected:
   typedef chi_math::finite_element::FaceQuadraturePointData QPDataFace;
 
   std::vector<UIData>                  fe_unit_integrals;
+  std::vector<size_t>                  fe_unit_integrals_index; ///< Per local cell
   std::vector<QPDataVol>               fe_vol_qp_data;
   std::vector<std::vector<QPDataFace>> fe_srf_qp_data;
 
@@ -46,7 +47,7 @@ public:
       throw std::invalid_argument("SpatialDiscretization_FE::GetUnitIntegrals "
                                   "called without integrals being initialized."
                                   " Set flag COMPUTE_UNIT_INTEGRALS.");
-    return fe_unit_integrals[cell.local_id];
+    return fe_unit_integrals[fe_unit_integrals_index[cell.local_id]];
   }
 
   virtual
@@ -0,0 +1,169 @@
+#ifndef CHI_MATH_FE_UNIT_INTEGRALS_CACHE_H
+#define CHI_MATH_FE_UNIT_INTEGRALS_CACHE_H
+
+#include "ChiMath/SpatialDiscretization/FiniteElement/finite_element.h"
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+namespace chi_math
+{
+
+namespace finite_element
+{
+  //#############################################
+  /**Scan-resistant cache of unit integrals, bounded by a memory budget.
+   * Entries are identified by a key, e.g. a cell or unit integral record
+   * index, and computed on a miss by the function supplied to Get.
+   *
+   * Sweeps visit every cell once per angle set, in the same order each
+   * time. Under such a cyclic access pattern a least-recently-used cache
+   * that is smaller than the data evicts every entry before it is reused
+   * and never hits. This cache therefore admits entries into a resident
+   * set, which is never evicted, until the resident set uses
+   * (WINDOW_DIVISOR-1)/WINDOW_DIVISOR of the budget. The remaining entries
+   * go into a least-recently-used window with the rest of the budget,
+   * which serves repeated accesses to a cell and its neighbors. With a
+   * budget holding a fraction f of the entries, about a fraction
+   * f*(WINDOW_DIVISOR-1)/WINDOW_DIVISOR of the accesses of each sweep
+   * hit.
+   *
+   * Get returns a shared pointer to the entry's integrals, which pins
+   * them: an entry that is evicted while a caller still holds its pointer
+   * is only released once the caller drops the pointer. Callers can
+   * therefore hold the integrals of any number of cells at the same time,
+   * e.g. those of a cell and of all of its neighbors, regardless of the
+   * budget. Evicted entries no longer count towards MemoryInUse.
+   *
+   * The cache is not thread safe.*/
+  class UnitIntegralsCache
+  {
+  public:
+    typedef std::shared_ptr<const UnitIntegralData> DataPtr;
+
+    static constexpr size_t MIN_ENTRIES    = 1; ///< Of the window
+    static constexpr size_t WINDOW_DIVISOR = 8;
+
+    struct Statistics
+    {
+      uint64_t hits      = 0;
+      uint64_t misses    = 0;
+      uint64_t evictions = 0;
+    };
+
+  private:
+    typedef std::pair<size_t, DataPtr> Entry;
+    typedef std::list<Entry> EntryList;
+
+    std::unordered_map<size_t, DataPtr> resident; ///< Never evicted
+
+    EntryList window; ///< Most recently used first
+    std::unordered_map<size_t, EntryList::iterator> key_to_window_entry;
+
+    size_t memory_budget   = 0; ///< In bytes
+    size_t resident_memory = 0; ///< In bytes
+    size_t window_memory   = 0; ///< In bytes
+
+    Statistics statistics;
+
+  public:
+    /**Sets the memory budget in bytes. Window entries exceeding the
+     * budget are evicted. If the resident set exceeds its share of the
+     * new budget, it is cleared.*/
+    void SetMemoryBudget(size_t budget)
+    {
+      memory_budget = budget;
+      if (resident_memory > ResidentBudget())
+      {
+        statistics.evictions += resident.size();
+        resident.clear();
+        resident_memory = 0;
+      }
+      EvictToBudget();
+    }
+
+    /**Returns a pointer to the unit integrals of the given key, computing
+     * them with compute(UnitIntegralData&) if they are not cached. The
+     * integrals remain valid as long as the pointer is held.*/
+    template<typename Compute>
+    DataPtr Get(size_t key, const Compute& compute)
+    {
+      auto resident_entry = resident.find(key);
+      if (resident_entry != resident.end())
+      {
+        ++statistics.hits;
+        return resident_entry->second;
+      }
+
+      auto location = key_to_window_entry.find(key);
+      if (location != key_to_window_entry.end())
+      {
+        ++statistics.hits;
+        window.splice(window.begin(), window, location->second);
+        return location->second->second;
+      }
+
+      ++statistics.misses;
+      auto ui_data = std::make_shared<UnitIntegralData>();
+      compute(*ui_data);
+      const size_t memory = ui_data->MemoryUsage();
+
+      //======================================== Admit to resident set
+      if (resident_memory + memory <= ResidentBudget())
+      {
+        resident.insert(std::make_pair(key, ui_data));
+        resident_memory += memory;
+        return ui_data;
+      }
+
+      //======================================== Admit to window
+      window.emplace_front(key, ui_data);
+      key_to_window_entry[key] = window.begin();
+      window_memory += memory;
+      EvictToBudget();
+
+      return ui_data;
+    }
+
+    /**Removes all entries. Pinned integrals remain valid until released.
+     * The statistics are kept.*/
+    void Clear()
+    {
+      resident.clear();
+      window.clear();
+      key_to_window_entry.clear();
+      resident_memory = 0;
+      window_memory   = 0;
+    }
+
+    size_t NumEntries() const {return resident.size() + window.size();}
+    size_t NumResidentEntries() const {return resident.size();}
+    size_t MemoryInUse() const {return resident_memory + window_memory;}
+    size_t MemoryBudget() const {return memory_budget;}
+    const Statistics& GetStatistics() const {return statistics;}
+
+  private:
+    size_t ResidentBudget() const
+    {return memory_budget - memory_budget/WINDOW_DIVISOR;}
+
+    /**Evicts least recently used window entries until the budget is met
+     * or only MIN_ENTRIES window entries remain.*/
+    void EvictToBudget()
+    {
+      while (resident_memory + window_memory > memory_budget and
+             window.size() > MIN_ENTRIES)
+      {
+        const auto& lru_entry = window.back();
+        window_memory -= lru_entry.second->MemoryUsage();
+        key_to_window_entry.erase(lru_entry.first);
+        window.pop_back();
+        ++statistics.evictions;
+      }
+    }
+  };
+}
+
+}
+
+#endif
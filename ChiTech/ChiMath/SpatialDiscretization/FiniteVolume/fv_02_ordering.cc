@@ -24,7 +24,7 @@ void SpatialDiscretization_FV::
              1,MPI_INT,              //Count and type
              chi_mpi.location_id-1,  //Source
              111,                    //Tag
-             MPI_COMM_WORLD,MPI_STATUS_IGNORE);
+             chi_mpi.comm,MPI_STATUS_IGNORE);
   }
 
   if (chi_mpi.location_id != (chi_mpi.process_count-1))
@@ -34,7 +34,7 @@ void SpatialDiscretization_FV::
              1,MPI_INT,
              chi_mpi.location_id+1,
              111,
-             MPI_COMM_WORLD);
+             chi_mpi.comm);
   }
 
   //======================================== Collect block addresses
@@ -46,7 +46,7 @@ void SpatialDiscretization_FV::
                 locJ_block_address.data(), //recv buf
                 1,                            //recv count
                 MPI_INT,                      //recv type
-                MPI_COMM_WORLD);              //communicator
+                chi_mpi.comm);              //communicator
 
   //======================================== Collect block sizes
   locJ_block_size.clear();
@@ -58,7 +58,7 @@ void SpatialDiscretization_FV::
                 locJ_block_size.data(),    //recv buf
                 1,                            //recv count
                 MPI_INT,                      //recv type
-                MPI_COMM_WORLD);              //communicator
+                chi_mpi.comm);              //communicator
 
   chi_log.Log(LOG_ALLVERBOSE_2)
     << "Local dof count, start "
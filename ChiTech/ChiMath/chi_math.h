@@ -28,6 +28,9 @@ public:
 	std::vector<std::shared_ptr<chi_math::AngularQuadrature>> angular_quadratures;
 
   static chi_math::UnknownManager UNITARY_UNKNOWN_MANAGER;
+
+  unsigned int num_setup_threads = 1; ///< Threads for discretization setup
+  double unit_integrals_cache_mb = 0.0; ///< PWLD unit integrals cache, 0=off
 private:
   static ChiMath instance;
 private:
@@ -95,6 +98,8 @@ namespace chi_math
                     const size_t c,
                     const MatDbl& A );
   void   GaussElimination(MatDbl& A, VecDbl& b, int n);
+  void   GaussEliminationMultiRHS(MatDbl& A, VecDbl* B,
+                                  size_t num_rhs, int n);
   MatDbl InverseGEPivoting(const MatDbl& A);
   MatDbl Inverse(const MatDbl& A);
 
@@ -304,6 +304,45 @@ void chi_math::GaussElimination(MatDbl &A,
 	}
 }
 
+//######################################################### Gauss Elimination
+/** Gauss Elimination without pivoting for multiple right-hand sides.
+ * B points to num_rhs consecutive right-hand side vectors that are all
+ * overwritten with their solutions. The elimination of A is only
+ * performed once.*/
+void chi_math::GaussEliminationMultiRHS(MatDbl &A, VecDbl *B,
+                                        size_t num_rhs, int n)
+{
+	// Forward elimination
+	for(int i = 0;i < n-1;++i)
+	{
+		const std::vector<double>& ai = A[i];
+		double factor = 1.0/A[i][i];
+		for(int j = i+1;j < n;++j)
+		{
+			std::vector<double>& aj = A[j];
+			double val = aj[i] * factor;
+			for(size_t r = 0;r < num_rhs;++r)
+				B[r][j] -= val * B[r][i];
+			for(int k = i+1;k < n;++k)
+				aj[k] -= val * ai[k];
+		}
+	}
+
+	// Back substitution
+	for(int i = n-1;i >= 0;--i)
+	{
+		const std::vector<double>& ai = A[i];
+		for(size_t r = 0;r < num_rhs;++r)
+		{
+			VecDbl& b = B[r];
+			double bi = b[i];
+			for(int j = i+1;j < n;++j)
+				bi -= ai[j] * b[j];
+			b[i] = bi/ai[i];
+		}
+	}
+}
+
 //#########################################################
 /** Computes the inverse of a matrix using Gauss-Elimination with pivoting.*/
 MatDbl chi_math::InverseGEPivoting(const MatDbl &A)
@@ -0,0 +1,63 @@
+#ifndef CHI_MATH_THREADS_H
+#define CHI_MATH_THREADS_H
+
+#include <thread>
+#include <vector>
+#include <exception>
+
+namespace chi_math
+{
+  //###################################################################
+  /**Calls function(i) for each i in [0,n) using up to num_threads
+   * threads, the calling thread included. The range is split into
+   * contiguous chunks, one per thread, such that each index is processed
+   * exactly once. The results are therefore independent of the number of
+   * threads, provided that each call only writes data owned by its index.
+   * An exception thrown by any of the calls is rethrown on the calling
+   * thread once all threads have joined.*/
+  template<typename Function>
+  void ParallelFor(size_t n, unsigned int num_threads,
+                   const Function& function)
+  {
+    if (num_threads == 0) num_threads = 1;
+    if (num_threads > n) num_threads = static_cast<unsigned int>(n);
+
+    if (num_threads <= 1)
+    {
+      for (size_t i=0; i<n; ++i)
+        function(i);
+      return;
+    }
+
+    std::vector<std::exception_ptr> exceptions(num_threads, nullptr);
+    auto RunChunk = [n, num_threads, &function, &exceptions](unsigned int t)
+    {
+      const size_t begin = (n*t)/num_threads;
+      const size_t end   = (n*(t+1))/num_threads;
+      try
+      {
+        for (size_t i=begin; i<end; ++i)
+          function(i);
+      }
+      catch (...)
+      {
+        exceptions[t] = std::current_exception();
+      }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads - 1);
+    for (unsigned int t=1; t<num_threads; ++t)
+      threads.emplace_back(RunChunk, t);
+
+    RunChunk(0);
+
+    for (auto& thread : threads)
+      thread.join();
+
+    for (const auto& exception : exceptions)
+      if (exception) std::rethrow_exception(exception);
+  }
+}
+
+#endif
@@ -16,8 +16,8 @@ private:
   std::vector<chi_mesh::Cell*> native_cells;  ///< Actual native cells
   std::vector<chi_mesh::Cell*> foreign_cells; ///< Locally stored ghosts
 
-  std::map<uint64_t,uint64_t> global_cell_id_to_native_id_map;
-  std::map<uint64_t,uint64_t> global_cell_id_to_foreign_id_map;
+  GlobalIDIndexMap global_cell_id_to_native_id_map;
+  GlobalIDIndexMap global_cell_id_to_foreign_id_map;
 
 
 public:
@@ -17,7 +17,7 @@ extern ChiMPI& chi_mpi;
 void chi_mesh::MeshContinuum::CommunicatePartitionNeighborCells(
   std::map<uint64_t, chi_mesh::Cell*>& neighbor_cells)
 {
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   std::set<uint64_t> local_neighboring_cell_indices;
   std::set<int> neighboring_partitions;
@@ -166,7 +166,7 @@ void chi_mesh::MeshContinuum::CommunicatePartitionNeighborCells(
   std::vector<int> recv_counts(chi_mpi.process_count,0);
 
   MPI_Alltoall(send_counts.data(), 1, MPI_INT,
-               recv_counts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+               recv_counts.data(), 1, MPI_INT, chi_mpi.comm);
 
   //============================================= Build receive displacements
   std::vector<int> recv_displs(chi_mpi.process_count,0);
@@ -189,7 +189,7 @@ void chi_mesh::MeshContinuum::CommunicatePartitionNeighborCells(
                 recv_counts.data(),
                 recv_displs.data(),
                 MPI_INT,
-                MPI_COMM_WORLD);
+                chi_mpi.comm);
 
   //============================================= Deserialize
   {
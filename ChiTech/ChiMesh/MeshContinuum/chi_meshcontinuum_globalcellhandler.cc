@@ -19,15 +19,15 @@ void chi_mesh::GlobalCellHandler::
 
     native_cells.push_back(new_cell);
 
-    global_cell_id_to_native_id_map.insert(std::make_pair(
-      new_cell->global_id, native_cells.size()-1));
+    global_cell_id_to_native_id_map.Insert(new_cell->global_id,
+                                           native_cells.size()-1);
   }
   else
   {
     foreign_cells.push_back(new_cell);
 
-    global_cell_id_to_foreign_id_map.insert(std::make_pair(
-      new_cell->global_id, foreign_cells.size() - 1));
+    global_cell_id_to_foreign_id_map.Insert(new_cell->global_id,
+                                            foreign_cells.size() - 1);
   }
 
 }
@@ -37,15 +37,17 @@ void chi_mesh::GlobalCellHandler::
 chi_mesh::Cell& chi_mesh::GlobalCellHandler::
   operator[](uint64_t cell_global_index)
 {
-  auto native_location = global_cell_id_to_native_id_map.find(cell_global_index);
+  const auto NOT_FOUND = GlobalIDIndexMap::NOT_FOUND;
 
-  if (native_location != global_cell_id_to_native_id_map.end())
-    return *native_cells[native_location->second];
+  auto native_location = global_cell_id_to_native_id_map.Find(cell_global_index);
+
+  if (native_location != NOT_FOUND)
+    return *native_cells[native_location];
   else
   {
-    auto foreign_location = global_cell_id_to_foreign_id_map.find(cell_global_index);
-    if (foreign_location != global_cell_id_to_foreign_id_map.end())
-      return *foreign_cells[foreign_location->second];
+    auto foreign_location = global_cell_id_to_foreign_id_map.Find(cell_global_index);
+    if (foreign_location != NOT_FOUND)
+      return *foreign_cells[foreign_location];
   }
 
   std::stringstream ostr;
@@ -68,7 +70,7 @@ size_t chi_mesh::MeshContinuum::GetGlobalNumberOfCells()
                 1,
                 MPI_UNSIGNED_LONG_LONG,
                 MPI_SUM,
-                MPI_COMM_WORLD);
+                chi_mpi.comm);
 
   return num_globl_cells;
 }
@@ -97,10 +99,10 @@ std::vector<uint64_t> chi_mesh::GlobalCellHandler::
 uint64_t chi_mesh::GlobalCellHandler::
   GetGhostLocalID(int cell_global_index)
 {
-  auto foreign_location = global_cell_id_to_foreign_id_map.find(cell_global_index);
+  auto foreign_location = global_cell_id_to_foreign_id_map.Find(cell_global_index);
 
-  if (foreign_location != global_cell_id_to_foreign_id_map.end())
-    return foreign_location->second;
+  if (foreign_location != GlobalIDIndexMap::NOT_FOUND)
+    return foreign_location;
 
   std::stringstream ostr;
   ostr << "Grid GetGhostLocalID failed to find cell " << cell_global_index;
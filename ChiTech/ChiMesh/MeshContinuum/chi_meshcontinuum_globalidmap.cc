@@ -0,0 +1,93 @@
+#include "chi_meshcontinuum_globalidmap.h"
+
+#include <stdexcept>
+
+//###################################################################
+/**Inserts a key-value pair. If the key is already present the existing
+ * value is kept and false is returned, as with std::map::insert.*/
+bool chi_mesh::GlobalIDIndexMap::Insert(uint64_t key, uint64_t value)
+{
+  if (key == EMPTY_KEY)
+    throw std::invalid_argument("GlobalIDIndexMap: Invalid key.");
+
+  if (Contains(key)) return false;
+
+  //=================================== Continue the dense range
+  if (dense)
+  {
+    if (num_entries == 0) dense_first_key = key;
+
+    if (key == dense_first_key + num_entries and value == num_entries)
+    {
+      ++num_entries;
+      return true;
+    }
+
+    SwitchToTable();
+  }
+
+  //=================================== Hash table
+  if (2*(num_entries + 1) > slots.size())
+    Rehash(2*slots.size());
+
+  InsertIntoTable(key, value);
+  ++num_entries;
+  return true;
+}
+
+//###################################################################
+/**Removes all entries and releases the hash table.*/
+void chi_mesh::GlobalIDIndexMap::clear()
+{
+  dense = true;
+  dense_first_key = 0;
+  num_entries = 0;
+  slots.clear();
+  slots.shrink_to_fit();
+  slot_mask = 0;
+}
+
+//###################################################################
+/**Places a key, known to be absent, in the first free slot of its probe
+ * sequence. Does not update the number of entries.*/
+void chi_mesh::GlobalIDIndexMap::InsertIntoTable(uint64_t key, uint64_t value)
+{
+  for (uint64_t s = Hash(key) & slot_mask; ; s = (s + 1) & slot_mask)
+  {
+    auto& slot = slots[s];
+    if (slot.key == EMPTY_KEY)
+    {
+      slot.key   = key;
+      slot.value = value;
+      return;
+    }
+  }
+}
+
+//###################################################################
+/**Resizes the hash table to at least the given number of slots, rounded
+ * up to a power of two, and re-inserts the entries.*/
+void chi_mesh::GlobalIDIndexMap::Rehash(size_t min_num_slots)
+{
+  size_t num_slots = 16;
+  while (num_slots < min_num_slots) num_slots *= 2;
+
+  std::vector<Slot> old_slots(num_slots);
+  old_slots.swap(slots);
+  slot_mask = num_slots - 1;
+
+  for (const auto& slot : old_slots)
+    if (slot.key != EMPTY_KEY)
+      InsertIntoTable(slot.key, slot.value);
+}
+
+//###################################################################
+/**Moves the entries of the dense range into the hash table.*/
+void chi_mesh::GlobalIDIndexMap::SwitchToTable()
+{
+  dense = false;
+  Rehash(2*(num_entries + 1));
+
+  for (uint64_t i=0; i<num_entries; ++i)
+    InsertIntoTable(dense_first_key + i, i);
+}
@@ -0,0 +1,86 @@
+#ifndef CHI_MESHCONTINUUM_GLOBALIDMAP_H_
+#define CHI_MESHCONTINUUM_GLOBALIDMAP_H_
+
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+
+namespace chi_mesh
+{
+
+//##################################################
+/**Maps global cell ids to local storage indices with constant time
+ * lookups.
+ *
+ * As long as the keys are inserted as a contiguous, increasing range with
+ * the values 0,1,2,..., which is the case for the local cells of a serial
+ * mesh and for partitioners that number cells per partition, the map is a
+ * dense range and a lookup is a single range check. The first insertion
+ * breaking this pattern moves the entries into an open addressing hash
+ * table with linear probing, which is kept at most half full.*/
+class GlobalIDIndexMap
+{
+public:
+  static constexpr uint64_t NOT_FOUND = std::numeric_limits<uint64_t>::max();
+
+private:
+  static constexpr uint64_t EMPTY_KEY = std::numeric_limits<uint64_t>::max();
+
+  struct Slot
+  {
+    uint64_t key   = EMPTY_KEY;
+    uint64_t value = 0;
+  };
+
+  bool              dense = true;
+  uint64_t          dense_first_key = 0;
+  size_t            num_entries = 0;
+  std::vector<Slot> slots;          ///< Power of two size
+  uint64_t          slot_mask = 0;
+
+  /**Mixes the bits of a key such that consecutive keys spread over the
+   * table (the splitmix64 finalizer).*/
+  static uint64_t Hash(uint64_t key)
+  {
+    key ^= key >> 30; key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 27; key *= 0x94d049bb133111ebULL;
+    key ^= key >> 31;
+    return key;
+  }
+
+  void InsertIntoTable(uint64_t key, uint64_t value);
+  void Rehash(size_t min_num_slots);
+  void SwitchToTable();
+
+public:
+  bool Insert(uint64_t key, uint64_t value);
+
+  /**Returns the value of the key, or NOT_FOUND.*/
+  uint64_t Find(uint64_t key) const
+  {
+    if (dense)
+    {
+      const uint64_t offset = key - dense_first_key;
+      return (offset < num_entries)? offset : NOT_FOUND;
+    }
+
+    for (uint64_t s = Hash(key) & slot_mask; ; s = (s + 1) & slot_mask)
+    {
+      const auto& slot = slots[s];
+      if (slot.key == key)       return slot.value;
+      if (slot.key == EMPTY_KEY) return NOT_FOUND;
+    }
+  }
+
+  bool Contains(uint64_t key) const {return Find(key) != NOT_FOUND;}
+
+  size_t size() const {return num_entries;}
+  bool   empty() const {return num_entries == 0;}
+
+  void clear();
+};
+
+}//namespace chi_mesh
+
+#endif //CHI_MESHCONTINUUM_GLOBALIDMAP_H_
@@ -166,12 +166,7 @@ size_t chi_mesh::MeshContinuum::GetFaceHistogramBinDOFSize(size_t category)
  * the native index map.*/
 bool chi_mesh::MeshContinuum::IsCellLocal(uint64_t cell_global_index)
 {
-  auto native_index = global_cell_id_to_native_id_map.find(cell_global_index);
-
-  if (native_index != global_cell_id_to_native_id_map.end())
-    return true;
-
-  return false;
+  return global_cell_id_to_native_id_map.Contains(cell_global_index);
 }
 
 
@@ -180,13 +175,10 @@ bool chi_mesh::MeshContinuum::IsCellLocal(uint64_t cell_global_index)
  * found in the native or foreign cell maps.*/
 bool chi_mesh::MeshContinuum::IsCellBndry(uint64_t cell_global_index)
 {
-  auto native_index = global_cell_id_to_native_id_map.find(cell_global_index);
-  auto foreign_index = global_cell_id_to_foreign_id_map.find(cell_global_index);
-
-  auto no_native = global_cell_id_to_native_id_map.end();
-  auto no_foreign = global_cell_id_to_foreign_id_map.end();
+  bool is_native  = global_cell_id_to_native_id_map.Contains(cell_global_index);
+  bool is_foreign = global_cell_id_to_foreign_id_map.Contains(cell_global_index);
 
-  if ( (native_index == no_native) and (foreign_index == no_foreign))
+  if ( (not is_native) and (not is_foreign))
     return true;
 
   return false;
@@ -281,7 +273,7 @@ size_t chi_mesh::MeshContinuum::
                 1,                      //count
                 MPI_UNSIGNED_LONG_LONG, //datatype
                 MPI_SUM,                //op
-                MPI_COMM_WORLD);        //communicator
+                chi_mpi.comm);        //communicator
 
   return global_count;
 }
\ No newline at end of file
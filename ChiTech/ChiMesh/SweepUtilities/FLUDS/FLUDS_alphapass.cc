@@ -8,6 +8,9 @@
 
 extern ChiLog&     chi_log;
 
+#include "chi_mpi.h"
+extern ChiMPI& chi_mpi;
+
 typedef std::vector<std::pair<int,short>> LockBox;
 
 //###################################################################
@@ -66,7 +69,7 @@ InitializeAlphaElements(SPDS_ptr spds)
   }//for csoi
 
   chi_log.Log(LOG_0VERBOSE_2) << "Done with Slot Dynamics.";
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
 
 
@@ -102,7 +105,7 @@ InitializeAlphaElements(SPDS_ptr spds)
   delayed_local_psi_Gn_block_strideG = delayed_local_psi_Gn_block_stride*G;
 
   chi_log.Log(LOG_0VERBOSE_2) << "Done with Local Incidence mapping.";
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //================================================== Clean up
   so_cell_outb_face_slot_indices.shrink_to_fit();
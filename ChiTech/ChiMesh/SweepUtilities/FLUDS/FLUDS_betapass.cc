@@ -50,7 +50,7 @@ InitializeBetaElements(SPDS_ptr spds, int tag_index)
     MPI_Isend(multi_face_indices[deplocI].data(),
               multi_face_indices[deplocI].size(),
               MPI_INT,locJ,101+tag_index,
-              MPI_COMM_WORLD,&send_requests[deplocI]);
+              chi_mpi.comm,&send_requests[deplocI]);
 
     //TODO: Watch eager limits on sent data
 
@@ -68,7 +68,7 @@ InitializeBetaElements(SPDS_ptr spds, int tag_index)
     int locJ = spds->delayed_location_dependencies[prelocI];
 
     MPI_Status probe_status;
-    MPI_Probe(locJ,101+tag_index,MPI_COMM_WORLD,&probe_status);
+    MPI_Probe(locJ,101+tag_index,chi_mpi.comm,&probe_status);
 
     int amount_to_receive=0;
     MPI_Get_count(&probe_status, MPI_INT, &amount_to_receive );
@@ -77,7 +77,7 @@ InitializeBetaElements(SPDS_ptr spds, int tag_index)
     face_indices.resize(amount_to_receive,0);
 
     MPI_Recv(face_indices.data(),amount_to_receive,MPI_INT,
-             locJ,101+tag_index,MPI_COMM_WORLD,MPI_STATUS_IGNORE);
+             locJ,101+tag_index,chi_mpi.comm,MPI_STATUS_IGNORE);
 
     DeSerializeCellInfo(delayed_prelocI_cell_views[prelocI], &face_indices,
                         delayed_prelocI_face_dof_count[prelocI]);
@@ -99,7 +99,7 @@ InitializeBetaElements(SPDS_ptr spds, int tag_index)
     int locJ = spds->location_dependencies[prelocI];
 
     MPI_Status probe_status;
-    MPI_Probe(locJ,101+tag_index,MPI_COMM_WORLD,&probe_status);
+    MPI_Probe(locJ,101+tag_index,chi_mpi.comm,&probe_status);
 
     int amount_to_receive=0;
     MPI_Get_count(&probe_status, MPI_INT, &amount_to_receive );
@@ -111,7 +111,7 @@ InitializeBetaElements(SPDS_ptr spds, int tag_index)
              amount_to_receive,
              MPI_INT,
              locJ,101+tag_index,
-             MPI_COMM_WORLD,
+             chi_mpi.comm,
              MPI_STATUS_IGNORE);
 
     DeSerializeCellInfo(prelocI_cell_views[prelocI], &face_indices,
@@ -138,7 +138,7 @@ InitializeBetaElements(SPDS_ptr spds, int tag_index)
     MPI_Isend(multi_face_indices[deplocI].data(),
               multi_face_indices[deplocI].size(),
               MPI_INT,locJ,101+tag_index,
-              MPI_COMM_WORLD,&send_requests[deplocI]);
+              chi_mpi.comm,&send_requests[deplocI]);
 
     //TODO: Watch eager limits on sent data
 
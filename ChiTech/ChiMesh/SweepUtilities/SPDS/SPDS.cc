@@ -251,7 +251,7 @@ void chi_mesh::sweep_management::SPDS::BuildTaskDependencyGraph(bool cycle_allow
   MPI_Bcast(&edge_buffer_size,      //Buffer
             1, MPI_INT,             //Count and datatype
             0,                      //Root location
-            MPI_COMM_WORLD);        //Communicator
+            chi_mpi.comm);        //Communicator
 
   //============================================= Broadcast edges
   if (chi_mpi.location_id != 0)
@@ -260,7 +260,7 @@ void chi_mesh::sweep_management::SPDS::BuildTaskDependencyGraph(bool cycle_allow
   MPI_Bcast(raw_edges_to_remove.data(),      //Buffer
             edge_buffer_size, MPI_INT, //Count and datatype
             0,                         //Root location
-            MPI_COMM_WORLD);           //Communicator
+            chi_mpi.comm);           //Communicator
 
   //============================================= De-serialize edges
   if (chi_mpi.location_id != 0)
@@ -325,7 +325,7 @@ void chi_mesh::sweep_management::SPDS::BuildTaskDependencyGraph(bool cycle_allow
   MPI_Bcast(&topsort_buffer_size,   //Buffer
             1, MPI_INT,             //Count and datatype
             0,                      //Root location
-            MPI_COMM_WORLD);        //Communicator
+            chi_mpi.comm);        //Communicator
 
   //============================================= Broadcast topological sort
   if (chi_mpi.location_id != 0)
@@ -334,7 +334,7 @@ void chi_mesh::sweep_management::SPDS::BuildTaskDependencyGraph(bool cycle_allow
   MPI_Bcast(glob_linear_sweep_order.data(),//Buffer
             topsort_buffer_size, MPI_INT,  //Count and datatype
             0,                             //Root location
-            MPI_COMM_WORLD);               //Communicator
+            chi_mpi.comm);               //Communicator
 
   //============================================= Compute reorder mapping
   // This mapping allows us to punch in
@@ -3,6 +3,7 @@
 #include <chi_log.h>
 #include <chi_mpi.h>
 extern ChiLog& chi_log;
+extern ChiMPI& chi_mpi;
 
 ////###################################################################
 ///**Returns a flag indicating whether this bndry is reflecting or not.*/
@@ -157,7 +158,7 @@ void chi_mesh::sweep_management::BoundaryReflecting::
       }
       ++n;
     }
-    MPI_Allreduce(&local_pw_change,&pw_change,1,MPI_DOUBLE,MPI_MAX,MPI_COMM_WORLD);
+    MPI_Allreduce(&local_pw_change,&pw_change,1,MPI_DOUBLE,MPI_MAX,chi_mpi.comm);
   }
 
   for (auto& flags : angle_readyflags)
@@ -4,6 +4,8 @@
 #include "ChiMesh/SweepUtilities/AngleAggregation/angleaggregation.h"
 #include "ChiMesh/SweepUtilities/sweepchunk_base.h"
 
+#include <functional>
+
 
 namespace chi_mesh { namespace sweep_management
 {
@@ -45,6 +47,7 @@ private:
     }
   };
   std::vector<RULE_VALUES> rule_values;
+  size_t num_sweeps = 0;
 public:
   SweepChunk& sweep_chunk;
   const size_t sweep_event_tag;
@@ -56,6 +59,12 @@ public:
 
   void Sweep();
   double GetAverageSweepTime() const;
+  size_t GetNumberOfSweeps() const {return num_sweeps;}
+
+  typedef std::function<void(size_t)> StageCallback;
+  static void PipelinedSweep(const std::vector<SweepScheduler*>& stages,
+                             const StageCallback& stage_begin_callback,
+                             const StageCallback& stage_end_callback);
   std::vector<double> GetAngleSetTimings();
 
 private:
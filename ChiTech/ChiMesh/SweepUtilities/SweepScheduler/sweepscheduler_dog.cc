@@ -195,7 +195,7 @@ void chi_mesh::sweep_management::SweepScheduler::
 //  }
 
   //================================================== Receive delayed data
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
   bool received_delayed_data = false;
   while (not received_delayed_data)
   {
@@ -50,7 +50,7 @@ void chi_mesh::sweep_management::SweepScheduler::
   }
 
   //================================================== Receive delayed data
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
   for (auto& sorted_angleset : rule_values)
   {
     auto angleset = sorted_angleset.angle_set;
@@ -0,0 +1,213 @@
+#include "sweepscheduler.h"
+
+#include <chi_mpi.h>
+#include <chi_log.h>
+
+extern ChiMPI& chi_mpi;
+extern ChiLog& chi_log;
+
+//###################################################################
+/**Sweeps a sequence of schedulers (stages) in a single pipelined pass.
+ *
+ * Stage k+1 is started on this location as soon as all of stage k's
+ * anglesets have finished on this location, i.e. without waiting for
+ * the other locations. Upstream locations can therefore already sweep
+ * stage k+1 while downstream locations are still busy with stage k,
+ * which avoids draining and refilling the sweep pipeline between stages.
+ * This is only valid when the input of stage k+1 depends solely on the
+ * local output of stages up to k (e.g. downscatter-only groupsets).
+ *
+ * `stage_begin_callback(k)` is called on this location just before stage
+ * k's anglesets are advanced for the first time and `stage_end_callback(k)`
+ * directly after all of stage k's anglesets have finished locally. These
+ * callbacks must not invoke collective operations.
+ *
+ * A message tag is formed as max_num_mess*angleset_number + m, with m
+ * the message number. Each stage's angleset numbers are offset by the
+ * number of anglesets of the preceding stages, and for the duration of
+ * the pipelined sweep all stages use the largest max_num_mess of any
+ * stage, reduced across locations. Together this makes the tags unique
+ * across stages. If the resulting tags would exceed MPI_TAG_UB, the
+ * stages are swept one after another instead.
+ *
+ * All stages must use the DEPTH_OF_GRAPH scheduling algorithm.*/
+void chi_mesh::sweep_management::SweepScheduler::
+  PipelinedSweep(const std::vector<SweepScheduler*>& stages,
+                 const StageCallback& stage_begin_callback,
+                 const StageCallback& stage_end_callback)
+{
+  typedef ExecutionPermission ExePerm;
+  typedef AngleSetStatus Status;
+
+  const size_t num_stages = stages.size();
+  if (num_stages == 0) return;
+
+  for (auto stage : stages)
+    if (stage->scheduler_type != SchedulingAlgorithm::DEPTH_OF_GRAPH)
+    {
+      chi_log.Log(LOG_ALLERROR)
+        << "SweepScheduler::PipelinedSweep: Only the DEPTH_OF_GRAPH "
+        << "scheduling algorithm is supported.";
+      exit(EXIT_FAILURE);
+    }
+
+  //================================================== Compute angleset
+  //                                                   number offsets
+  // Angleset numbers are used to form the message tags. Offsetting them
+  // per stage keeps messages from different stages apart, provided all
+  // stages use the same tag stride.
+  std::vector<int> stage_offsets(num_stages, 0);
+  std::vector<int> stage_max_num_messages(num_stages, 0);
+  int total_num_anglesets = 0;
+  int local_max_num_messages = 0;
+  for (size_t k=0; k<num_stages; ++k)
+  {
+    stage_offsets[k] = total_num_anglesets;
+    for (auto& angsetgrp : stages[k]->angle_agg.angle_set_groups)
+      for (auto& angset : angsetgrp.angle_sets)
+      {
+        ++total_num_anglesets;
+        stage_max_num_messages[k] = std::max(stage_max_num_messages[k],
+                                             angset->GetMaxBufferMessages());
+      }
+    local_max_num_messages = std::max(local_max_num_messages,
+                                      stage_max_num_messages[k]);
+  }
+
+  int max_num_messages = 0;
+  MPI_Allreduce(&local_max_num_messages,
+                &max_num_messages,
+                1, MPI_INT,
+                MPI_MAX, chi_mpi.comm);
+
+  int* tag_upper_bound = nullptr;
+  int  tag_ub_flag = 0;
+  MPI_Comm_get_attr(chi_mpi.comm, MPI_TAG_UB, &tag_upper_bound, &tag_ub_flag);
+
+  const double max_tag = static_cast<double>(max_num_messages)*
+                         static_cast<double>(total_num_anglesets + 1);
+  if (tag_ub_flag and (max_tag > static_cast<double>(*tag_upper_bound)))
+  {
+    chi_log.Log(LOG_0WARNING)
+      << "SweepScheduler::PipelinedSweep: Message tags would exceed "
+      << "MPI_TAG_UB. Stages will be swept sequentially.";
+
+    for (size_t k=0; k<num_stages; ++k)
+    {
+      stage_begin_callback(k);
+      stages[k]->Sweep();
+      stage_end_callback(k);
+    }
+    return;
+  }
+
+  //================================================== Common tag stride
+  for (auto stage : stages)
+    for (auto& angsetgrp : stage->angle_agg.angle_set_groups)
+      for (auto& angset : angsetgrp.angle_sets)
+        angset->SetMaxBufferMessages(max_num_messages);
+
+  for (auto stage : stages)
+  {
+    chi_log.LogEvent(stage->sweep_event_tag, ChiLog::EventType::EVENT_BEGIN);
+    ++stage->num_sweeps;
+  }
+
+  //================================================== Loop till done
+  std::vector<bool> stage_started(num_stages, false);
+  std::vector<bool> stage_finished(num_stages, false);
+
+  stage_begin_callback(0);
+  stage_started[0] = true;
+
+  bool finished = false;
+  while (not finished)
+  {
+    finished = true;
+    for (size_t k=0; k<num_stages; ++k)
+    {
+      if (not stage_started[k]) {finished = false; break;}
+      if (stage_finished[k]) continue;
+
+      auto& stage = *stages[k];
+      bool stage_done = true;
+      for (auto& rule : stage.rule_values)
+      {
+        auto angleset = rule.angle_set;
+        int angset_number = static_cast<int>(rule.set_index) + stage_offsets[k];
+
+        Status status = angleset->
+          AngleSetAdvance(stage.sweep_chunk,
+                          angset_number,
+                          stage.sweep_timing_events_tag,
+                          ExePerm::NO_EXEC_IF_READY);
+
+        if (status == Status::READY_TO_EXECUTE)
+          status = angleset->
+            AngleSetAdvance(stage.sweep_chunk,
+                            angset_number,
+                            stage.sweep_timing_events_tag,
+                            ExePerm::EXECUTE);
+
+        if (status != Status::FINISHED)
+          stage_done = false;
+      }//for each angleset rule
+
+      if (stage_done)
+      {
+        stage_finished[k] = true;
+        stage_end_callback(k);
+
+        if (k+1 < num_stages)
+        {
+          stage_begin_callback(k+1);
+          stage_started[k+1] = true;
+        }
+      }
+      else
+        finished = false;
+    }//for stage k
+  }//while not finished
+
+  //================================================== Receive delayed data
+  MPI_Barrier(chi_mpi.comm);
+  bool received_delayed_data = false;
+  while (not received_delayed_data)
+  {
+    received_delayed_data = true;
+    for (size_t k=0; k<num_stages; ++k)
+      for (auto& rule : stages[k]->rule_values)
+      {
+        auto angleset = rule.angle_set;
+
+        if (angleset->FlushSendBuffers() == Status::MESSAGES_PENDING)
+          received_delayed_data = false;
+        angleset->ReceiveDelayedData(static_cast<int>(rule.set_index) +
+                                     stage_offsets[k]);
+      }
+  }
+
+  //================================================== Reset all
+  for (size_t k=0; k<num_stages; ++k)
+  {
+    auto stage = stages[k];
+    for (auto& angset_group : stage->angle_agg.angle_set_groups)
+    {
+      angset_group.ResetSweep();
+      for (auto& angset : angset_group.angle_sets)
+        angset->SetMaxBufferMessages(stage_max_num_messages[k]);
+    }
+
+    for (auto& bndry : stage->angle_agg.sim_boundaries)
+    {
+      if (bndry->Type() == chi_mesh::sweep_management::BoundaryType::REFLECTING)
+      {
+        auto rbndry = std::static_pointer_cast<
+          chi_mesh::sweep_management::BoundaryReflecting>(bndry);
+        rbndry->ResetAnglesReadyStatus();
+      }
+    }
+
+    chi_log.LogEvent(stage->sweep_event_tag, ChiLog::EventType::EVENT_END);
+  }
+}
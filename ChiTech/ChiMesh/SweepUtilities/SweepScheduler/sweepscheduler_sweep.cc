@@ -8,6 +8,7 @@ extern ChiLog& chi_log;
 void chi_mesh::sweep_management::SweepScheduler::
      Sweep()
 {
+  ++num_sweeps;
   if (scheduler_type == SchedulingAlgorithm::FIRST_IN_FIRST_OUT)
     ScheduleAlgoFIFO(sweep_chunk);
   else if (scheduler_type == SchedulingAlgorithm::DEPTH_OF_GRAPH)
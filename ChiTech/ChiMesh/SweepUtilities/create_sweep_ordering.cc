@@ -116,7 +116,7 @@ chi_mesh::sweep_management::
   //                                                        dependency graph
   sweep_order->BuildTaskDependencyGraph(cycle_allowance_flag);
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   chi_log.Log(LOG_0VERBOSE_1)
     << chi_program_timer.GetTimeString()
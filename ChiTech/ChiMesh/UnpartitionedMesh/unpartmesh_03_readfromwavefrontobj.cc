@@ -3,6 +3,7 @@
 #include "chi_log.h"
 extern ChiLog& chi_log;
 #include "chi_mpi.h"
+extern ChiMPI& chi_mpi;
 
 #include <algorithm>
 
@@ -23,7 +24,7 @@ void chi_mesh::UnpartitionedMesh::ReadFromWavefrontOBJ(const Options &options)
 
   chi_log.Log() << "Making Unpartitioned mesh from wavefront file "
                 << options.file_name;
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //===================================================== Reading every line and determining size
   std::string file_line;
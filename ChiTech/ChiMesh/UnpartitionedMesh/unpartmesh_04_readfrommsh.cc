@@ -4,6 +4,7 @@
 extern ChiLog& chi_log;
 
 #include "chi_mpi.h"
+extern ChiMPI& chi_mpi;
 
 #include <map>
 
@@ -26,7 +27,7 @@ void chi_mesh::UnpartitionedMesh::ReadFromMsh(const Options &options)
 
   chi_log.Log() << "Making Unpartitioned mesh from msh format file "
                 << options.file_name;
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //===================================================== Declarations
   std::string file_line;
@@ -103,7 +103,7 @@ void chi_mesh::VolumeMesherExtruder::Execute()
   //================================== Create extruded item_id
   chi_log.Log(LOG_0)
     << "VolumeMesherExtruder: Extruding cells" << std::endl;
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
   ExtrudeCells(*temp_grid, *grid);
 
   size_t total_local_cells = grid->local_cells.size();
@@ -114,7 +114,7 @@ void chi_mesh::VolumeMesherExtruder::Execute()
                 1,
                 MPI_UNSIGNED_LONG_LONG,
                 MPI_SUM,
-                MPI_COMM_WORLD);
+                chi_mpi.comm);
 
   chi_log.Log(LOG_0)
     << "VolumeMesherExtruder: Cells extruded = "
@@ -165,5 +165,5 @@ void chi_mesh::VolumeMesherExtruder::Execute()
     << std::endl;
   grid->vertices.shrink_to_fit();
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 }
\ No newline at end of file
@@ -74,7 +74,7 @@ void chi_mesh::VolumeMesherPredefinedUnpartitioned::Execute()
   auto umesh = mesh_handler->unpartitionedmesh_stack.back();
 
   chi_log.Log(LOG_0) << "Computed centroids";
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
 
   //======================================== Apply partitioning scheme
@@ -86,7 +86,7 @@ void chi_mesh::VolumeMesherPredefinedUnpartitioned::Execute()
     PARMETIS(umesh,grid);
 
   chi_log.Log(LOG_0) << "Cells loaded.";
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   AddContinuumToRegion(grid, *mesh_handler->region_stack.back());
 
@@ -111,7 +111,7 @@ void chi_mesh::VolumeMesherPredefinedUnpartitioned::Execute()
                 1,
                 MPI_UNSIGNED_LONG_LONG,
                 MPI_SUM,
-                MPI_COMM_WORLD);
+                chi_mpi.comm);
 
   chi_log.Log(LOG_0)
     << "VolumeMesherPredefinedUnpartitioned: Cells created = "
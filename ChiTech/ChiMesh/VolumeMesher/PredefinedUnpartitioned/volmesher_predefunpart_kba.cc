@@ -76,7 +76,7 @@ KBA(chi_mesh::UnpartitionedMesh* umesh,
     grid->vertices.push_back(vert);
 
   chi_log.Log(LOG_0) << "Vertices loaded.";
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //======================================== Load up the cells
   int global_id=-1;
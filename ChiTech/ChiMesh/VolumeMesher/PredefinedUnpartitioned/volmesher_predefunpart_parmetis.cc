@@ -128,14 +128,14 @@ void chi_mesh::VolumeMesherPredefinedUnpartitioned::
             umesh->raw_cells.size(), //count
             MPI_LONG_LONG_INT,       //data type
             0,                       //root
-            MPI_COMM_WORLD);         //communicator
+            chi_mpi.comm);         //communicator
   chi_log.Log(LOG_0) << "Done partitioning mesh.";
 
   //======================================== Load up the vertices
   for (auto& vert : umesh->vertices)
     grid->vertices.push_back(vert);
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //======================================== Load up the cells
   int global_id=-1;
@@ -566,7 +566,7 @@ void chi_mesh::VolumeMesher::
       ++num_cells_modified;
     }
   }
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
   chi_log.Log(LOG_0)
     << chi_program_timer.GetTimeString()
     << " Done setting material id from logical volume. "
@@ -626,7 +626,7 @@ void chi_mesh::VolumeMesher::
   for (auto& cell : vol_cont->local_cells)
     cell.material_id = mat_id;
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
   chi_log.Log(LOG_0)
     << chi_program_timer.GetTimeString()
     << " Done setting material id " << mat_id << " to all cells";
@@ -670,7 +670,7 @@ void chi_mesh::VolumeMesher::
         if (boundary_id >= 0) face.neighbor_id = boundary_id;
       }//if bndry
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
   chi_log.Log(LOG_0)
     << chi_program_timer.GetTimeString()
     << " Done setting orthogonal boundaries.";
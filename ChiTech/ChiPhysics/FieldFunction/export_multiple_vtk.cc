@@ -29,6 +29,9 @@ void chi_physics::FieldFunction::
   ExportMultipleFFToVTK(const std::string& file_base_name,
                         const std::vector<std::shared_ptr<chi_physics::FieldFunction>>& ff_list)
 {
+  //Replicated domains hold identical data, only the first one writes
+  if (chi_mpi.replica_id != 0) return;
+
   chi_log.Log(LOG_0) << "Exporting field functions to VTK.";
 
   //============================================= Check ff_list populated
@@ -283,7 +286,7 @@ void chi_physics::FieldFunction::
 
     pgrid_writer->Write();
   }
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(chi_mpi.comm);
 
   //============================================= Serial output each piece
   auto grid_writer = vtkSmartPointer<vtkXMLUnstructuredGridWriter>::New();
@@ -21,6 +21,9 @@ void chi_physics::FieldFunction::
   ExportToVTKComponentOnly(const std::string& base_name,
                            const std::string& field_name)
 {
+  //Replicated domains hold identical data, only the first one writes
+  if (chi_mpi.replica_id != 0) return;
+
   chi_log.Log(LOG_0)
     << "Exporting field function " << text_name
     << " to files with base name " << base_name;
@@ -45,6 +48,9 @@ void chi_physics::FieldFunction::
 void chi_physics::FieldFunction::ExportToVTK(const std::string& base_name,
                                              const std::string& field_name)
 {
+  //Replicated domains hold identical data, only the first one writes
+  if (chi_mpi.replica_id != 0) return;
+
   chi_log.Log(LOG_0)
     << "Exporting field function " << text_name
     << " to files with base name " << base_name
@@ -0,0 +1,23 @@
+#include "../../ChiLua/chi_lua.h"
+
+#include "../chi_timer.h"
+
+extern ChiTimer chi_program_timer;
+
+//#############################################################################
+/** Returns the wall-clock time, in seconds, since the start of the program.
+ * Unlike os.clock, which returns the CPU time of the process, this
+ * includes the time spent waiting, e.g. for MPI communication.
+
+\return double The program time in seconds.
+
+\code
+t_start = chiProgramTime()
+chiLBSExecute(phys1)
+t_exec = chiProgramTime() - t_start
+\endcode*/
+int chiProgramTime(lua_State *L)
+{
+  lua_pushnumber(L, chi_program_timer.GetTime()/1000.0);
+  return 1;
+}
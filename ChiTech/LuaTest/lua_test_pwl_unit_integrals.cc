@@ -0,0 +1,320 @@
+#include <ChiLua/chi_lua.h>
+
+#include "ChiMesh/MeshHandler/chi_meshhandler.h"
+#include "ChiMesh/MeshContinuum/chi_meshcontinuum.h"
+#include "ChiMath/SpatialDiscretization/CellMappings/FE_PWL/pwl_polyhedron.h"
+#include "ChiMath/SpatialDiscretization/FiniteElement/PiecewiseLinear/pwl.h"
+
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include <limits>
+
+extern ChiLog& chi_log;
+extern ChiMPI& chi_mpi;
+
+namespace
+{
+//###################################################################
+/**Returns the maximum absolute difference of any volume or surface
+ * integral of two sets of unit integrals of the same cell.*/
+double MaxUnitIntegralsDifference(
+  const chi_math::finite_element::UnitIntegralData& a,
+  const chi_math::finite_element::UnitIntegralData& b)
+{
+  double max_diff = 0.0;
+  auto Compare = [&max_diff](double va, double vb)
+  {max_diff = std::max(max_diff, std::fabs(va - vb));};
+  auto CompareVec3 = [&Compare](const chi_mesh::Vector3& va,
+                                const chi_mesh::Vector3& vb)
+  {Compare(va.x, vb.x); Compare(va.y, vb.y); Compare(va.z, vb.z);};
+
+  const size_t num_nodes = a.NumNodes();
+  const size_t num_faces = a.NumFaces();
+  for (unsigned int i=0; i<num_nodes; ++i)
+  {
+    for (unsigned int j=0; j<num_nodes; ++j)
+    {
+      Compare(a.IntV_gradShapeI_gradShapeJ(i,j),
+              b.IntV_gradShapeI_gradShapeJ(i,j));
+      Compare(a.IntV_shapeI_shapeJ(i,j), b.IntV_shapeI_shapeJ(i,j));
+      CompareVec3(a.IntV_shapeI_gradshapeJ(i,j), b.IntV_shapeI_gradshapeJ(i,j));
+    }
+    Compare(a.IntV_shapeI(i), b.IntV_shapeI(i));
+    CompareVec3(a.IntV_gradshapeI(i), b.IntV_gradshapeI(i));
+  }
+
+  for (unsigned int f=0; f<num_faces; ++f)
+    for (unsigned int i=0; i<num_nodes; ++i)
+    {
+      for (unsigned int j=0; j<num_nodes; ++j)
+      {
+        Compare(a.IntS_shapeI_shapeJ(f,i,j), b.IntS_shapeI_shapeJ(f,i,j));
+        CompareVec3(a.IntS_shapeI_gradshapeJ(f,i,j),
+                    b.IntS_shapeI_gradshapeJ(f,i,j));
+      }
+      Compare(a.IntS_shapeI(f,i), b.IntS_shapeI(f,i));
+    }
+
+  return max_diff;
+}
+}
+
+//###################################################################
+/**Compares the closed form PWL unit integrals of the polyhedral cells of
+ * the current mesh with those computed from quadrature point data.
+ *
+\return double The maximum absolute difference of any unit integral over
+        all locations.
+
+\code
+max_diff = chiPWLTestUnitIntegrals()
+\endcode
+\ingroup LuaGeneralUtilities
+ */
+int chiPWLTestUnitIntegrals(lua_State* L)
+{
+  auto grid = chi_mesh::GetCurrentHandler()->GetGrid();
+
+  // Second order is exact for the products of linear shape functions
+  chi_math::QuadratureTetrahedron tet_quadrature(chi_math::QuadratureOrder::SECOND);
+  chi_math::QuadratureTriangle    tri_quadrature(chi_math::QuadratureOrder::SECOND);
+
+  double local_max_diff = 0.0;
+  size_t num_cells_compared = 0;
+  for (const auto& cell : grid->local_cells)
+  {
+    if (cell.Type() != chi_mesh::CellType::POLYHEDRON) continue;
+
+    const auto& polyh_cell = static_cast<const chi_mesh::CellPolyhedron&>(cell);
+    PolyhedronMappingFE_PWL cell_mapping(polyh_cell, grid,
+                                         tet_quadrature, tri_quadrature);
+
+    chi_math::finite_element::UnitIntegralData closed_form, from_qp;
+    cell_mapping.ComputeUnitIntegrals(closed_form);
+    cell_mapping.CellMappingFE_PWL::ComputeUnitIntegrals(from_qp);
+
+    local_max_diff = std::max(local_max_diff,
+                              MaxUnitIntegralsDifference(closed_form, from_qp));
+    ++num_cells_compared;
+  }//for cell
+
+  double max_diff = 0.0;
+  MPI_Allreduce(&local_max_diff, &max_diff, 1, MPI_DOUBLE, MPI_MAX,
+                chi_mpi.comm);
+
+  chi_log.Log(LOG_ALLVERBOSE_1)
+    << "chiPWLTestUnitIntegrals: Compared " << num_cells_compared
+    << " polyhedral cells.";
+
+  lua_pushnumber(L, max_diff);
+  return 1;
+}
+
+//###################################################################
+/**Creates a PWLD spatial discretization of the current mesh, which
+ * stores one unit integrals record per unique cell shape, and compares the
+ * integrals of each local cell with those computed from the cell's own
+ * mapping.
+ *
+eturn Three values. The maximum absolute difference of any unit
+        integral over all locations, the number of unit integral records
+        summed over all locations and the number of local cells summed
+        over all locations.
+
+\code
+max_diff, num_records, num_cells = chiPWLDTestUnitIntegralRecords()
+\endcode
+\ingroup LuaGeneralUtilities
+ */
+int chiPWLDTestUnitIntegralRecords(lua_State* L)
+{
+  using namespace chi_math::finite_element;
+  auto grid = chi_mesh::GetCurrentHandler()->GetGrid();
+
+  auto pwl = SpatialDiscretization_PWLD::New(grid, COMPUTE_CELL_MAPPINGS |
+                                                   COMPUTE_UNIT_INTEGRALS);
+
+  double local_max_diff = 0.0;
+  for (const auto& cell : grid->local_cells)
+  {
+    UnitIntegralData cell_ui_data;
+    pwl->GetCellMappingFE(cell.local_id)->ComputeUnitIntegrals(cell_ui_data);
+
+    local_max_diff = std::max(local_max_diff,
+      MaxUnitIntegralsDifference(pwl->GetUnitIntegrals(cell), cell_ui_data));
+  }
+
+  double max_diff = 0.0;
+  MPI_Allreduce(&local_max_diff, &max_diff, 1, MPI_DOUBLE, MPI_MAX,
+                chi_mpi.comm);
+
+  uint64_t local_counts[] = {pwl->NumUnitIntegralRecords(),
+                             grid->local_cells.size()};
+  uint64_t global_counts[] = {0, 0};
+  MPI_Allreduce(local_counts, global_counts, 2, MPI_UINT64_T, MPI_SUM,
+                chi_mpi.comm);
+
+  lua_pushnumber(L, max_diff);
+  lua_pushnumber(L, static_cast<lua_Number>(global_counts[0]));
+  lua_pushnumber(L, static_cast<lua_Number>(global_counts[1]));
+  return 3;
+}
+
+//###################################################################
+/**Checks the flat storage of the unit integrals of the local cells of the
+ * current mesh. For each cell the integrals computed from quadrature point
+ * data are stored in a UnitIntegralData. Every element accessor, every
+ * matrix view and every face dof mapping of it is then compared with
+ * nested matrices summed from the same quadrature point data.
+ *
+\return double The maximum absolute difference over all locations.
+
+\code
+max_diff = chiPWLTestFlatUnitIntegrals()
+\endcode
+\ingroup LuaGeneralUtilities
+ */
+int chiPWLTestFlatUnitIntegrals(lua_State* L)
+{
+  using namespace chi_math::finite_element;
+  typedef std::vector<double> VecDbl;
+  typedef std::vector<VecDbl> MatDbl;
+  typedef std::vector<VecVec3> MatVec3;
+
+  auto grid = chi_mesh::GetCurrentHandler()->GetGrid();
+
+  auto pwl = SpatialDiscretization_PWLD::New(grid, COMPUTE_CELL_MAPPINGS);
+
+  double local_max_diff = 0.0;
+  auto Compare = [&local_max_diff](double a, double b)
+  {local_max_diff = std::max(local_max_diff, std::fabs(a - b));};
+  auto CompareVec3 = [&Compare](const chi_mesh::Vector3& a,
+                                const chi_mesh::Vector3& b)
+  {Compare(a.x, b.x); Compare(a.y, b.y); Compare(a.z, b.z);};
+
+  for (const auto& cell : grid->local_cells)
+  {
+    auto cell_mapping = pwl->GetCellMappingFE(cell.local_id);
+
+    UnitIntegralData ui_data;
+    cell_mapping->CellMappingFE_PWL::ComputeUnitIntegrals(ui_data);
+
+    InternalQuadraturePointData vol_qp_data;
+    std::vector<FaceQuadraturePointData> faces_qp_data;
+    cell_mapping->InitializeAllQuadraturePointData(vol_qp_data, faces_qp_data);
+
+    //============================================= Nested reference
+    const size_t num_nodes = vol_qp_data.NumNodes();
+    const size_t num_faces = faces_qp_data.size();
+
+    MatDbl  IntV_gradshapeI_gradshapeJ(num_nodes, VecDbl(num_nodes, 0.0));
+    MatVec3 IntV_shapeI_gradshapeJ(num_nodes, VecVec3(num_nodes));
+    MatDbl  IntV_shapeI_shapeJ(num_nodes, VecDbl(num_nodes, 0.0));
+    VecDbl  IntV_shapeI(num_nodes, 0.0);
+    VecVec3 IntV_gradshapeI(num_nodes);
+
+    std::vector<MatDbl>  IntS_shapeI_shapeJ(num_faces,
+                                            MatDbl(num_nodes, VecDbl(num_nodes, 0.0)));
+    std::vector<VecDbl>  IntS_shapeI(num_faces, VecDbl(num_nodes, 0.0));
+    std::vector<MatVec3> IntS_shapeI_gradshapeJ(num_faces,
+                                                MatVec3(num_nodes, VecVec3(num_nodes)));
+
+    for (unsigned int i=0; i<num_nodes; ++i)
+      for (const auto& qp : vol_qp_data.QuadraturePointIndices())
+      {
+        const double jxw = vol_qp_data.JxW(qp);
+        for (unsigned int j=0; j<num_nodes; ++j)
+        {
+          IntV_gradshapeI_gradshapeJ[i][j] +=
+            vol_qp_data.ShapeGrad(i, qp).Dot(vol_qp_data.ShapeGrad(j, qp))*jxw;
+          IntV_shapeI_gradshapeJ[i][j] +=
+            vol_qp_data.ShapeValue(i, qp)*vol_qp_data.ShapeGrad(j, qp)*jxw;
+          IntV_shapeI_shapeJ[i][j] +=
+            vol_qp_data.ShapeValue(i, qp)*vol_qp_data.ShapeValue(j, qp)*jxw;
+        }
+        IntV_shapeI[i]     += vol_qp_data.ShapeValue(i, qp)*jxw;
+        IntV_gradshapeI[i] += vol_qp_data.ShapeGrad(i, qp)*jxw;
+      }
+
+    for (unsigned int f=0; f<num_faces; ++f)
+    {
+      const auto& face_qp_data = faces_qp_data[f];
+      for (unsigned int i=0; i<num_nodes; ++i)
+        for (const auto& qp : face_qp_data.QuadraturePointIndices())
+        {
+          const double jxw = face_qp_data.JxW(qp);
+          for (unsigned int j=0; j<num_nodes; ++j)
+          {
+            IntS_shapeI_shapeJ[f][i][j] +=
+              face_qp_data.ShapeValue(i, qp)*face_qp_data.ShapeValue(j, qp)*jxw;
+            IntS_shapeI_gradshapeJ[f][i][j] +=
+              face_qp_data.ShapeValue(i, qp)*face_qp_data.ShapeGrad(j, qp)*jxw;
+          }
+          IntS_shapeI[f][i] += face_qp_data.ShapeValue(i, qp)*jxw;
+        }
+    }
+
+    //============================================= Compare flat storage
+    const auto V_GG = ui_data.GetIntV_gradShapeI_gradShapeJ();
+    const auto V_SG = ui_data.GetIntV_shapeI_gradshapeJ();
+    const auto V_SS = ui_data.GetIntV_shapeI_shapeJ();
+    const auto V_S  = ui_data.GetIntV_shapeI();
+    const auto V_G  = ui_data.GetIntV_gradshapeI();
+    const auto S_SS = ui_data.GetIntS_shapeI_shapeJ();
+    const auto S_S  = ui_data.GetIntS_shapeI();
+    const auto S_SG = ui_data.GetIntS_shapeI_gradshapeJ();
+
+    if (ui_data.NumNodes() != num_nodes or ui_data.NumFaces() != num_faces)
+      local_max_diff = std::numeric_limits<double>::max();
+
+    for (unsigned int i=0; i<num_nodes; ++i)
+    {
+      for (unsigned int j=0; j<num_nodes; ++j)
+      {
+        Compare(ui_data.IntV_gradShapeI_gradShapeJ(i,j),
+                IntV_gradshapeI_gradshapeJ[i][j]);
+        Compare(V_GG[i][j], IntV_gradshapeI_gradshapeJ[i][j]);
+        CompareVec3(ui_data.IntV_shapeI_gradshapeJ(i,j),
+                    IntV_shapeI_gradshapeJ[i][j]);
+        CompareVec3(V_SG[i][j], IntV_shapeI_gradshapeJ[i][j]);
+        Compare(ui_data.IntV_shapeI_shapeJ(i,j), IntV_shapeI_shapeJ[i][j]);
+        Compare(V_SS[i][j], IntV_shapeI_shapeJ[i][j]);
+      }
+      Compare(ui_data.IntV_shapeI(i), IntV_shapeI[i]);
+      Compare(V_S[i], IntV_shapeI[i]);
+      CompareVec3(ui_data.IntV_gradshapeI(i), IntV_gradshapeI[i]);
+      CompareVec3(V_G[i], IntV_gradshapeI[i]);
+    }
+
+    for (unsigned int f=0; f<num_faces; ++f)
+    {
+      for (unsigned int i=0; i<num_nodes; ++i)
+      {
+        for (unsigned int j=0; j<num_nodes; ++j)
+        {
+          Compare(ui_data.IntS_shapeI_shapeJ(f,i,j),
+                  IntS_shapeI_shapeJ[f][i][j]);
+          Compare(S_SS[f][i][j], IntS_shapeI_shapeJ[f][i][j]);
+          CompareVec3(ui_data.IntS_shapeI_gradshapeJ(f,i,j),
+                      IntS_shapeI_gradshapeJ[f][i][j]);
+          CompareVec3(S_SG[f][i][j], IntS_shapeI_gradshapeJ[f][i][j]);
+        }
+        Compare(ui_data.IntS_shapeI(f,i), IntS_shapeI[f][i]);
+        Compare(S_S[f][i], IntS_shapeI[f][i]);
+      }
+
+      const size_t num_face_nodes = cell.faces[f].vertex_ids.size();
+      for (size_t fi=0; fi<num_face_nodes; ++fi)
+        Compare(ui_data.FaceDofMapping(f,fi),
+                faces_qp_data[f].FaceDofMapping(f,fi));
+    }
+  }//for cell
+
+  double max_diff = 0.0;
+  MPI_Allreduce(&local_max_diff, &max_diff, 1, MPI_DOUBLE, MPI_MAX,
+                chi_mpi.comm);
+
+  lua_pushnumber(L, max_diff);
+  return 1;
+}
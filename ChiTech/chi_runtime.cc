@@ -63,7 +63,13 @@ void ChiTech::ParseArguments(int argc, char** argv)
         << "\n"
         << "     -v                         Level of verbosity. Default 0. Can be either 0, 1 or 2.\n"
         << "     a=b                        Executes argument as a lua string. i.e. x=2 or y=[[\"string\"]]\n"
-        << "     -allow_petsc_error_handler Allow petsc error handler.\n\n\n";
+        << "     -allow_petsc_error_handler Allow petsc error handler.\n"
+        << "     -num_replicas              Number of replicated spatial domains. Default 1.\n"
+        << "     -num_setup_threads         Number of threads per process used to set up\n"
+        << "                                spatial discretizations. Default 1.\n"
+        << "     -unit_integrals_cache_mb   Memory budget, per process, of a cache of\n"
+        << "                                PWLD unit integrals that are computed on\n"
+        << "                                demand. Default 0, storing all integrals.\n\n\n";
 
       chi_log.Log(LOG_0) << "PETSc options:";
       ChiTech::termination_posted = true;
@@ -72,6 +78,72 @@ void ChiTech::ParseArguments(int argc, char** argv)
     {
       ChiTech::allow_petsc_error_handler = true;
     }
+    //================================================ Replicated domains
+    else if (argument.find("-num_replicas")!=std::string::npos)
+    {
+      if ((i+1) >= argc)
+      {
+        std::cerr << "Invalid option used with command line argument "
+                     "-num_replicas. Must be a positive integer." << std::endl;
+        exit(EXIT_FAILURE);
+      }
+      try {
+        chi_mpi.num_replicas = std::stoi(std::string(argv[i+1]));
+      }
+      catch (const std::invalid_argument& e)
+      {
+        std::cerr << "Invalid option used with command line argument "
+                     "-num_replicas. Must be a positive integer." << std::endl;
+        exit(EXIT_FAILURE);
+      }
+      ++i;
+    }//-num_replicas
+    //================================================ Setup threads
+    else if (argument.find("-num_setup_threads")!=std::string::npos)
+    {
+      if ((i+1) >= argc)
+      {
+        std::cerr << "Invalid option used with command line argument "
+                     "-num_setup_threads. Must be a positive integer." << std::endl;
+        exit(EXIT_FAILURE);
+      }
+      try {
+        int num_threads = std::stoi(std::string(argv[i+1]));
+        if (num_threads < 1) throw std::invalid_argument("");
+        chi_math_handler.num_setup_threads = num_threads;
+      }
+      catch (const std::invalid_argument& e)
+      {
+        std::cerr << "Invalid option used with command line argument "
+                     "-num_setup_threads. Must be a positive integer." << std::endl;
+        exit(EXIT_FAILURE);
+      }
+      ++i;
+    }//-num_setup_threads
+    //================================================ Unit integrals cache
+    else if (argument.find("-unit_integrals_cache_mb")!=std::string::npos)
+    {
+      if ((i+1) >= argc)
+      {
+        std::cerr << "Invalid option used with command line argument "
+                     "-unit_integrals_cache_mb. Must be a non-negative "
+                     "number." << std::endl;
+        exit(EXIT_FAILURE);
+      }
+      try {
+        double budget_mb = std::stod(std::string(argv[i+1]));
+        if (budget_mb < 0.0) throw std::invalid_argument("");
+        chi_math_handler.unit_integrals_cache_mb = budget_mb;
+      }
+      catch (const std::invalid_argument& e)
+      {
+        std::cerr << "Invalid option used with command line argument "
+                     "-unit_integrals_cache_mb. Must be a non-negative "
+                     "number." << std::endl;
+        exit(EXIT_FAILURE);
+      }
+      ++i;
+    }//-unit_integrals_cache_mb
     //================================================ No-graphics option
     else if (argument.find("-b")!=std::string::npos)
     {
@@ -131,12 +203,14 @@ int ChiTech::Initialize(int argc, char** argv)
   MPI_Comm_rank (MPI_COMM_WORLD, &location_id);      /* get current process id */
   MPI_Comm_size (MPI_COMM_WORLD, &number_processes); /* get number of processes */
 
-  chi_mpi.location_id = location_id;
-  chi_mpi.process_count = number_processes;
+  //From here on location ids and process counts are relative
+  //to the spatial communicator
+  chi_mpi.SplitReplicatedDomains(location_id, number_processes);
 
-  chi_console.PostMPIInfo(location_id, number_processes);
+  chi_console.PostMPIInfo(chi_mpi.location_id, chi_mpi.process_count);
   chi_mpi.Initialize();
 
+  PETSC_COMM_WORLD = chi_mpi.comm;
   chi_physics_handler.InitPetSc(argc,argv);
 
   return 0;
@@ -200,7 +274,13 @@ int ChiTech::RunBatch(int argc, char** argv)
       << "\n"
       << "     -v                         Level of verbosity. Default 0. Can be either 0, 1 or 2.\n"
       << "     a=b                        Executes argument as a lua string. i.e. x=2 or y=[[\"string\"]]\n"
-      << "     -allow_petsc_error_handler Allow petsc error handler.\n\n\n";
+      << "     -allow_petsc_error_handler Allow petsc error handler.\n"
+      << "     -num_replicas              Number of replicated spatial domains. Default 1.\n"
+      << "     -num_setup_threads         Number of threads per process used to set up\n"
+      << "                                spatial discretizations. Default 1.\n"
+      << "     -unit_integrals_cache_mb   Memory budget, per process, of a cache of\n"
+      << "                                PWLD unit integrals that are computed on\n"
+      << "                                demand. Default 0, storing all integrals.\n\n\n";
 
   chi_console.FlushConsole();
 
@@ -1,4 +1,6 @@
 -- 2D Diffusion test with Dirichlet BCs.
+-- Also run with reassemble=true, which executes the solver a second time
+-- such that the matrix is assembled again into the existing one.
 -- SDM: PWLD
 -- Test: Max-value=0.29685
 num_procs = 4
@@ -56,6 +58,9 @@ chiDiffusionSetProperty(phys1,RESIDUAL_TOL,1.0e-6)
 --############################################### Initialize and Execute Solver
 chiDiffusionInitialize(phys1)
 chiDiffusionExecute(phys1)
+if (reassemble == true) then
+    chiDiffusionExecute(phys1)
+end
 
 --############################################### Get field functions
 fftemp,count = chiGetFieldFunctionList(phys1)
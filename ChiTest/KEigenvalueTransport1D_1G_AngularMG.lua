@@ -0,0 +1,35 @@
+-- 1D KEigen solver test with Vacuum BC, power iteration with GMRES inners
+-- right-preconditioned with a two level angular multigrid, compared to
+-- the same solver without preconditioner. The preconditioned solver must
+-- reach the same eigenvalue with fewer sweeps. The sweeps counted are
+-- those with the fine quadrature, the coarse level sweeps are not.
+-- SDM: PWLD
+-- Test: Final k-eigenvalue: 0.99954, k-diff=0.0 and Fewer-sweeps=1
+num_procs = 4
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+    chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+                      "Expected "..tostring(num_procs)..
+                      ". Pass check_num_procs=false to override if possible.")
+    os.exit(false)
+end
+
+dofile("ChiTest/KEigenvalueTransport1D_1G_Setup.lua")
+
+--############################################### Setup Physics
+phys_ref = CreateKSolver()
+
+phys, gs = CreateKSolver()
+pquad_coarse = chiCreateProductQuadrature(GAUSS_LEGENDRE,4)
+chiLBSGroupsetAddAngularMultigridLevel(phys,gs,pquad_coarse,scat_order)
+
+--############################################### Initialize and Execute Solver
+results_ref = {RunKSolver(phys_ref)}
+results = {RunKSolver(phys)}
+
+LogKComparison(results_ref, results)
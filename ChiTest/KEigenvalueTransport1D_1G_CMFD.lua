@@ -0,0 +1,34 @@
+-- 1D KEigen solver test with Vacuum BC, CMFD accelerated power iteration
+-- compared to power iteration. CMFD must reach the same eigenvalue in
+-- fewer outer iterations.
+-- SDM: PWLD
+-- Test: Final k-eigenvalue: 0.99954, k-diff=0.0 and Fewer-outer-iterations=1
+num_procs = 4
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+    chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+                      "Expected "..tostring(num_procs)..
+                      ". Pass check_num_procs=false to override if possible.")
+    os.exit(false)
+end
+
+dofile("ChiTest/KEigenvalueTransport1D_1G_Setup.lua")
+
+--############################################### Setup Physics
+phys_ref = CreateKSolver()
+
+-- A single sweep per outer iteration
+phys, gs = CreateKSolver()
+chiLBSGroupsetSetIterativeMethod(phys,gs,NPT_CLASSICRICHARDSON)
+chiLBSSetUseCMFD(phys,true)
+
+--############################################### Initialize and Execute Solver
+results_ref = {RunKSolver(phys_ref)}
+results = {RunKSolver(phys)}
+
+LogKComparison(results_ref, results)
@@ -0,0 +1,32 @@
+-- 1D KEigen solver test with Vacuum BC, power iteration with inexact inner
+-- iterations compared to power iteration with fully converged inners.
+-- Both must give the same k_eff, with fewer sweeps for inexact inners.
+-- SDM: PWLD
+-- Test: Final k-eigenvalue: 0.99954, k-diff=0.0 and Fewer-sweeps=1
+num_procs = 4
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+    chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+                      "Expected "..tostring(num_procs)..
+                      ". Pass check_num_procs=false to override if possible.")
+    os.exit(false)
+end
+
+dofile("ChiTest/KEigenvalueTransport1D_1G_Setup.lua")
+
+--############################################### Setup Physics
+phys_ref = CreateKSolver()
+
+phys = CreateKSolver()
+chiLBSSetInexactInnerTolerance(phys,true)
+
+--############################################### Initialize and Execute Solver
+results_ref = {RunKSolver(phys_ref)}
+results = {RunKSolver(phys)}
+
+LogKComparison(results_ref, results)
@@ -0,0 +1,35 @@
+-- 1D KEigen solver test with Reflecting BC, Jacobian-free Newton-Krylov
+-- compared to power iteration. The opposing reflecting boundaries are
+-- lagged between the residual evaluations. With the uniform material the
+-- eigenvalue is nu*sigma_f/sigma_a = 2.0*0.35/0.7 = 1.0
+-- SDM: PWLD
+-- Test: Final k-eigenvalue: 1.00000 and k-diff=0.0
+num_procs = 4
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+    chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+                      "Expected "..tostring(num_procs)..
+                      ". Pass check_num_procs=false to override if possible.")
+    os.exit(false)
+end
+
+dofile("ChiTest/KEigenvalueTransport1D_1G_Setup.lua")
+
+--############################################### Setup Physics
+phys_ref = CreateKSolver()
+SetReflectingBoundaries(phys_ref)
+
+phys = CreateKSolver()
+SetReflectingBoundaries(phys)
+chiLBSSetKEigenMethod(phys,KEIGEN_JFNK)
+
+--############################################### Initialize and Execute Solver
+results_ref = {RunKSolver(phys_ref)}
+results = {RunKSolver(phys)}
+
+LogKComparison(results_ref, results)
@@ -0,0 +1,161 @@
+-- Common setup of the 1D KEigen solver tests. Not a test by itself.
+-- Defines the mesh and the material, and CreateKSolver(), which creates a
+-- power iteration k-eigenvalue solver with vacuum boundaries that the
+-- tests modify before calling RunKSolver(phys).
+-- Loaded by the tests with dofile, from the root of the repository.
+
+chiMPIBarrier()
+
+-- ##################################################
+-- ##### Parameters #####
+-- ##################################################
+
+-- Mesh variables
+if (L == nil) then L = 100.0 end
+if (n_cells == nil) then n_cells = 50 end
+
+-- Transport angle information
+if (n_angles == nil) then n_angles = 16 end
+if (scat_order == nil) then scat_order = 0 end
+
+-- k-eigenvalue iteration parameters
+if (max_k_iters == nil) then max_k_iters = 5000 end
+if (k_tol == nil) then k_tol = 1e-8 end
+
+-- Source iteration parameters
+if (max_si_iters == nil) then max_si_iters = 500 end
+if (si_tol == nil) then si_tol = 1e-4 end
+
+-- Delayed neutrons
+if (use_precursors == nil) then use_precursors = true end
+
+-- Total cross section
+if (sigma_t == nil) then sigma_t = 1.0 end
+
+-- NOTE: For command line inputs, specify as:
+--       variable=[[argument]]
+
+-- Cross section file
+if (xsfile == nil) then
+    xsfile = "ChiTest/simple_fissile.csx"
+end
+
+-- ##################################################
+-- ##### Run problem #####
+-- ##################################################
+
+--############################################### Setup mesh
+-- Define nodes
+nodes = {}
+dx = L/n_cells
+for i=0,n_cells do
+  nodes[i+1] = i*dx
+end
+
+-- Create the mesh
+chiMeshHandlerCreate()
+_, region = chiMeshCreateUnpartitioned1DOrthoMesh(nodes)
+chiVolumeMesherSetProperty(PARTITION_TYPE, PARMETIS)
+chiVolumeMesherExecute()
+
+--############################################### Set Material IDs
+vol0 = chiLogicalVolumeCreate(RPP,-1000,1000,-1000,1000,-1000,1000)
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol0,0)
+
+--############################################### Add materials
+materials = {}
+
+-- Define cross sections
+xs = chiPhysicsTransportXSCreate()
+chiPhysicsTransportXSSet(xs,CHI_XSFILE,xsfile)
+combo = {{xs, 1.0}}
+xs_macro = chiPhysicsTransportXSMakeCombined(combo)
+
+-- Add material1
+materials[1] = chiPhysicsAddMaterial("Fissile Material")
+chiPhysicsMaterialAddProperty(materials[1], TRANSPORT_XSECTIONS)
+chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,EXISTING,xs_macro)
+G = chiPhysicsMaterialGetProperty(materials[1],TRANSPORT_XSECTIONS)["num_groups"]
+
+chiPhysicsMaterialModifyTotalCrossSection(materials[1], 0, sigma_t)
+
+--############################################### Setup Physics
+-- Create quadrature
+pquad = chiCreateProductQuadrature(GAUSS_LEGENDRE,n_angles)
+
+-- Creates a k-eigenvalue solver with a single groupset, returns the
+-- handles of the solver and of the groupset
+function CreateKSolver()
+    -- Define solver
+    local phys = chiKEigenvalueLBSCreateSolver()
+
+    -- Add region and discretization
+    chiSolverAddRegion(phys, region)
+    chiLBSSetProperty(phys,DISCRETIZATION_METHOD,PWLD)
+    chiLBSSetProperty(phys,SCATTERING_ORDER,scat_order)
+
+    -- Create groups
+    for g=0,G-1 do
+        chiLBSCreateGroup(phys)
+    end
+
+    -- Create groupset
+    local gs = chiLBSCreateGroupset(phys)
+    chiLBSGroupsetAddGroups(phys,gs,0,G-1)
+    chiLBSGroupsetSetQuadrature(phys,gs,pquad)
+    chiLBSGroupsetSetMaxIterations(phys,gs,max_si_iters)
+    chiLBSGroupsetSetResidualTolerance(phys,gs,si_tol)
+    chiLBSGroupsetSetIterativeMethod(phys,gs,NPT_GMRES_CYCLES)
+    chiLBSGroupsetSetAngleAggregationType(phys,gs,LBSGroupset.ANGLE_AGG_SINGLE)
+
+    -- Additional parameters
+    chiLBSSetMaxKIterations(phys,max_k_iters)
+    chiLBSSetKTolerance(phys,k_tol)
+    chiLBSSetUsePrecursors(phys,use_precursors)
+    chiLBSSetProperty(phys,VERBOSE_INNER_ITERATIONS,false)
+    chiLBSSetProperty(phys,VERBOSE_OUTER_ITERATIONS,false)
+
+    return phys, gs
+end
+
+-- Sets reflecting boundaries on both ends of the slab. With the uniform
+-- material k_eff is then k_inf = nu*sigma_f/sigma_a = 2.0*0.35/0.7 = 1.0
+function SetReflectingBoundaries(phys)
+    chiLBSSetProperty(phys,BOUNDARY_CONDITION,ZMIN,LBSBoundaryTypes.REFLECTING)
+    chiLBSSetProperty(phys,BOUNDARY_CONDITION,ZMAX,LBSBoundaryTypes.REFLECTING)
+end
+
+-- Initializes and executes a k-eigenvalue solver, returns k_eff, the
+-- number of outer iterations, the total number of sweeps and the number of
+-- inner iterations
+function RunKSolver(phys)
+    chiKEigenvalueLBSInitialize(phys)
+    chiKEigenvalueLBSExecute(phys)
+    return chiKEigenvalueLBSGetResults(phys)
+end
+
+-- Logs the results of a solver against those of a reference solver, each
+-- given as {k_eff, outer iterations, sweeps, inner iterations} from
+-- RunKSolver
+function LogKComparison(ref, res)
+    chiLog(LOG_0,string.format("k-ref=%.6f", ref[1]))
+    chiLog(LOG_0,string.format("k-value=%.6f", res[1]))
+    chiLog(LOG_0,string.format("k-diff=%.5e", math.abs(res[1] - ref[1])))
+    chiLog(LOG_0,string.format("Outer-iterations-ref=%d", ref[2]))
+    chiLog(LOG_0,string.format("Outer-iterations=%d", res[2]))
+    chiLog(LOG_0,string.format("Sweeps-ref=%d", ref[3]))
+    chiLog(LOG_0,string.format("Sweeps=%d", res[3]))
+    chiLog(LOG_0,string.format("Inner-iterations-ref=%d", ref[4]))
+    chiLog(LOG_0,string.format("Inner-iterations=%d", res[4]))
+
+    -- 1 when the solver needed less work than the reference, else 0
+    local fewer_outers = 0
+    local fewer_sweeps = 0
+    local fewer_inners = 0
+    if (res[2] < ref[2]) then fewer_outers = 1 end
+    if (res[3] < ref[3]) then fewer_sweeps = 1 end
+    if (res[4] < ref[4]) then fewer_inners = 1 end
+    chiLog(LOG_0,string.format("Fewer-outer-iterations=%d", fewer_outers))
+    chiLog(LOG_0,string.format("Fewer-sweeps=%d", fewer_sweeps))
+    chiLog(LOG_0,string.format("Fewer-inner-iterations=%d", fewer_inners))
+end
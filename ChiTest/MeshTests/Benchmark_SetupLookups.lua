@@ -0,0 +1,100 @@
+-- Benchmark of the setup time of a PWLD transport solver on a large 3D
+-- orthogonal mesh. The setup is dominated by global-to-local cell lookups
+-- (IsCellLocal, cells[global_id], neighbor cell data), e.g. during the
+-- creation of the spatial discretization and the sweep orderings.
+-- Run with any number of processes, e.g.
+--   mpiexec -np 4 ChiTech ChiTest/MeshTests/Benchmark_SetupLookups.lua N=64
+-- The reported times are wall-clock times of location 0, between
+-- barriers, and therefore include the MPI waits.
+-- The effect of the constant time global-to-local cell lookups on these
+-- times has not been measured yet. To measure it, run this input with the
+-- same N and number of processes on builds with and without that change,
+-- e.g. with N=64 and N=100, and compare the init and 1-iter times.
+if (N == nil) then N = 40 end
+
+
+
+
+--############################################### Setup mesh
+chiMeshHandlerCreate()
+
+mesh={}
+L=1.0
+xmin = 0.0
+dx = L/N
+for i=1,(N+1) do
+    k=i-1
+    mesh[i] = xmin + k*dx
+end
+chiMeshCreateUnpartitioned3DOrthoMesh(mesh,mesh,mesh)
+
+chiMPIBarrier()
+t_mesh = chiProgramTime()
+chiVolumeMesherExecute();
+chiMPIBarrier()
+t_mesh = chiProgramTime() - t_mesh
+
+--############################################### Set Material IDs
+vol0 = chiLogicalVolumeCreate(RPP,-1000,1000,-1000,1000,-1000,1000)
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol0,0)
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+
+chiPhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+chiPhysicsMaterialAddProperty(materials[1],ISOTROPIC_MG_SOURCE)
+
+num_groups = 1
+chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+        SIMPLEXS1,num_groups,1.0,0.5)
+
+src={}
+for g=1,num_groups do
+    src[g] = 1.0
+end
+chiPhysicsMaterialSetProperty(materials[1],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+
+--############################################### Setup Physics
+phys1 = chiLBSCreateSolver()
+chiSolverAddRegion(phys1,region1)
+
+--========== Groups
+grp = {}
+for g=1,num_groups do
+    grp[g] = chiLBSCreateGroup(phys1)
+end
+
+--========== ProdQuad
+pquad = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 2)
+
+--========== Groupset def
+gs0 = chiLBSCreateGroupset(phys1)
+cur_gs = gs0
+chiLBSGroupsetAddGroups(phys1,cur_gs,0,num_groups-1)
+chiLBSGroupsetSetQuadrature(phys1,cur_gs,pquad)
+chiLBSGroupsetSetAngleAggregationType(phys1,cur_gs,LBSGroupset.ANGLE_AGG_SINGLE)
+chiLBSGroupsetSetIterativeMethod(phys1,cur_gs,NPT_CLASSICRICHARDSON)
+chiLBSGroupsetSetResidualTolerance(phys1,cur_gs,1.0e-6)
+chiLBSGroupsetSetMaxIterations(phys1,cur_gs,1)
+
+chiLBSSetProperty(phys1,DISCRETIZATION_METHOD,PWLD)
+
+--############################################### Initialize and Execute Solver
+chiMPIBarrier()
+t_init = chiProgramTime()
+chiLBSInitialize(phys1)
+chiMPIBarrier()
+t_init = chiProgramTime() - t_init
+
+-- A single iteration, such that the time is dominated by the sweep
+-- ordering setup
+t_exec = chiProgramTime()
+chiLBSExecute(phys1)
+chiMPIBarrier()
+t_exec = chiProgramTime() - t_exec
+
+chiLog(LOG_0,string.format("Benchmark cells         = %d", N*N*N))
+chiLog(LOG_0,string.format("Benchmark mesh time     = %.3f s", t_mesh))
+chiLog(LOG_0,string.format("Benchmark init time     = %.3f s", t_init))
+chiLog(LOG_0,string.format("Benchmark 1-iter time   = %.3f s", t_exec))
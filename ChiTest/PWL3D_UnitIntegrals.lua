@@ -0,0 +1,45 @@
+-- 3D PWL unit integrals test on distorted hexahedra and polygonal prisms,
+-- extruded from an unstructured quadrilateral and polygon mesh. The closed
+-- form unit integrals of each polyhedron must match those computed from
+-- quadrature point data.
+-- SDM: PWLD
+-- Test: Max-diff=0.0
+num_procs = 1
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+    chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+                      "Expected "..tostring(num_procs)..
+                      ". Pass check_num_procs=false to override if possible.")
+    os.exit(false)
+end
+
+--############################################### Setup mesh
+chiMeshHandlerCreate()
+
+newSurfMesh = chiSurfaceMeshCreate();
+chiSurfaceMeshImportFromOBJFile(newSurfMesh,
+        "ChiResources/TestObjects/QuadMeshPolyMix.obj",true)
+
+region1 = chiRegionCreate()
+chiRegionAddSurfaceBoundary(region1,newSurfMesh);
+
+chiSurfaceMesherCreate(SURFACEMESHER_PREDEFINED);
+chiVolumeMesherCreate(VOLUMEMESHER_EXTRUDER,
+                      ExtruderTemplateType.SURFACE_MESH,
+                      newSurfMesh);
+
+chiVolumeMesherSetProperty(EXTRUSION_LAYER,0.3,2,"Bottom");
+chiVolumeMesherSetProperty(EXTRUSION_LAYER,0.5,1,"Top");
+
+chiSurfaceMesherExecute();
+chiVolumeMesherExecute();
+
+--############################################### Compare unit integrals
+max_diff = chiPWLTestUnitIntegrals()
+
+chiLog(LOG_0,string.format("Max-diff=%.5e", max_diff))
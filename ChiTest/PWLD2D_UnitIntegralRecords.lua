@@ -0,0 +1,42 @@
+-- 2D PWLD unit integral records test on a 10x10 orthogonal mesh. All
+-- cells are translations of each other and must share a single record.
+-- With nonuniform=true the cell widths alternate in x and y, which gives
+-- four unique cell shapes and therefore four records. The shared integrals
+-- of each cell must match those computed from its own cell mapping.
+-- SDM: PWLD
+-- Test: Max-diff=0.0 and Num-records=1 (4 with nonuniform=true)
+num_procs = 1
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+    chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+                      "Expected "..tostring(num_procs)..
+                      ". Pass check_num_procs=false to override if possible.")
+    os.exit(false)
+end
+
+--############################################### Setup mesh
+chiMeshHandlerCreate()
+
+mesh={}
+N=10
+xmin = 0.0
+mesh[1] = xmin
+for i=2,(N+1) do
+    dx = 1.0
+    if (nonuniform == true and (i % 2) == 1) then dx = 1.5 end
+    mesh[i] = mesh[i-1] + dx
+end
+chiMeshCreateUnpartitioned2DOrthoMesh(mesh,mesh)
+chiVolumeMesherExecute();
+
+--############################################### Compare unit integrals
+max_diff, num_records, num_cells = chiPWLDTestUnitIntegralRecords()
+
+chiLog(LOG_0,string.format("Num-cells=%d", num_cells))
+chiLog(LOG_0,string.format("Num-records=%d", num_records))
+chiLog(LOG_0,string.format("Max-diff=%.5e", max_diff))
@@ -1,4 +1,8 @@
 -- 2D Transport test with Vacuum and Incident-isotropic BC.
+-- Also run on 4 processes with -num_replicas 2 and check_num_procs=false,
+-- i.e. with two replicated spatial domains of 2 processes each, with the
+-- replicas dividing either the group subsets or, with
+-- angle_decomposition=true, the quadrants.
 -- SDM: PWLD
 -- Test: Max-value=0.50758 and 2.52527e-04
 num_procs = 4
@@ -26,9 +30,14 @@ region1 = chiRegionCreate()
 chiSurfaceMesherCreate(SURFACEMESHER_PREDEFINED);
 chiVolumeMesherCreate(VOLUMEMESHER_UNPARTITIONED);
 
-chiVolumeMesherSetKBAPartitioningPxPyPz(2,2,1)
-chiVolumeMesherSetKBACutsX({0.0})
-chiVolumeMesherSetKBACutsY({0.0})
+if (chi_number_of_processes == 2) then
+    chiVolumeMesherSetKBAPartitioningPxPyPz(2,1,1)
+    chiVolumeMesherSetKBACutsX({0.0})
+else
+    chiVolumeMesherSetKBAPartitioningPxPyPz(2,2,1)
+    chiVolumeMesherSetKBACutsX({0.0})
+    chiVolumeMesherSetKBACutsY({0.0})
+end
 
 chiVolumeMesherSetProperty(PARTITION_TYPE,KBA_STYLE_XYZ)
 
@@ -118,6 +127,9 @@ chiLBSSetProperty(phys1,BOUNDARY_CONDITION,XMIN,
 
 chiLBSSetProperty(phys1,DISCRETIZATION_METHOD,PWLD)
 chiLBSSetProperty(phys1,SCATTERING_ORDER,1)
+if (angle_decomposition == true) then
+    chiLBSSetProperty(phys1,ANGLE_DOMAIN_DECOMPOSITION,true)
+end
 
 --############################################### Initialize and Execute Solver
 chiLBSInitialize(phys1)
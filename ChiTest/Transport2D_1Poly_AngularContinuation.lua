@@ -0,0 +1,124 @@
+-- 2D Transport test with Vacuum BC, comparing source iteration with and
+-- without angular continuation. The second solver is first solved with a
+-- coarse product quadrature, the flux moments of which are the initial guess
+-- of the solve with the groupset's own quadrature. Both solvers must give
+-- the same scalar flux.
+-- SDM: PWLD
+-- Test: Max-diff=0.0
+num_procs = 4
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+    chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+                      "Expected "..tostring(num_procs)..
+                      ". Pass check_num_procs=false to override if possible.")
+    os.exit(false)
+end
+
+--############################################### Setup mesh
+chiMeshHandlerCreate()
+
+chiUnpartitionedMeshFromWavefrontOBJ(
+        "ChiResources/TestObjects/SquareMesh2x2QuadsBlock.obj")
+
+region1 = chiRegionCreate()
+
+chiSurfaceMesherCreate(SURFACEMESHER_PREDEFINED);
+chiVolumeMesherCreate(VOLUMEMESHER_UNPARTITIONED);
+
+chiVolumeMesherSetKBAPartitioningPxPyPz(2,2,1)
+chiVolumeMesherSetKBACutsX({0.0})
+chiVolumeMesherSetKBACutsY({0.0})
+
+chiVolumeMesherSetProperty(PARTITION_TYPE,KBA_STYLE_XYZ)
+
+chiSurfaceMesherExecute();
+chiVolumeMesherExecute();
+
+--############################################### Set Material IDs
+vol0 = chiLogicalVolumeCreate(RPP,-1000,1000,-1000,1000,-1000,1000)
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol0,0)
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+
+chiPhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+chiPhysicsMaterialAddProperty(materials[1],ISOTROPIC_MG_SOURCE)
+
+num_groups = 1
+chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+        SIMPLEXS1,num_groups,1.0,0.9)
+
+src={}
+for g=1,num_groups do
+    src[g] = 1.0
+end
+chiPhysicsMaterialSetProperty(materials[1],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+
+--############################################### Setup Physics
+pquad        = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,8, 4)
+pquad_coarse = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 2)
+
+-- Creates a solver with a single groupset, with angular continuation from
+-- the coarse quadrature if requested
+function CreateSolver(use_continuation)
+    local phys = chiLBSCreateSolver()
+    chiSolverAddRegion(phys,region1)
+
+    for g=1,num_groups do
+        chiLBSCreateGroup(phys)
+    end
+
+    local gs = chiLBSCreateGroupset(phys)
+    chiLBSGroupsetAddGroups(phys,gs,0,num_groups-1)
+    chiLBSGroupsetSetQuadrature(phys,gs,pquad)
+    chiLBSGroupsetSetAngleAggDiv(phys,gs,1)
+    chiLBSGroupsetSetGroupSubsets(phys,gs,1)
+    chiLBSGroupsetSetIterativeMethod(phys,gs,NPT_CLASSICRICHARDSON)
+    chiLBSGroupsetSetResidualTolerance(phys,gs,1.0e-8)
+    chiLBSGroupsetSetMaxIterations(phys,gs,1000)
+    if (use_continuation) then
+        chiLBSGroupsetSetContinuationQuadrature(phys,gs,pquad_coarse,1.0e-4)
+    end
+
+    chiLBSSetProperty(phys,DISCRETIZATION_METHOD,PWLD)
+    chiLBSSetProperty(phys,SCATTERING_ORDER,0)
+
+    return phys
+end
+
+phys1 = CreateSolver(false)
+phys2 = CreateSolver(true)
+--############################################### Initialize and Execute Solver
+chiLBSInitialize(phys1)
+chiLBSExecute(phys1)
+
+chiLBSInitialize(phys2)
+chiLBSExecute(phys2)
+
+--############################################### Volume integrations
+-- Returns the maximum of a field function
+function GetMaxValue(ff)
+    local ffi = chiFFInterpolationCreate(VOLUME)
+    chiFFInterpolationSetProperty(ffi,OPERATION,OP_MAX)
+    chiFFInterpolationSetProperty(ffi,LOGICAL_VOLUME,vol0)
+    chiFFInterpolationSetProperty(ffi,ADD_FIELDFUNCTION,ff)
+
+    chiFFInterpolationInitialize(ffi)
+    chiFFInterpolationExecute(ffi)
+    return chiFFInterpolationGetValue(ffi)
+end
+
+fflist1,count = chiLBSGetScalarFieldFunctionList(phys1)
+fflist2,count = chiLBSGetScalarFieldFunctionList(phys2)
+
+maxval1 = GetMaxValue(fflist1[1])
+maxval2 = GetMaxValue(fflist2[1])
+
+chiLog(LOG_0,string.format("Max-value=%.5e", maxval1))
+chiLog(LOG_0,string.format("Max-diff=%.5e", math.abs(maxval1 - maxval2)))
@@ -0,0 +1,132 @@
+-- 2D Transport test with Vacuum BC, comparing a single groupset with the
+-- groupsets created by chiLBSComputeGroupsetPartitioning. The solver's
+-- material only downscatters, hence each group must become its own
+-- groupset. A second material with upscattering is not used by any cell
+-- and must not merge the groups. Both solvers must give the same scalar
+-- flux in both groups.
+-- SDM: PWLD
+-- Test: Num-blocks=2, Max-diff1=0.0 and Max-diff2=0.0
+num_procs = 4
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+    chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+                      "Expected "..tostring(num_procs)..
+                      ". Pass check_num_procs=false to override if possible.")
+    os.exit(false)
+end
+
+--############################################### Setup mesh
+chiMeshHandlerCreate()
+
+chiUnpartitionedMeshFromWavefrontOBJ(
+        "ChiResources/TestObjects/SquareMesh2x2QuadsBlock.obj")
+
+region1 = chiRegionCreate()
+
+chiSurfaceMesherCreate(SURFACEMESHER_PREDEFINED);
+chiVolumeMesherCreate(VOLUMEMESHER_UNPARTITIONED);
+
+chiVolumeMesherSetKBAPartitioningPxPyPz(2,2,1)
+chiVolumeMesherSetKBACutsX({0.0})
+chiVolumeMesherSetKBACutsY({0.0})
+
+chiVolumeMesherSetProperty(PARTITION_TYPE,KBA_STYLE_XYZ)
+
+chiSurfaceMesherExecute();
+chiVolumeMesherExecute();
+
+--############################################### Set Material IDs
+vol0 = chiLogicalVolumeCreate(RPP,-1000,1000,-1000,1000,-1000,1000)
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol0,0)
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+materials[2] = chiPhysicsAddMaterial("Unused Upscatter Material");
+
+chiPhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+chiPhysicsMaterialAddProperty(materials[1],ISOTROPIC_MG_SOURCE)
+chiPhysicsMaterialAddProperty(materials[2],TRANSPORT_XSECTIONS)
+
+-- With two groups SIMPLEXS1 only downscatters
+num_groups = 2
+chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+        SIMPLEXS1,num_groups,1.0,0.5)
+chiPhysicsMaterialSetProperty(materials[2],TRANSPORT_XSECTIONS,
+        CHI_XSFILE,"ChiTest/xs_2g_upscatter.cxs")
+
+src={}
+for g=1,num_groups do
+    src[g] = 0.0
+end
+src[1] = 1.0
+chiPhysicsMaterialSetProperty(materials[1],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+
+--############################################### Setup Physics
+pquad = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 2)
+
+-- Creates a solver with a single groupset containing all groups
+function CreateSolver()
+    local phys = chiLBSCreateSolver()
+    chiSolverAddRegion(phys,region1)
+
+    for g=1,num_groups do
+        chiLBSCreateGroup(phys)
+    end
+
+    local gs = chiLBSCreateGroupset(phys)
+    chiLBSGroupsetAddGroups(phys,gs,0,num_groups-1)
+    chiLBSGroupsetSetQuadrature(phys,gs,pquad)
+    chiLBSGroupsetSetAngleAggDiv(phys,gs,1)
+    chiLBSGroupsetSetGroupSubsets(phys,gs,1)
+    chiLBSGroupsetSetIterativeMethod(phys,gs,NPT_CLASSICRICHARDSON)
+    chiLBSGroupsetSetResidualTolerance(phys,gs,1.0e-8)
+    chiLBSGroupsetSetMaxIterations(phys,gs,300)
+
+    chiLBSSetProperty(phys,DISCRETIZATION_METHOD,PWLD)
+    chiLBSSetProperty(phys,SCATTERING_ORDER,0)
+
+    return phys, gs
+end
+
+phys1 = CreateSolver()
+phys2, gs2 = CreateSolver()
+
+blocks,num_blocks = chiLBSComputeGroupsetPartitioning(phys2,true,gs2)
+
+--############################################### Initialize and Execute Solver
+chiLBSInitialize(phys1)
+chiLBSExecute(phys1)
+
+chiLBSInitialize(phys2)
+chiLBSExecute(phys2)
+
+--############################################### Volume integrations
+-- Returns the maximum of a field function
+function GetMaxValue(ff)
+    local ffi = chiFFInterpolationCreate(VOLUME)
+    chiFFInterpolationSetProperty(ffi,OPERATION,OP_MAX)
+    chiFFInterpolationSetProperty(ffi,LOGICAL_VOLUME,vol0)
+    chiFFInterpolationSetProperty(ffi,ADD_FIELDFUNCTION,ff)
+
+    chiFFInterpolationInitialize(ffi)
+    chiFFInterpolationExecute(ffi)
+    return chiFFInterpolationGetValue(ffi)
+end
+
+fflist1,count = chiLBSGetScalarFieldFunctionList(phys1)
+fflist2,count = chiLBSGetScalarFieldFunctionList(phys2)
+
+chiLog(LOG_0,string.format("Num-blocks=%d", num_blocks))
+for g=1,num_groups do
+    local maxval1 = GetMaxValue(fflist1[g])
+    local maxval2 = GetMaxValue(fflist2[g])
+
+    chiLog(LOG_0,string.format("Max-value%d=%.5e", g, maxval1))
+    chiLog(LOG_0,string.format("Max-diff%d=%.5e", g, math.abs(maxval1 - maxval2)))
+end
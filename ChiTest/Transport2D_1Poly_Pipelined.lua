@@ -0,0 +1,138 @@
+-- 2D Transport test with Vacuum and Incident-isotropic BC, comparing
+-- sequential and pipelined sweeps of two downscatter-only groupsets.
+-- The groupsets use different quadratures, hence different numbers of
+-- sweep messages per angleset, such that the pipelined sweep must use a
+-- common message tag stride for both stages. Both solvers must give the
+-- same scalar flux in both groups.
+-- SDM: PWLD
+-- Test: Max-diff1=0.0 and Max-diff2=0.0
+num_procs = 4
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+    chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+                      "Expected "..tostring(num_procs)..
+                      ". Pass check_num_procs=false to override if possible.")
+    os.exit(false)
+end
+
+--############################################### Setup mesh
+chiMeshHandlerCreate()
+
+chiUnpartitionedMeshFromWavefrontOBJ(
+        "ChiResources/TestObjects/SquareMesh2x2QuadsBlock.obj")
+
+region1 = chiRegionCreate()
+
+chiSurfaceMesherCreate(SURFACEMESHER_PREDEFINED);
+chiVolumeMesherCreate(VOLUMEMESHER_UNPARTITIONED);
+
+chiVolumeMesherSetKBAPartitioningPxPyPz(2,2,1)
+chiVolumeMesherSetKBACutsX({0.0})
+chiVolumeMesherSetKBACutsY({0.0})
+
+chiVolumeMesherSetProperty(PARTITION_TYPE,KBA_STYLE_XYZ)
+
+chiSurfaceMesherExecute();
+chiVolumeMesherExecute();
+
+--############################################### Set Material IDs
+vol0 = chiLogicalVolumeCreate(RPP,-1000,1000,-1000,1000,-1000,1000)
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol0,0)
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+
+chiPhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+chiPhysicsMaterialAddProperty(materials[1],ISOTROPIC_MG_SOURCE)
+
+-- With two groups SIMPLEXS1 only downscatters
+num_groups = 2
+chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+        SIMPLEXS1,num_groups,1.0,0.5)
+
+src={}
+for g=1,num_groups do
+    src[g] = 0.0
+end
+chiPhysicsMaterialSetProperty(materials[1],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+
+bsrc={}
+for g=1,num_groups do
+    bsrc[g] = 0.0
+end
+bsrc[1] = 1.0/4.0/math.pi
+
+--############################################### Setup Physics
+pquad0 = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 2)
+pquad1 = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,4, 4)
+
+-- Creates a solver with one groupset per group, optionally pipelined
+function CreateSolver(pipelined)
+    local phys = chiLBSCreateSolver()
+    chiSolverAddRegion(phys,region1)
+
+    for g=1,num_groups do
+        chiLBSCreateGroup(phys)
+    end
+
+    local quads = {pquad0, pquad1}
+    for g=1,num_groups do
+        local gs = chiLBSCreateGroupset(phys)
+        chiLBSGroupsetAddGroups(phys,gs,g-1,g-1)
+        chiLBSGroupsetSetQuadrature(phys,gs,quads[g])
+        chiLBSGroupsetSetAngleAggDiv(phys,gs,1)
+        chiLBSGroupsetSetGroupSubsets(phys,gs,1)
+        chiLBSGroupsetSetIterativeMethod(phys,gs,NPT_CLASSICRICHARDSON)
+        chiLBSGroupsetSetResidualTolerance(phys,gs,1.0e-8)
+        chiLBSGroupsetSetMaxIterations(phys,gs,300)
+    end
+
+    chiLBSSetProperty(phys,BOUNDARY_CONDITION,XMIN,
+                           LBSBoundaryTypes.INCIDENT_ISOTROPIC,bsrc);
+
+    chiLBSSetProperty(phys,DISCRETIZATION_METHOD,PWLD)
+    chiLBSSetProperty(phys,SCATTERING_ORDER,0)
+    chiLBSSetProperty(phys,PIPELINE_DOWNSCATTER_GROUPSETS,pipelined)
+
+    return phys
+end
+
+phys1 = CreateSolver(false)
+phys2 = CreateSolver(true)
+
+--############################################### Initialize and Execute Solver
+chiLBSInitialize(phys1)
+chiLBSExecute(phys1)
+
+chiLBSInitialize(phys2)
+chiLBSExecute(phys2)
+
+--############################################### Volume integrations
+-- Returns the maximum of a field function
+function GetMaxValue(ff)
+    local ffi = chiFFInterpolationCreate(VOLUME)
+    chiFFInterpolationSetProperty(ffi,OPERATION,OP_MAX)
+    chiFFInterpolationSetProperty(ffi,LOGICAL_VOLUME,vol0)
+    chiFFInterpolationSetProperty(ffi,ADD_FIELDFUNCTION,ff)
+
+    chiFFInterpolationInitialize(ffi)
+    chiFFInterpolationExecute(ffi)
+    return chiFFInterpolationGetValue(ffi)
+end
+
+fflist1,count = chiLBSGetScalarFieldFunctionList(phys1)
+fflist2,count = chiLBSGetScalarFieldFunctionList(phys2)
+
+for g=1,num_groups do
+    local maxval1 = GetMaxValue(fflist1[g])
+    local maxval2 = GetMaxValue(fflist2[g])
+
+    chiLog(LOG_0,string.format("Max-value%d=%.5e", g, maxval1))
+    chiLog(LOG_0,string.format("Max-diff%d=%.5e", g, math.abs(maxval1 - maxval2)))
+end
@@ -106,6 +106,15 @@ chiLBSGroupsetSetGMRESRestartIntvl(phys1,cur_gs,100)
 --chiLBSGroupsetSetWGDSA(phys1,cur_gs,30,1.0e-4,false," ")
 --chiLBSGroupsetSetTGDSA(phys1,cur_gs,30,1.0e-4,false," ")
 
+-- Pass with_dsa=true to accelerate both groupsets with WGDSA+TGDSA. The
+-- converged flux must be the same.
+if (with_dsa ~= nil) then
+    chiLBSGroupsetSetWGDSA(phys1,gs0,30,1.0e-4,false," ")
+    chiLBSGroupsetSetTGDSA(phys1,gs0,30,1.0e-4,false," ")
+    chiLBSGroupsetSetWGDSA(phys1,gs1,30,1.0e-4,false," ")
+    chiLBSGroupsetSetTGDSA(phys1,gs1,30,1.0e-4,false," ")
+end
+
 --############################################### Set boundary conditions
 bsrc={}
 for g=1,num_groups do
@@ -15,6 +15,9 @@ import textwrap
 # since something as simple as a preconditioner can change
 # iteration count but still produce the same answer
 
+# Command line options of the executable, e.g. "-num_replicas 2", can be
+# passed to a test via the optional args list of run_test.
+
 kscript_path = os.path.dirname(os.path.abspath(__file__))
 kchi_src_pth = kscript_path + '/../'
 kpath_to_exe = kchi_src_pth + '/bin/ChiTech'
@@ -61,7 +64,6 @@ def parse_output(out, search_strings_vals_tols):
         # end of the line at which string was found
         test_str_line_end = out.find("\n", test_str_start)
 
-        test_passed = True
         if test_str_start >= 0:
             # convert value to number
             test_val = float(out[test_str_end:test_str_line_end])
@@ -80,7 +82,7 @@ def parse_output(out, search_strings_vals_tols):
     return test_passed
 
 def run_test_tacc(file_name, comment, num_procs,
-		search_strings_vals_tols):
+		search_strings_vals_tols, args=[]):
     test_name = format_filename(file_name) + " " + comment + " " + str(num_procs) + " MPI Processes"
     print("Running Test " + format3(test_number) + " " + test_name, end='', flush=True)
     if print_only: print(""); return
@@ -99,7 +101,7 @@ def run_test_tacc(file_name, comment, num_procs,
 
             export I_MPI_SHM=disable
 
-            ibrun {kpath_to_exe} ChiTest/{file_name}.lua master_export=false
+            ibrun {kpath_to_exe} ChiTest/{file_name}.lua master_export=false {" ".join(args)}
             """
         ).strip())
     os.system(f"sbatch -W ChiTest/{file_name}.job > /dev/null")  # -W means wait for job to finish
@@ -113,7 +115,7 @@ def run_test_tacc(file_name, comment, num_procs,
         os.system(f"rm ChiTest/{file_name}.job ChiTest/{file_name}.o ChiTest/{file_name}.e")
 
 def run_test_tamu(file_name, comment, num_procs,
-		search_strings_vals_tols):
+		search_strings_vals_tols, args=[]):
     test_name = format_filename(file_name) + " " + comment + " " + str(num_procs) + " MPI Processes"
     print("Running Test " + format3(test_number) + " " + test_name, end='', flush=True)
     if print_only: print(""); return
@@ -130,7 +132,7 @@ def run_test_tamu(file_name, comment, num_procs,
             #SBATCH -t 00:05:00 # Runtime (hh:mm:ss)
             #SBATCH -A class # Allocation name (req'd if you have more than 1)
 
-            mpiexec -n {num_procs} {kpath_to_exe} ChiTest/{file_name}.lua master_export=false
+            mpiexec -n {num_procs} {kpath_to_exe} ChiTest/{file_name}.lua master_export=false {" ".join(args)}
             """
         ).strip())
     os.system(f"sbatch -W ChiTest/{file_name}.job > /dev/null")  # -W means wait for job to finish
@@ -145,12 +147,12 @@ def run_test_tamu(file_name, comment, num_procs,
 
 
 def run_test_local(file_name, comment, num_procs,
-		search_strings_vals_tols):
+		search_strings_vals_tols, args=[]):
     test_name = format_filename(file_name) + " " + comment + " " + str(num_procs) + " MPI Processes"
     print("Running Test " + format3(test_number) + " " + test_name, end='', flush=True)
     if print_only: print(""); return
     process = subprocess.Popen(["mpiexec", "-np", str(num_procs), kpath_to_exe,
-                                "ChiTest/" + file_name + ".lua", "master_export=false"],
+                                "ChiTest/" + file_name + ".lua", "master_export=false"] + args,
                                cwd=kchi_src_pth,
                                stdout=subprocess.PIPE,
                                universal_newlines=True)
@@ -160,20 +162,20 @@ def run_test_local(file_name, comment, num_procs,
     parse_output(out, search_strings_vals_tols)
 
 def run_test(file_name, comment, num_procs,
-		search_strings_vals_tols):
+		search_strings_vals_tols, args=[]):
     global test_number
     test_number += 1
     if ((tests_to_run) and (test_number in tests_to_run)) or \
        (not tests_to_run):
         if tacc:
             run_test_tacc(file_name, comment, num_procs,
-                search_strings_vals_tols)
+                search_strings_vals_tols, args)
         elif tamu:
             run_test_tamu(file_name, comment, num_procs,
-                search_strings_vals_tols)
+                search_strings_vals_tols, args)
         else:
             run_test_local(file_name, comment, num_procs,
-                search_strings_vals_tols)
+                search_strings_vals_tols, args)
 
 # $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$ Diffusion tests
 run_test(
@@ -218,6 +220,13 @@ run_test(
     num_procs=4,
     search_strings_vals_tols=[["[0]  Max-value=", 0.29685, 1.0e-4]])
 
+run_test(
+    file_name="Diffusion2D_2Unstructured_IP",
+    comment="2D Diffusion Test Unstr. Mesh re-assembly - DFEM",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]  Max-value=", 0.29685, 1.0e-4]],
+    args=["reassemble=true"])
+
 run_test(
     file_name="Diffusion3D_1Poly",
     comment="3D Diffusion Test - CFEM",
@@ -269,6 +278,23 @@ run_test(
     search_strings_vals_tols=[["[0]  Max-value1=", 0.50758, 1.0e-4],
                               ["[0]  Max-value2=", 2.52527e-04, 1.0e-4]])
 
+run_test(
+    file_name="Transport2D_1Poly",
+    comment="2D LinearBSolver Test replicated spatial domains - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]  Max-value1=", 0.50758, 1.0e-4],
+                              ["[0]  Max-value2=", 2.52527e-04, 1.0e-4]],
+    args=["check_num_procs=false", "-num_replicas", "2"])
+
+run_test(
+    file_name="Transport2D_1Poly",
+    comment="2D LinearBSolver Test replicated spatial domains angle decomposition - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]  Max-value1=", 0.50758, 1.0e-4],
+                              ["[0]  Max-value2=", 2.52527e-04, 1.0e-4]],
+    args=["check_num_procs=false", "angle_decomposition=true",
+          "-num_replicas", "2"])
+
 run_test(
     file_name="Transport2D_2Unstructured",
     comment="2D LinearBSolver Test Unstructured grid - PWLD",
@@ -343,6 +369,191 @@ run_test(
     search_strings_vals_tols=[["[0]  Max-valueG1=", 1.00000, 1.0e-09],
                               ["[0]  Max-valueG2=", 0.25000, 1.0e-09]])
 
+run_test(
+    file_name="Transport2D_1Poly_DSAMatrixFree",
+    comment="2D LinearBSolver Test assembled vs matrix-free DSA - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]  Max-diff=", 0.0, 1.0e-8]])
+
+run_test(
+    file_name="KEigenvalueTransport1D_1G_Reflecting_JFNK",
+    comment="1D KSolver JFNK Test Reflecting BC - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]          Final k-eigenvalue    :", 1.00000, 1.0e-5],
+                              ["[0]  k-diff=", 0.0, 1.0e-6]])
+
+run_test(
+    file_name="KEigenvalueTransport1D_1G_CMFD",
+    comment="1D KSolver CMFD Test - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]          Final k-eigenvalue    :", 0.99954, 1.0e-5],
+                              ["[0]  k-diff=", 0.0, 1.0e-6],
+                              ["[0]  Fewer-outer-iterations=", 1.0, 0.5]])
+
+run_test(
+    file_name="KEigenvalueTransport1D_1G_Wielandt",
+    comment="1D KSolver Wielandt Test - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]          Final k-eigenvalue    :", 0.99954, 1.0e-5],
+                              ["[0]  k-diff=", 0.0, 1.0e-6]])
+
+run_test(
+    file_name="KEigenvalueTransport1D_1G_InexactInners",
+    comment="1D KSolver Inexact Inner Iterations Test - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]          Final k-eigenvalue    :", 0.99954, 1.0e-5],
+                              ["[0]  k-diff=", 0.0, 1.0e-6],
+                              ["[0]  Fewer-sweeps=", 1.0, 0.5]])
+
+run_test(
+    file_name="KEigenvalueTransport1D_1G_KrylovReuse",
+    comment="1D KSolver Krylov Reuse Test - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]          Final k-eigenvalue    :", 0.99954, 1.0e-5],
+                              ["[0]  k-diff=", 0.0, 1.0e-6],
+                              ["[0]  Fewer-inner-iterations=", 1.0, 0.5],
+                              ["[0]  Fewer-sweeps=", 1.0, 0.5]])
+
+run_test(
+    file_name="KEigenvalueTransport1D_1G_JFNK",
+    comment="1D KSolver JFNK Test - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]          Final k-eigenvalue    :", 0.99954, 1.0e-5],
+                              ["[0]  k-diff=", 0.0, 1.0e-6]])
+
+run_test(
+    file_name="KEigenvalueTransport1D_1G_AngularMG",
+    comment="1D KSolver Angular Multigrid Test - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]          Final k-eigenvalue    :", 0.99954, 1.0e-5],
+                              ["[0]  k-diff=", 0.0, 1.0e-6],
+                              ["[0]  Fewer-sweeps=", 1.0, 0.5]])
+
+run_test(
+    file_name="Transport2D_1Poly_MultiRHS",
+    comment="2D LinearBSolver Test multiple right-hand sides - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]  Max-diff=", 0.0, 1.0e-6],
+                              ["[0]  Max-ratio=", 2.0, 1.0e-4]])
+
+run_test(
+    file_name="Transport2D_2Unstructured",
+    comment="2D LinearBSolver Test Unstructured grid DSA tiny unit integrals cache - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]  Max-value1=", 0.51187, 1.0e-4],
+                              ["[0]  Max-value2=", 1.42458e-03, 1.0e-4]],
+    args=["with_dsa=true", "-unit_integrals_cache_mb", "0.0001"])
+
+# The cache holds roughly a third of the ~170 triangles per process. A
+# least-recently-used cache would not hit at all under the cyclic sweep
+# order, the resident set should hit on about a third of the accesses.
+run_test(
+    file_name="Transport2D_2Unstructured",
+    comment="2D LinearBSolver Test Unstructured grid small unit integrals cache - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]  Max-value1=", 0.51187, 1.0e-4],
+                              ["[0]  Max-value2=", 1.42458e-03, 1.0e-4],
+                              ["[0]  Unit integrals cache hit-rate=", 35.0, 20.0]],
+    args=["-unit_integrals_cache_mb", "0.1"])
+
+run_test(
+    file_name="Transport2D_1Poly_GroupsetPartitioning",
+    comment="2D LinearBSolver Test groupset partitioning - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]  Num-blocks=", 2.0, 1.0e-8],
+                              ["[0]  Max-diff1=", 0.0, 1.0e-6],
+                              ["[0]  Max-diff2=", 0.0, 1.0e-6]])
+
+run_test(
+    file_name="Transport2D_1Poly_Pipelined",
+    comment="2D LinearBSolver Test pipelined groupsets - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]  Max-diff1=", 0.0, 1.0e-8],
+                              ["[0]  Max-diff2=", 0.0, 1.0e-8]])
+
+run_test(
+    file_name="Transport2D_1Poly_Anderson",
+    comment="2D LinearBSolver Test Anderson acceleration - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]  Max-diff=", 0.0, 1.0e-5],
+                              ["[0]  Fewer-sweeps=", 1.0, 0.5]])
+
+run_test(
+    file_name="Transport2D_1Poly_SharedDSA",
+    comment="2D LinearBSolver Test shared DSA solvers - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]  Max-diff1=", 0.0, 1.0e-8],
+                              ["[0]  Max-diff2=", 0.0, 1.0e-8]])
+
+run_test(
+    file_name="PWL3D_UnitIntegrals",
+    comment="3D PWL closed form unit integrals on distorted polyhedra",
+    num_procs=1,
+    search_strings_vals_tols=[["[0]  Max-diff=", 0.0, 1.0e-12]])
+
+run_test(
+    file_name="Transport2D_1Poly_MaterialScatteringOrder",
+    comment="2D LinearBSolver Test material scattering order - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]  Max-diff=", 0.0, 1.0e-6]])
+
+run_test(
+    file_name="Transport2D_1Poly_DSARightPC",
+    comment="2D LinearBSolver Test DSA right preconditioned FGMRES - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]  Max-diff=", 0.0, 1.0e-5]])
+
+run_test(
+    file_name="Transport2D_1Poly_AngularContinuation",
+    comment="2D LinearBSolver Test angular continuation - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]  Max-diff=", 0.0, 1.0e-5]])
+
+run_test(
+    file_name="Transport2D_1Poly_SolverReuse",
+    comment="2D LinearBSolver Test solver reuse after a material update - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]  Max-diff=", 0.0, 1.0e-6]])
+
+run_test(
+    file_name="PWLD2D_UnitIntegralRecords",
+    comment="2D PWLD unit integral records orthogonal mesh",
+    num_procs=1,
+    search_strings_vals_tols=[["[0]  Num-records=", 1.0, 1.0e-8],
+                              ["[0]  Max-diff=", 0.0, 1.0e-12]])
+
+run_test(
+    file_name="PWLD2D_UnitIntegralRecords",
+    comment="2D PWLD unit integral records nonuniform orthogonal mesh",
+    num_procs=1,
+    search_strings_vals_tols=[["[0]  Num-records=", 4.0, 1.0e-8],
+                              ["[0]  Max-diff=", 0.0, 1.0e-12]],
+    args=["nonuniform=true"])
+
+run_test(
+    file_name="PWL3D_FlatUnitIntegrals",
+    comment="3D PWL flat unit integrals storage on distorted polyhedra",
+    num_procs=1,
+    search_strings_vals_tols=[["[0]  Max-diff=", 0.0, 1.0e-14]])
+
+# The records are assigned serially and their integrals computed on four
+# threads, the counts and integrals must not change.
+run_test(
+    file_name="PWLD2D_UnitIntegralRecords",
+    comment="2D PWLD unit integral records nonuniform orthogonal mesh setup threads",
+    num_procs=1,
+    search_strings_vals_tols=[["[0]  Num-records=", 4.0, 1.0e-8],
+                              ["[0]  Max-diff=", 0.0, 1.0e-12]],
+    args=["nonuniform=true", "-num_setup_threads", "4"])
+
+run_test(
+    file_name="Transport2D_2Unstructured",
+    comment="2D LinearBSolver Test Unstructured grid setup threads - PWLD",
+    num_procs=4,
+    search_strings_vals_tols=[["[0]  Max-value1=", 0.51187, 1.0e-4],
+                              ["[0]  Max-value2=", 1.42458e-03, 1.0e-4]],
+    args=["with_dsa=true", "-num_setup_threads", "2"])
+
 # $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$ END OF TESTS
 print("")
 if num_failed == 0: